@@ -0,0 +1,143 @@
+/// @file
+/// @brief Collision constraints of the UR5 above a table (as in the
+/// ur5_table_halfspace.py example), one function per pair against a single
+/// multi-pair function with and without broadphase culling.
+
+#include "aligator/core/shared-data-scope.hpp"
+#include "aligator/modelling/multibody/frame-collision.hpp"
+#include "aligator/modelling/multibody/multi-frame-collision.hpp"
+
+#include <pinocchio/algorithm/joint-configuration.hpp>
+#include <pinocchio/parsers/urdf.hpp>
+#include <coal/shape/geometric_shapes.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+namespace pin = pinocchio;
+using namespace aligator;
+
+using T = double;
+using FrameCollision = FrameCollisionResidualTpl<T>;
+using MultiFrameCollision = MultiFrameCollisionResidualTpl<T>;
+using StageFunctionData = StageFunctionDataTpl<T>;
+using Eigen::VectorXd;
+
+constexpr T table_height = 0.65;
+
+pin::Model make_ur5() {
+  const std::string urdf_path =
+      EXAMPLE_ROBOT_DATA_MODEL_DIR "/ur_description/urdf/ur5_robot.urdf";
+  pin::Model model;
+  pin::urdf::buildModel(urdf_path, model);
+  return model;
+}
+
+/// Capsules around the links of the arm, against the table top and three
+/// spheres laid on it: 24 collision pairs.
+pin::GeometryModel make_scene(const pin::Model &model) {
+  pin::GeometryModel geom_model;
+  std::vector<pin::GeomIndex> links, obstacles;
+  for (pin::JointIndex j = 1; j < pin::JointIndex(model.njoints); j++) {
+    const auto frame_id = model.getFrameId(model.names[j]);
+    links.push_back(geom_model.addGeometryObject(pin::GeometryObject(
+        model.names[j] + "_capsule", j, frame_id, pin::SE3::Identity(),
+        std::make_shared<coal::Capsule>(0.06, 0.3))));
+  }
+  pin::SE3 table_placement = pin::SE3::Identity();
+  table_placement.translation() << 0.4, 0.2, table_height - 0.05;
+  obstacles.push_back(geom_model.addGeometryObject(
+      pin::GeometryObject("table", 0, 0, table_placement,
+                          std::make_shared<coal::Box>(1.2, 0.8, 0.1))));
+  for (int k = 0; k < 3; k++) {
+    pin::SE3 placement = pin::SE3::Identity();
+    placement.translation() << 0.2 + 0.2 * k, -0.1 + 0.3 * k,
+        table_height + 0.08;
+    obstacles.push_back(geom_model.addGeometryObject(pin::GeometryObject(
+        "sphere_" + std::to_string(k), 0, 0, placement,
+        std::make_shared<coal::Sphere>(0.08))));
+  }
+  for (const auto link : links)
+    for (const auto obstacle : obstacles)
+      geom_model.addCollisionPair(pin::CollisionPair(link, obstacle));
+  return geom_model;
+}
+
+/// Configurations visited by a solver: small moves around a reference.
+std::vector<VectorXd> make_configurations(const pin::Model &model) {
+  std::vector<VectorXd> qs;
+  VectorXd q = pin::neutral(model);
+  q[1] = -1.;
+  q[2] = 1.;
+  for (int i = 0; i < 16; i++) {
+    q += 0.02 * VectorXd::Random(model.nv);
+    qs.push_back(q);
+  }
+  return qs;
+}
+
+/// One FrameCollisionResidual per pair, sharing the stage's kinematics cache.
+static void BM_ur5_table_single_pairs(benchmark::State &state) {
+  const pin::Model model = make_ur5();
+  const pin::GeometryModel geom_model = make_scene(model);
+  const int ndx = 2 * model.nv;
+  std::vector<FrameCollision> funs;
+  std::vector<shared_ptr<StageFunctionData>> datas;
+  {
+    SharedDataScope scope;
+    for (pin::PairIndex k = 0; k < geom_model.collisionPairs.size(); k++) {
+      funs.emplace_back(ndx, model.nv, model, geom_model, k);
+      datas.push_back(funs.back().createData());
+    }
+  }
+  const std::vector<VectorXd> qs = make_configurations(model);
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    const VectorXd &q = qs[i++ % qs.size()];
+    for (std::size_t k = 0; k < funs.size(); k++) {
+      funs[k].evaluate(q, *datas[k]);
+      funs[k].computeJacobians(q, *datas[k]);
+    }
+  }
+  state.counters["pairs"] = double(funs.size());
+}
+
+/// A single MultiFrameCollisionResidual; the argument is the broadphase
+/// distance in centimeters (negative: no culling).
+static void BM_ur5_table_multi_pair(benchmark::State &state) {
+  const pin::Model model = make_ur5();
+  const pin::GeometryModel geom_model = make_scene(model);
+  const int ndx = 2 * model.nv;
+  const T broadphase_distance = state.range(0) < 0
+                                    ? std::numeric_limits<T>::infinity()
+                                    : T(state.range(0)) * 1e-2;
+  const MultiFrameCollision fun(ndx, model.nv, model, geom_model, {},
+                                broadphase_distance);
+  auto data = fun.createData();
+  auto &d = static_cast<MultiFrameCollisionDataTpl<T> &>(*data);
+  const std::vector<VectorXd> qs = make_configurations(model);
+
+  std::size_t i = 0;
+  double num_active = 0.;
+  for (auto _ : state) {
+    const VectorXd &q = qs[i++ % qs.size()];
+    fun.evaluate(q, *data);
+    fun.computeJacobians(q, *data);
+    num_active += double(
+        std::count(d.active_pairs_.begin(), d.active_pairs_.end(), true));
+  }
+  state.counters["pairs"] = double(fun.numPairs());
+  state.counters["narrowphase"] =
+      benchmark::Counter(num_active, benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_ur5_table_single_pairs)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ur5_table_multi_pair)
+    ->Arg(-1)
+    ->Arg(20)
+    ->Arg(5)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
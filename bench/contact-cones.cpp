@@ -0,0 +1,135 @@
+/// @file
+/// @brief Friction cones of a multi-contact centroidal problem: one constraint
+/// per contact, or a single multi-contact constraint per stage.
+
+#include "aligator/core/traj-opt-problem.hpp"
+#include "aligator/core/vector-space.hpp"
+#include "aligator/solvers/proxddp/solver-proxddp.hpp"
+#include "aligator/modelling/costs/quad-state-cost.hpp"
+#include "aligator/modelling/costs/sum-of-costs.hpp"
+#include "aligator/modelling/constraints/negative-orthant.hpp"
+#include "aligator/modelling/linear-discrete-dynamics.hpp"
+#include "aligator/modelling/centroidal/centroidal-friction-cone.hpp"
+#include "aligator/modelling/centroidal/multi-contact-friction-cone.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+
+using namespace aligator;
+
+using T = double;
+using StageModel = StageModelTpl<T>;
+using StageData = StageDataTpl<T>;
+using TrajOptProblem = TrajOptProblemTpl<T>;
+using VectorSpace = VectorSpaceTpl<T>;
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+constexpr int NX = 9;
+constexpr T mass = 10.;
+constexpr T dt = 0.01;
+constexpr T mu = 0.7;
+
+/// Centroidal model with state \f$(c, \dot{c}, L)\f$, discretized around
+/// contacts at fixed positions, and the friction cones of all the contacts.
+TrajOptProblem define_problem(const std::size_t nsteps, const int nc,
+                              const bool multi_contact) {
+  const int nu = 3 * nc;
+  const VectorSpace space(NX);
+  MatrixXd A = MatrixXd::Identity(NX, NX);
+  A.block<3, 3>(0, 3).setIdentity() *= dt;
+  MatrixXd B = MatrixXd::Zero(NX, nu);
+  for (int k = 0; k < nc; k++) {
+    // contacts on an ellipse around the center of mass
+    const T theta = 2 * M_PI * k / nc;
+    const Vector3d p(0.3 * std::cos(theta), 0.2 * std::sin(theta), -0.5);
+    B.block<3, 3>(3, 3 * k).setIdentity() *= dt / mass;
+    B.block<3, 3>(6, 3 * k) << 0, -p.z(), p.y(), p.z(), 0, -p.x(), -p.y(),
+        p.x(), 0;
+    B.block<3, 3>(6, 3 * k) *= dt;
+  }
+  VectorXd c = VectorXd::Zero(NX);
+  c[5] = -9.81 * dt;
+  const dynamics::LinearDiscreteDynamicsTpl<T> dyn(A, B, c);
+
+  VectorXd u0 = VectorXd::Zero(nu);
+  for (int k = 0; k < nc; k++)
+    u0[3 * k + 2] = mass * 9.81 / nc;
+  CostStackTpl<T> cost(space, nu);
+  cost.addCost("x", QuadraticStateCostTpl<T>(space, nu, VectorXd::Zero(NX),
+                                             MatrixXd::Identity(NX, NX)));
+  cost.addCost("u", QuadraticControlCostTpl<T>(
+                        space, u0, 1e-3 * MatrixXd::Identity(nu, nu)));
+
+  StageModel stage(cost, dyn);
+  if (multi_contact) {
+    std::vector<int> contacts(static_cast<std::size_t>(nc));
+    std::iota(contacts.begin(), contacts.end(), 0);
+    stage.addConstraint(
+        MultiContactFrictionConeResidualTpl<T>(NX, nu, contacts, mu, 1e-3),
+        NegativeOrthantTpl<T>());
+  } else {
+    for (int k = 0; k < nc; k++)
+      stage.addConstraint(
+          CentroidalFrictionConeResidualTpl<T>(NX, nu, k, mu, 1e-3),
+          NegativeOrthantTpl<T>());
+  }
+
+  VectorXd x0 = VectorXd::Zero(NX);
+  x0.head<3>() << 0.1, -0.05, 0.02;
+  const QuadraticStateCostTpl<T> term_cost(space, nu, VectorXd::Zero(NX),
+                                           MatrixXd::Identity(NX, NX));
+  TrajOptProblem problem(x0, nu, space, term_cost);
+  for (std::size_t i = 0; i < nsteps; i++)
+    problem.addStage(stage);
+  return problem;
+}
+
+/// Evaluation and first-order derivatives of a single stage.
+static void BM_stage_derivatives(benchmark::State &state) {
+  const int nc = int(state.range(0));
+  const bool multi_contact = state.range(1);
+  const TrajOptProblem problem = define_problem(1, nc, multi_contact);
+  const StageModel &stage = *problem.stages_[0];
+  shared_ptr<StageData> data = stage.createData();
+  const VectorXd x = VectorXd::Random(NX);
+  const VectorXd u = VectorXd::Random(stage.nu());
+
+  for (auto _ : state) {
+    stage.evaluate(x, u, *data);
+    stage.computeFirstOrderDerivatives(x, u, *data);
+  }
+}
+
+static void BM_solve(benchmark::State &state) {
+  const int nc = int(state.range(0));
+  const bool multi_contact = state.range(1);
+  const TrajOptProblem problem = define_problem(100, nc, multi_contact);
+  SolverProxDDPTpl<T> solver(1e-6, 1e-2, 10);
+  solver.setup(problem);
+
+  for (auto _ : state) {
+    solver.run(problem);
+  }
+  state.counters["iters"] = double(solver.results_.num_iters);
+}
+
+int main(int argc, char **argv) {
+  benchmark::RegisterBenchmark("stage_derivatives", &BM_stage_derivatives)
+      ->ArgNames({"contacts", "multi"})
+      ->ArgsProduct({{4, 8}, {0, 1}})
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("solve", &BM_solve)
+      ->ArgNames({"contacts", "multi"})
+      ->ArgsProduct({{4, 8}, {0, 1}})
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,106 @@
+/// @file
+/// @brief Cost stack of a humanoid stage, with and without the stacked
+/// Gauss-Newton Hessians of the residual costs.
+
+#include "aligator/core/stage-model.hpp"
+#include "aligator/core/stage-data.hpp"
+#include "aligator/modelling/costs/sum-of-costs.hpp"
+#include "aligator/modelling/costs/quad-residual-cost.hpp"
+#include "aligator/modelling/dynamics/multibody-free-fwd.hpp"
+#include "aligator/modelling/dynamics/integrator-semi-euler.hpp"
+#include "aligator/modelling/multibody/center-of-mass-translation.hpp"
+#include "aligator/modelling/multibody/frame-placement.hpp"
+#include "aligator/modelling/multibody/frame-translation.hpp"
+#include "aligator/modelling/multibody/frame-velocity.hpp"
+#include "aligator/modelling/spaces/multibody.hpp"
+#include "aligator/modelling/state-error.hpp"
+
+#include <pinocchio/multibody/sample-models.hpp>
+#include <pinocchio/algorithm/joint-configuration.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace pin = pinocchio;
+using namespace aligator;
+
+using T = double;
+using Space = MultibodyPhaseSpace<T>;
+using StageModel = StageModelTpl<T>;
+using StageData = StageDataTpl<T>;
+using CostStack = CostStackTpl<T>;
+using QuadraticResidualCost = QuadraticResidualCostTpl<T>;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+/// A stage with 13 residual costs on the legs, the center of mass, the state
+/// and the controls.
+StageModel define_stage(const pin::Model &model, const bool stacked) {
+  const Space space(model);
+  const int ndx = space.ndx();
+  const int nu = model.nv - 6;
+
+  CostStack costs(space, nu);
+  auto add = [&](const std::string &name, const auto &residual) {
+    const MatrixXd w = MatrixXd::Identity(residual.nr, residual.nr);
+    costs.addCost(name, QuadraticResidualCost(space, residual, w));
+  };
+  for (const std::string side : {"lleg", "rleg"}) {
+    const auto foot = model.getFrameId(side + "6_joint");
+    add(side + "_placement", FramePlacementResidualTpl<T>(
+                                 ndx, nu, model, pin::SE3::Random(), foot));
+    add(side + "_velocity",
+        FrameVelocityResidualTpl<T>(ndx, nu, model, pin::Motion::Zero(), foot,
+                                    pin::LOCAL_WORLD_ALIGNED));
+    for (const char *joint : {"3_joint", "4_joint", "5_joint"}) {
+      add(side + joint, FrameTranslationResidualTpl<T>(
+                            ndx, nu, model, Eigen::Vector3d::Random(),
+                            model.getFrameId(side + joint)));
+    }
+  }
+  add("com", CenterOfMassTranslationResidualTpl<T>(ndx, nu, model,
+                                                   Eigen::Vector3d::Zero()));
+  add("x_reg", StateErrorResidualTpl<T>(space, nu, space.neutral()));
+  add("u_reg", ControlErrorResidualTpl<T>(ndx, nu));
+  costs.stacked_gauss_newton = stacked;
+
+  MatrixXd actuation = MatrixXd::Zero(model.nv, nu);
+  actuation.bottomRows(nu).setIdentity();
+  dynamics::MultibodyFreeFwdDynamicsTpl<T> ode(space, actuation);
+  dynamics::IntegratorSemiImplEulerTpl<T> dyn(ode, 0.01);
+  return StageModel(costs, dyn);
+}
+
+static void BM_humanoid_cost_stack(benchmark::State &state) {
+  const bool stacked = state.range(0);
+  pin::Model model;
+  pin::buildModels::humanoidRandom(model, true);
+  const StageModel stage = define_stage(model, stacked);
+  shared_ptr<StageData> data = stage.createData();
+  const auto &cost = *stage.cost_;
+  auto &cost_data = *data->cost_data;
+
+  VectorXd x(model.nq + model.nv);
+  x << pin::randomConfiguration(model), VectorXd::Random(model.nv);
+  const VectorXd u = VectorXd::Random(stage.nu());
+  stage.evaluate(x, u, *data);
+  stage.computeFirstOrderDerivatives(x, u, *data);
+
+  for (auto _ : state) {
+    cost.computeHessians(x, u, cost_data);
+  }
+}
+
+int main(int argc, char **argv) {
+  benchmark::RegisterBenchmark("humanoid_cost_hessians",
+                               &BM_humanoid_cost_stack)
+      ->ArgName("stacked")
+      ->Args({0})
+      ->Args({1})
+      ->Unit(benchmark::kMicrosecond);
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+}
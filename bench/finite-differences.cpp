@@ -0,0 +1,91 @@
+/// @file
+/// @brief Jacobians of a chain of coupled elements: finite differences, dense
+/// or with the columns grouped by their sparsity pattern, on several threads;
+/// and forward-mode automatic differentiation.
+
+#include "aligator/modelling/autodiff/finite-difference.hpp"
+#include "aligator/modelling/autodiff/forward-mode.hpp"
+#include "aligator/core/vector-space.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace aligator;
+
+using T = double;
+using StageFunctionData = StageFunctionDataTpl<T>;
+using VectorSpace = VectorSpaceTpl<T>;
+using FiniteDifferenceHelper = autodiff::FiniteDifferenceHelper<T>;
+using Eigen::VectorXd;
+
+constexpr int NX = 60;
+constexpr int NU = 12;
+
+/// Each entry depends on its neighbours and on one control.
+struct Chain {
+  template <typename X, typename U, typename Out>
+  void operator()(const X &x, const U &u, Out &out) const {
+    using std::exp;
+    using std::sin;
+    using S = typename Out::Scalar;
+    for (int i = 0; i < NX; i++) {
+      const S prev = i > 0 ? S(sin(x[i - 1])) : S(0.);
+      const S next = i + 1 < NX ? S(sin(x[i + 1])) : S(0.);
+      out[i] = prev - 2. * sin(x[i]) + next + u[i % NU] * exp(-x[i] * x[i]);
+    }
+  }
+};
+
+static void BM_finite_difference(benchmark::State &state) {
+  const bool colored = state.range(0);
+  const auto num_threads = static_cast<std::size_t>(state.range(1));
+  FiniteDifferenceHelper fd(
+      VectorSpace(NX), autodiff::makeAutoDiffFunction<T>(NX, NU, NX, Chain()),
+      1e-7);
+  const VectorXd x = VectorXd::Random(NX);
+  const VectorXd u = VectorXd::Random(NU);
+  if (colored)
+    fd.setSparsityPattern(fd.computeSparsityPattern(x, u));
+  fd.setNumThreads(num_threads);
+  shared_ptr<StageFunctionData> data = fd.createData();
+  fd.evaluate(x, u, *data);
+
+  for (auto _ : state) {
+    fd.computeJacobians(x, u, *data);
+  }
+  state.counters["evaluations"] = double(fd.numColors());
+}
+
+template <int ChunkSize>
+static void BM_forward_mode(benchmark::State &state) {
+  const auto func =
+      autodiff::makeAutoDiffFunction<T, ChunkSize>(NX, NU, NX, Chain());
+  const VectorXd x = VectorXd::Random(NX);
+  const VectorXd u = VectorXd::Random(NU);
+  shared_ptr<StageFunctionData> data = func.createData();
+  func.evaluate(x, u, *data);
+
+  for (auto _ : state) {
+    func.computeJacobians(x, u, *data);
+  }
+  state.counters["evaluations"] = double((NX + NU + ChunkSize - 1) / ChunkSize);
+}
+
+int main(int argc, char **argv) {
+  benchmark::RegisterBenchmark("finite_difference", &BM_finite_difference)
+      ->ArgNames({"colored", "threads"})
+      ->ArgsProduct({{0, 1}, {1, 4}})
+      ->Unit(benchmark::kMicrosecond)
+      ->UseRealTime();
+  benchmark::RegisterBenchmark("forward_mode/chunk:4", &BM_forward_mode<4>)
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("forward_mode/chunk:8", &BM_forward_mode<8>)
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("forward_mode/chunk:16", &BM_forward_mode<16>)
+      ->Unit(benchmark::kMicrosecond);
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,83 @@
+/// @file
+/// @brief Accuracy against cost of the explicit Runge-Kutta integrators, on the
+/// free dynamics of a manipulator.
+
+#include "aligator/modelling/dynamics/multibody-free-fwd.hpp"
+#include "aligator/modelling/dynamics/integrator-rk2.hpp"
+#include "aligator/modelling/dynamics/integrator-rk23.hpp"
+#include "aligator/modelling/dynamics/integrator-rk4.hpp"
+
+#include <pinocchio/multibody/sample-models.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace aligator;
+
+using T = double;
+using Space = MultibodyPhaseSpace<T>;
+using ODE = dynamics::MultibodyFreeFwdDynamicsTpl<T>;
+using Eigen::VectorXd;
+
+/// Duration of the rollouts (s).
+constexpr T duration = 1.;
+
+ODE make_ode() {
+  pinocchio::Model model;
+  pinocchio::buildModels::manipulator(model);
+  return ODE(Space(model));
+}
+
+/// Rollout from @p x0 with constant controls, in @p nsteps steps.
+template <template <typename> class Integrator>
+VectorXd rollout(const ODE &ode, const long nsteps, const VectorXd &x0,
+                 const VectorXd &u) {
+  const Integrator<T> dyn(ode, duration / T(nsteps));
+  auto data = dyn.createData();
+  VectorXd x = x0;
+  for (long i = 0; i < nsteps; i++) {
+    dyn.forward(x, u, *data);
+    x = data->xnext_;
+  }
+  return x;
+}
+
+/// Rollout with the derivatives of each step, as in a solver iteration. The
+/// error of the final state, against a rollout with many RK4 steps, is
+/// reported in the `error` counter.
+template <template <typename> class Integrator>
+static void BM_rollout(benchmark::State &state) {
+  const long nsteps = state.range(0);
+  const ODE ode = make_ode();
+  const Space &space = ode.space();
+  const long nv = space.getModel().nv;
+  VectorXd x0 = space.neutral();
+  x0.tail(nv).setConstant(0.5);
+  const VectorXd u = VectorXd::Zero(ode.nu());
+
+  const Integrator<T> dyn(ode, duration / T(nsteps));
+  auto data = dyn.createData();
+  std::vector<VectorXd> xs(std::size_t(nsteps) + 1, x0);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < std::size_t(nsteps); i++) {
+      dyn.forward(xs[i], u, *data);
+      dyn.dForward(xs[i], u, *data);
+      xs[i + 1] = data->xnext_;
+    }
+  }
+
+  const VectorXd xref =
+      rollout<dynamics::IntegratorRK4Tpl>(ode, 1 << 14, x0, u);
+  state.counters["error"] = space.difference(xref, xs.back()).norm();
+}
+
+static void CustomArgs(benchmark::Benchmark *bench) {
+  bench->ArgName("nsteps")->Unit(benchmark::kMicrosecond);
+  for (long nsteps = 25; nsteps <= 400; nsteps *= 2)
+    bench->Arg(nsteps);
+}
+
+BENCHMARK(BM_rollout<dynamics::IntegratorRK2Tpl>)->Apply(CustomArgs);
+BENCHMARK(BM_rollout<dynamics::IntegratorRK23Tpl>)->Apply(CustomArgs);
+BENCHMARK(BM_rollout<dynamics::IntegratorRK4Tpl>)->Apply(CustomArgs);
+
+BENCHMARK_MAIN();
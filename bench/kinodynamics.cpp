@@ -0,0 +1,116 @@
+/// @file
+/// @brief Kinodynamics stage of the Solo quadruped (as in the
+/// solo_kinodynamics.py example), with a centroidal momentum cost sharing the
+/// Pinocchio computations of the dynamics.
+
+#include "aligator/core/stage-model.hpp"
+#include "aligator/core/stage-data.hpp"
+#include "aligator/modelling/costs/sum-of-costs.hpp"
+#include "aligator/modelling/costs/quad-residual-cost.hpp"
+#include "aligator/modelling/dynamics/kinodynamics-fwd.hpp"
+#include "aligator/modelling/dynamics/integrator-euler.hpp"
+#include "aligator/modelling/multibody/centroidal-momentum.hpp"
+#include "aligator/modelling/spaces/multibody.hpp"
+#include "aligator/modelling/state-error.hpp"
+
+#include <pinocchio/parsers/urdf.hpp>
+#include <pinocchio/parsers/srdf.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace pin = pinocchio;
+using namespace aligator;
+
+using T = double;
+using Space = MultibodyPhaseSpace<T>;
+using StageModel = StageModelTpl<T>;
+using StageData = StageDataTpl<T>;
+using CostStack = CostStackTpl<T>;
+using QuadraticResidualCost = QuadraticResidualCostTpl<T>;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr int force_size = 3;
+
+pin::Model make_solo(VectorXd &q0) {
+  const std::string urdf_path =
+      EXAMPLE_ROBOT_DATA_MODEL_DIR "/solo_description/robots/solo12.urdf";
+  const std::string srdf_path =
+      EXAMPLE_ROBOT_DATA_MODEL_DIR "/solo_description/srdf/solo.srdf";
+  pin::Model model;
+  pin::urdf::buildModel(urdf_path, pin::JointModelFreeFlyer(), model);
+  pin::srdf::loadReferenceConfigurations(model, srdf_path, false);
+  q0 = model.referenceConfigurations["straight_standing"];
+  return model;
+}
+
+/// Stage with the four feet in contact, and costs on the centroidal momentum,
+/// the state and the controls.
+StageModel define_stage(const pin::Model &model) {
+  const Space space(model);
+  const int ndx = space.ndx();
+  std::vector<pin::FrameIndex> feet_ids;
+  for (const char *foot : {"FL_FOOT", "FR_FOOT", "HL_FOOT", "HR_FOOT"})
+    feet_ids.push_back(model.getFrameId(foot));
+  const std::vector<bool> contact_states(feet_ids.size(), true);
+  const int nu = model.nv - 6 + int(feet_ids.size()) * force_size;
+
+  CostStack costs(space, nu);
+  auto add = [&](const std::string &name, const auto &residual) {
+    const MatrixXd w = 1e-2 * MatrixXd::Identity(residual.nr, residual.nr);
+    costs.addCost(name, QuadraticResidualCost(space, residual, w));
+  };
+  add("centroidal_momentum", CentroidalMomentumResidualTpl<T>(
+                                 ndx, nu, model, Eigen::Vector<T, 6>::Zero()));
+  add("x_reg", StateErrorResidualTpl<T>(space, nu, space.neutral()));
+  add("u_reg", ControlErrorResidualTpl<T>(ndx, nu));
+
+  dynamics::KinodynamicsFwdDynamicsTpl<T> ode(space, model,
+                                              Eigen::Vector3d(0., 0., -9.81),
+                                              contact_states, feet_ids,
+                                              force_size);
+  dynamics::IntegratorEulerTpl<T> dyn(ode, 20e-3);
+  return StageModel(costs, dyn);
+}
+
+/// Dynamics alone: forward pass and derivatives.
+static void BM_solo_kinodynamics(benchmark::State &state) {
+  VectorXd q0;
+  const pin::Model model = make_solo(q0);
+  const StageModel stage = define_stage(model);
+  const auto &dyn = *stage.dynamics_;
+  shared_ptr<StageData> data = stage.createData();
+  auto &dyn_data = *data->dynamics_data;
+
+  VectorXd x(model.nq + model.nv);
+  x << q0, VectorXd::Random(model.nv);
+  const VectorXd u = VectorXd::Random(stage.nu());
+
+  for (auto _ : state) {
+    dyn.evaluate(x, u, x, dyn_data);
+    dyn.computeJacobians(x, u, x, dyn_data);
+  }
+}
+
+/// Whole stage, where the cost reuses the Pinocchio computations of the
+/// dynamics through the stage's kinematics cache.
+static void BM_solo_kinodynamics_stage(benchmark::State &state) {
+  VectorXd q0;
+  const pin::Model model = make_solo(q0);
+  const StageModel stage = define_stage(model);
+  shared_ptr<StageData> data = stage.createData();
+
+  VectorXd x(model.nq + model.nv);
+  x << q0, VectorXd::Random(model.nv);
+  const VectorXd u = VectorXd::Random(stage.nu());
+
+  for (auto _ : state) {
+    stage.evaluate(x, u, *data);
+    stage.computeFirstOrderDerivatives(x, u, *data);
+  }
+}
+
+BENCHMARK(BM_solo_kinodynamics)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_solo_kinodynamics_stage)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -6,6 +6,8 @@
 #include "aligator/solvers/fddp/solver-fddp.hpp"
 #include "aligator/utils/rollout.hpp"
 #include "aligator/modelling/costs/quad-costs.hpp"
+#include "aligator/modelling/costs/quad-state-cost.hpp"
+#include "aligator/modelling/costs/sum-of-costs.hpp"
 #include "aligator/modelling/linear-discrete-dynamics.hpp"
 
 #include <benchmark/benchmark.h>
@@ -22,8 +24,11 @@ using Eigen::VectorXd;
 
 const std::size_t max_iters = 2;
 
-TrajOptProblem define_problem(const std::size_t nsteps, const int dim = 56,
-                              const int nu = 22) {
+/// With @p residual_costs, the stage costs are residual costs on the state and
+/// controls, whose Gauss-Newton Hessians are constant.
+TrajOptProblem define_problem(const std::size_t nsteps,
+                              const bool residual_costs = false,
+                              const int dim = 56, const int nu = 22) {
   MatrixXd A(dim, dim);
   MatrixXd B(dim, nu);
   VectorXd c_(dim);
@@ -43,8 +48,15 @@ TrajOptProblem define_problem(const std::size_t nsteps, const int dim = 56,
   auto space = dynptr.space_next_;
 
   auto rcost = QuadCost(w_x, w_u);
-  auto stage = StageModel(rcost, dynptr);
   auto term_cost = rcost;
+  auto stage = StageModel(rcost, dynptr);
+  if (residual_costs) {
+    CostStackTpl<T> costs(space, nu);
+    costs.addCost("x", QuadraticStateCostTpl<T>(space, nu,
+                                                VectorXd::Zero(dim), w_x));
+    costs.addCost("u", QuadraticControlCostTpl<T>(space, nu, w_u));
+    stage = StageModel(costs, dynptr);
+  }
 
   VectorXd x0(dim);
   x0.setRandom();
@@ -56,18 +68,18 @@ TrajOptProblem define_problem(const std::size_t nsteps, const int dim = 56,
   return problem;
 }
 
-#define SETUP_PROBLEM_VARS(nsteps)                                             \
-  auto problem = define_problem(nsteps);                                       \
+#define SETUP_PROBLEM_VARS(nsteps, residual_costs)                             \
+  auto problem = define_problem(nsteps, residual_costs);                       \
   const auto &dynamics = *problem.stages_[0]->dynamics_;                       \
   const VectorXd &x0 = problem.getInitState();                                 \
   std::vector<VectorXd> us_init;                                               \
   us_default_init(problem, us_init);                                           \
   std::vector<VectorXd> xs_init = rollout(dynamics, x0, us_init)
 
-template <LQSolverChoice lqsc>
+template <LQSolverChoice lqsc, bool residual_costs = false>
 static void BM_lqr_prox(benchmark::State &state) {
   const auto nsteps = static_cast<std::size_t>(state.range(0));
-  SETUP_PROBLEM_VARS(nsteps);
+  SETUP_PROBLEM_VARS(nsteps, residual_costs);
   const T mu_init = 1e-10;
   const auto num_threads = static_cast<std::size_t>(state.range(1));
   SolverProxDDPTpl<T> solver(TOL, mu_init, max_iters, verbose);
@@ -87,7 +99,7 @@ static void BM_lqr_prox(benchmark::State &state) {
 
 static void BM_lqr_fddp(benchmark::State &state) {
   const auto nsteps = static_cast<std::size_t>(state.range(0));
-  SETUP_PROBLEM_VARS(nsteps);
+  SETUP_PROBLEM_VARS(nsteps, false);
   SolverFDDPTpl<T> fddp(TOL, verbose);
   fddp.max_iters = max_iters;
   fddp.setup(problem);
@@ -128,6 +140,10 @@ int main(int argc, char **argv) {
                                &BM_lqr_prox<LQSolverChoice::SERIAL>)
       ->Apply(BaseArgs)
       ->Apply(ArgsSerial);
+  benchmark::RegisterBenchmark("ALIGATOR_SERIAL_RESIDUAL_COSTS",
+                               &BM_lqr_prox<LQSolverChoice::SERIAL, true>)
+      ->Apply(BaseArgs)
+      ->Apply(ArgsSerial);
   benchmark::RegisterBenchmark("ALIGATOR_PARALLEL",
                                &BM_lqr_prox<LQSolverChoice::PARALLEL>)
       ->Apply(BaseArgs)
@@ -0,0 +1,142 @@
+/// @file
+/// @brief Stages with many small residuals, each depending on either the state
+/// or the control only. Compares the assembly with and without the Jacobian
+/// patterns of the residuals, and with the stacked Gauss-Newton Hessian of the
+/// cost stack.
+
+#include "aligator/core/traj-opt-problem.hpp"
+#include "aligator/core/vector-space.hpp"
+#include "aligator/solvers/proxddp/solver-proxddp.hpp"
+#include "aligator/modelling/costs/quad-residual-cost.hpp"
+#include "aligator/modelling/costs/sum-of-costs.hpp"
+#include "aligator/modelling/constraints/box-constraint.hpp"
+#include "aligator/modelling/linear-discrete-dynamics.hpp"
+#include "aligator/modelling/state-error.hpp"
+#include "aligator/modelling/function-xpr-slice.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+
+using namespace aligator;
+
+using T = double;
+using StageModel = StageModelTpl<T>;
+using StageData = StageDataTpl<T>;
+using TrajOptProblem = TrajOptProblemTpl<T>;
+using VectorSpace = VectorSpaceTpl<T>;
+using StateError = StateErrorResidualTpl<T>;
+using ControlError = ControlErrorResidualTpl<T>;
+using StateSlice = FunctionSliceXprTpl<T, UnaryFunctionTpl<T>>;
+using ControlSlice = FunctionSliceXprTpl<T, StageFunctionTpl<T>>;
+using QuadraticResidualCost = QuadraticResidualCostTpl<T>;
+using CostStack = CostStackTpl<T>;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr int nx = 64;
+constexpr int nu = 16;
+/// Rows of each state (resp. control) residual.
+constexpr int nrx = 4;
+constexpr int nru = 2;
+
+/// Use the patterns of the residuals, or declare them dense.
+template <typename Residual> Residual withPattern(Residual r, bool sparse) {
+  if (!sparse)
+    r.jac_pattern = JacobianPattern(r.ndx1, r.nu);
+  return r;
+}
+
+TrajOptProblem define_problem(const std::size_t nsteps, const bool sparse,
+                              const bool stacked = false) {
+  const VectorSpace space(nx);
+  MatrixXd A = MatrixXd::Identity(nx, nx);
+  A.topRightCorner(nx / 2, nx / 2).setIdentity() *= 0.01;
+  MatrixXd B = MatrixXd::Zero(nx, nu);
+  B.bottomRows(nu).setIdentity() *= 0.01;
+  const dynamics::LinearDiscreteDynamicsTpl<T> dyn(A, B, VectorXd::Zero(nx));
+
+  // one residual per group of rows of the state and control errors
+  const StateError xerr(space, nu, VectorXd::Random(nx));
+  const ControlError uerr(nx, VectorXd::Random(nu));
+  auto rows = [](const int begin, const int size) {
+    std::vector<int> idx(size);
+    std::iota(idx.begin(), idx.end(), begin);
+    return idx;
+  };
+  CostStack cost(space, nu);
+  for (int k = 0; k < nx / nrx; k++) {
+    const StateSlice xres(xerr, rows(k * nrx, nrx));
+    cost.addCost("x" + std::to_string(k),
+                 QuadraticResidualCost(space, withPattern(xres, sparse),
+                                       MatrixXd::Identity(nrx, nrx)));
+  }
+  for (int k = 0; k < nu / nru; k++) {
+    const ControlSlice ures(uerr, rows(k * nru, nru));
+    cost.addCost("u" + std::to_string(k),
+                 QuadraticResidualCost(space, withPattern(ures, sparse),
+                                       1e-2 * MatrixXd::Identity(nru, nru)));
+  }
+
+  cost.stacked_gauss_newton = stacked;
+  StageModel stage(cost, dyn);
+  const VectorXd umax = VectorXd::Constant(nu, 1.);
+  stage.addConstraint(withPattern(ControlError(nx, nu), sparse),
+                      BoxConstraintTpl<T>(-umax, umax));
+
+  const QuadraticResidualCost term_cost(
+      space, StateError(space, nu, VectorXd::Zero(nx)),
+      MatrixXd::Identity(nx, nx));
+  TrajOptProblem problem(VectorXd::Random(nx), nu, space, term_cost);
+  for (std::size_t i = 0; i < nsteps; i++) {
+    problem.addStage(stage);
+  }
+  return problem;
+}
+
+/// Derivatives of a single stage.
+static void BM_stage_derivatives(benchmark::State &state) {
+  const bool sparse = state.range(0);
+  const bool stacked = state.range(1);
+  const TrajOptProblem problem = define_problem(1, sparse, stacked);
+  const StageModel &stage = *problem.stages_[0];
+  shared_ptr<StageData> data = stage.createData();
+  const VectorXd x = VectorXd::Random(nx);
+  const VectorXd u = VectorXd::Random(nu);
+
+  for (auto _ : state) {
+    stage.evaluate(x, u, *data);
+    stage.computeFirstOrderDerivatives(x, u, *data);
+    stage.computeSecondOrderDerivatives(x, u, *data);
+  }
+}
+
+static void BM_solve(benchmark::State &state) {
+  const auto nsteps = static_cast<std::size_t>(state.range(0));
+  const bool sparse = state.range(1);
+  const TrajOptProblem problem = define_problem(nsteps, sparse);
+  SolverProxDDPTpl<T> solver(1e-6, 1e-2, 10);
+  solver.setup(problem);
+
+  for (auto _ : state) {
+    solver.run(problem);
+  }
+}
+
+int main(int argc, char **argv) {
+  benchmark::RegisterBenchmark("stage_derivatives", &BM_stage_derivatives)
+      ->ArgNames({"sparse", "stacked"})
+      ->ArgsProduct({{0, 1}, {0, 1}})
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("solve", &BM_solve)
+      ->ArgNames({"nsteps", "sparse"})
+      ->ArgsProduct({{20, 50}, {0, 1}})
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -34,6 +34,22 @@ static void bench_parallel(benchmark::State &state) {
   }
 }
 
+static void bench_speculative(benchmark::State &state) {
+  std::size_t nsteps = static_cast<std::size_t>(state.range(0));
+  std::size_t num_lanes = static_cast<std::size_t>(state.range(1));
+  const auto prob = create_se2_problem(nsteps);
+  const T mu_init = 1e-3;
+  SolverProxDDPTpl<T> solver(1e-3, mu_init);
+  solver.max_iters = 4;
+  solver.ls_params.interp_type = LSInterpolation::BISECTION;
+  solver.speculative_ls_lanes = num_lanes;
+  solver.setup(prob);
+
+  for (auto _ : state) {
+    solver.run(prob);
+  }
+}
+
 constexpr auto timeUnit = benchmark::kMillisecond;
 constexpr auto maxThreads = 12l;
 
@@ -54,9 +70,19 @@ static void ParallelArgs(benchmark::Benchmark *bench) {
     }
 }
 
+static void SpeculativeArgs(benchmark::Benchmark *bench) {
+  bench->Unit(timeUnit)->UseRealTime();
+  bench->ArgNames({"nsteps", "nlanes"});
+  for (long nl = 1; nl <= 4; nl++)
+    for (long e = 2; e <= 10; e += 4) {
+      bench->Args({20 * e, nl});
+    }
+}
+
 BENCHMARK(bench_serial)->Apply(CustomArgs);
 #ifdef ALIGATOR_MULTITHREADING
 BENCHMARK(bench_parallel)->Apply(ParallelArgs);
+BENCHMARK(bench_speculative)->Apply(SpeculativeArgs);
 #endif
 
 BENCHMARK_MAIN();
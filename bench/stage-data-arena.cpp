@@ -0,0 +1,84 @@
+/// @file
+/// @brief Creation and evaluation of the datas of a 200-stage problem, with
+/// the buffers of each stage allocated from the heap or from a per-stage
+/// arena.
+
+#include "aligator/core/traj-opt-problem.hpp"
+#include "aligator/core/traj-opt-data.hpp"
+#include "aligator/modelling/costs/quad-costs.hpp"
+#include "aligator/modelling/costs/quad-state-cost.hpp"
+#include "aligator/modelling/costs/sum-of-costs.hpp"
+#include "aligator/modelling/constraints/box-constraint.hpp"
+#include "aligator/modelling/linear-discrete-dynamics.hpp"
+#include "aligator/modelling/state-error.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace aligator;
+
+using T = double;
+using StageModel = StageModelTpl<T>;
+using TrajOptProblem = TrajOptProblemTpl<T>;
+using TrajOptData = TrajOptDataTpl<T>;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr std::size_t nsteps = 200;
+constexpr int dim = 12;
+constexpr int nu = 4;
+
+/// Linear dynamics, residual costs on the state and controls, and bounds on
+/// the controls.
+TrajOptProblem define_problem(const bool use_data_arena) {
+  const MatrixXd A =
+      MatrixXd::Identity(dim, dim) + 0.01 * MatrixXd::Ones(dim, dim);
+  const MatrixXd B = MatrixXd::Identity(dim, nu);
+  const VectorXd c = VectorXd::Zero(dim);
+  const dynamics::LinearDiscreteDynamicsTpl<T> dyn(A, B, c);
+  const auto &space = dyn.space_next_;
+
+  CostStackTpl<T> costs(space, nu);
+  costs.addCost("x", QuadraticStateCostTpl<T>(space, nu, VectorXd::Zero(dim),
+                                              MatrixXd::Identity(dim, dim)));
+  costs.addCost("u", QuadraticControlCostTpl<T>(
+                         space, nu, 1e-2 * MatrixXd::Identity(nu, nu)));
+  StageModel stage(costs, dyn);
+  stage.addConstraint(ControlErrorResidualTpl<T>(dim, nu),
+                      BoxConstraintTpl<T>(-VectorXd::Ones(nu),
+                                          VectorXd::Ones(nu)));
+  stage.use_data_arena_ = use_data_arena;
+
+  TrajOptProblem problem(VectorXd::Ones(dim), nu, space, costs);
+  for (std::size_t i = 0; i < nsteps; i++)
+    problem.addStage(stage);
+  return problem;
+}
+
+template <bool use_data_arena>
+static void BM_data_creation(benchmark::State &state) {
+  const TrajOptProblem problem = define_problem(use_data_arena);
+  for (auto _ : state) {
+    TrajOptData data(problem);
+    benchmark::DoNotOptimize(data.stage_data.back());
+  }
+}
+
+/// Evaluation and derivatives, sweeping over the stage datas.
+template <bool use_data_arena>
+static void BM_evaluate(benchmark::State &state) {
+  const TrajOptProblem problem = define_problem(use_data_arena);
+  TrajOptData data(problem);
+  const std::vector<VectorXd> xs(nsteps + 1, VectorXd::Random(dim));
+  const std::vector<VectorXd> us(nsteps, VectorXd::Random(nu));
+  for (auto _ : state) {
+    problem.evaluate(xs, us, data);
+    problem.computeDerivatives(xs, us, data);
+  }
+}
+
+BENCHMARK(BM_data_creation<false>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_data_creation<true>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_evaluate<false>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_evaluate<true>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -8,8 +8,13 @@
 #include "talos-walk-utils.hpp"
 
 #include "aligator/core/traj-opt-problem.hpp"
+#include "aligator/core/shared-data-scope.hpp"
 #include "aligator/solvers/fddp/solver-fddp.hpp"
 #include "aligator/solvers/proxddp/solver-proxddp.hpp"
+#include "aligator/modelling/costs/quad-residual-cost.hpp"
+#include "aligator/modelling/multibody/center-of-mass-translation.hpp"
+#include "aligator/modelling/multibody/fly-high.hpp"
+#include "aligator/modelling/multibody/frame-translation.hpp"
 
 using aligator::SolverFDDPTpl;
 using aligator::SolverProxDDPTpl;
@@ -85,6 +90,74 @@ static void BM_FDDP(benchmark::State &state) {
   state.SetComplexityN(state.range(0));
 }
 
+/// @brief Construct the locomotion problem. Copies of the stages share the
+/// Pinocchio model instead of copying it.
+static void BM_define_problem(benchmark::State &state) {
+  const std::size_t T_ss = (std::size_t)state.range(0);
+  const std::size_t T_ds = T_ss / 4;
+  for (auto _ : state) {
+    TrajOptProblem problem = defineLocomotionProblem(T_ss, T_ds);
+    benchmark::DoNotOptimize(problem);
+  }
+}
+
+/// @brief Evaluate a Talos stage with eight multibody cost terms, sharing the
+/// stage's kinematics cache between the terms or giving each term its own.
+template <bool shared_kinematics>
+static void BM_stage_kinematics(benchmark::State &state) {
+  Model model;
+  Eigen::VectorXd q0;
+  {
+    Model model_complete;
+    makeTalosReduced(model_complete, model, q0);
+  }
+  MultibodyPhaseSpace space(model);
+  const int ndx = space.ndx();
+  const int nu = model.nv - 6;
+  const pin::FrameIndex feet[2] = {model.getFrameId("left_sole_link"),
+                                   model.getFrameId("right_sole_link")};
+
+  // the residuals share the model of the space, hence its kinematics cache
+  const auto handle = space.getModelHandle();
+
+  CostStack costs(space, nu);
+  auto add_cost = [&](const auto &fn) {
+    MatrixXd w = MatrixXd::Identity(fn.nr, fn.nr);
+    costs.addCost(QuadraticResidualCost(space, fn, w));
+  };
+  for (const auto fid : feet) {
+    add_cost(
+        FramePlacementResidual(ndx, nu, handle, pin::SE3::Identity(), fid));
+    add_cost(aligator::FrameTranslationResidualTpl<double>(
+        ndx, nu, handle, Eigen::Vector3d::Zero(), fid));
+    add_cost(FrameVelocityResidual(ndx, nu, handle, pin::Motion::Zero(), fid,
+                                   pin::LOCAL_WORLD_ALIGNED));
+  }
+  add_cost(aligator::CenterOfMassTranslationResidualTpl<double>(
+      ndx, nu, handle, Eigen::Vector3d::Zero()));
+  add_cost(aligator::FlyHighResidualTpl<double>(ndx, handle, feet[0], 1., nu));
+
+  std::shared_ptr<aligator::CostDataAbstractTpl<double>> sd;
+  if (shared_kinematics) {
+    // as done by StageDataTpl
+    aligator::SharedDataScope scope;
+    sd = costs.createData();
+  } else {
+    sd = costs.createData();
+  }
+
+  VectorXd x(model.nq + model.nv);
+  x << q0, VectorXd::Random(model.nv);
+  VectorXd u = VectorXd::Zero(nu);
+  for (auto _ : state) {
+    // perturb the state so that each iteration recomputes the kinematics
+    x[0] += 1e-6;
+    costs.evaluate(x, u, *sd);
+    costs.computeGradients(x, u, *sd);
+    benchmark::DoNotOptimize(sd->value_);
+  }
+}
+
 constexpr auto unit = benchmark::kMillisecond;
 
 static void BaseArgs(benchmark::Benchmark *bench) {
@@ -126,6 +199,16 @@ int main(int argc, char **argv) {
       ->Apply(BaseArgs)
       ->Apply(ArgsParallel);
 
+  benchmark::RegisterBenchmark("DEFINE_PROBLEM", &BM_define_problem)
+      ->Apply(BaseArgs)
+      ->Apply(ArgsSerial);
+  benchmark::RegisterBenchmark("STAGE_KINEMATICS_SHARED",
+                               &BM_stage_kinematics<true>)
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("STAGE_KINEMATICS_PER_TERM",
+                               &BM_stage_kinematics<false>)
+      ->Unit(benchmark::kMicrosecond);
+
   benchmark::Initialize(&argc, argv);
   if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
     return 1;
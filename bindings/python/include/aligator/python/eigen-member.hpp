@@ -16,16 +16,18 @@ namespace bp = boost::python;
 namespace internal {
 
 /// @brief Functor which wraps a pointer-to-data-member and will return an \ref
-/// Eigen::Ref when called.
+/// Eigen::Ref when called. The member can be a plain matrix or a map over one,
+/// e.g. an ArenaMatrix.
 /// @see   \ref boost/python/data_members.hpp (struct member)
 template <typename MatrixType, typename Class> struct eigen_member {
 public:
-  typedef Eigen::Ref<const MatrixType> ConstMatRef;
+  typedef typename MatrixType::PlainObject PlainObject;
+  typedef Eigen::Ref<const PlainObject> ConstMatRef;
 
   eigen_member(MatrixType Class::*which)
       : m_which(which) {}
 
-  Eigen::Ref<MatrixType> operator()(Class &c) const { return c.*m_which; }
+  Eigen::Ref<PlainObject> operator()(Class &c) const { return c.*m_which; }
 
   void operator()(Class &c,
                   typename bp::detail::value_arg<ConstMatRef>::type d) const {
@@ -44,7 +46,7 @@ private:
 /// ...))
 template <class C, class MatrixType>
 bp::object make_getter_eigen_matrix(MatrixType C::*v) {
-  typedef Eigen::Ref<MatrixType> RefType;
+  typedef Eigen::Ref<typename MatrixType::PlainObject> RefType;
   return bp::make_function(
       internal::eigen_member<MatrixType, C>(v),
       bp::return_value_policy<bp::return_by_value,
@@ -55,7 +57,7 @@ bp::object make_getter_eigen_matrix(MatrixType C::*v) {
 template <class C, class MatrixType, class Policies>
 bp::object make_setter_eigen_matrix(MatrixType C::*v,
                                     Policies const &policies) {
-  typedef Eigen::Ref<const MatrixType> ConstRefType;
+  typedef Eigen::Ref<const typename MatrixType::PlainObject> ConstRefType;
   return bp::make_function(
       internal::eigen_member<MatrixType, C>(v), policies,
       boost::mpl::vector3<void, C &, const ConstRefType>());
@@ -7,6 +7,7 @@
 
 namespace aligator {
 namespace python {
+using context::PinData;
 using context::RCDVector;
 using context::RCMVector;
 
@@ -19,5 +20,20 @@ struct FrameAPIVisitor : bp::def_visitor<FrameAPIVisitor<Class>> {
   }
 };
 
+/// Expose the Pinocchio data which a function data reads from its
+/// KinematicsCacheTpl.
+template <typename Data>
+struct PinDataVisitor : bp::def_visitor<PinDataVisitor<Data>> {
+
+  template <class PyClass> void visit(PyClass &cl) const {
+    cl.add_property(
+        "pin_data",
+        bp::make_function(
+            +[](const Data &d) -> const PinData & { return d.pin_data_; },
+            bp::return_internal_reference<>()),
+        "Pinocchio data struct.");
+  }
+};
+
 } // namespace python
 } // namespace aligator
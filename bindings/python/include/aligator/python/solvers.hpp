@@ -39,6 +39,9 @@ struct SolverVisitor : bp::def_visitor<SolverVisitor<SolverType>> {
         .def_readwrite("force_initial_condition",
                        &SolverType::force_initial_condition_,
                        "Set x0 to be fixed to the initial condition.")
+        .def_readwrite("time_limit", &SolverType::time_limit_,
+                       "Wall-clock budget of run() in seconds (non-positive: "
+                       "no limit).")
         .add_property("num_threads", &SolverType::getNumThreads)
         .def("setNumThreads", &SolverType::setNumThreads,
              ("self"_a, "num_threads"))
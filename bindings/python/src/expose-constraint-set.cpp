@@ -96,7 +96,10 @@ void exposeConstraintSets() {
       .add_property("blockSizes",
                     bp::make_function(&ConstraintSetProduct::blockSizes,
                                       bp::return_internal_reference<>()),
-                    "Dimensions of each component of the cartesian product.");
+                    "Dimensions of each component of the cartesian product.")
+      .add_property("isFlat", &ConstraintSetProduct::isFlat,
+                    "Whether all components are boxes, negative orthants or "
+                    "equality sets, projected by a single flat kernel.");
 
   StdVectorPythonVisitor<std::vector<PolySet>>::expose(
       "StdVec_ConstraintObject",
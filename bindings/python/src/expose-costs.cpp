@@ -2,6 +2,7 @@
 /// @copyright Copyright (C) 2022 LAAS-CNRS, INRIA
 #include "aligator/python/costs.hpp"
 #include "aligator/python/visitors.hpp"
+#include "aligator/python/eigen-member.hpp"
 
 #include "aligator/modelling/costs/quad-costs.hpp"
 #include "aligator/modelling/costs/constant-cost.hpp"
@@ -91,6 +92,8 @@ void exposeCostAbstract() {
       .def("computeHessians", bp::pure_virtual(&CostAbstract::computeHessians),
            bp::args("self", "x", "u", "data"),
            "Compute the cost function hessians.")
+      .def("hasConstantHessians", &CostAbstract::hasConstantHessians,
+           bp::args("self"), "Whether the Hessians do not depend on (x, u).")
       .def_readonly("space", &CostAbstract::space)
       .add_property("nx", &CostAbstract::nx)
       .add_property("ndx", &CostAbstract::ndx)
@@ -104,8 +107,10 @@ void exposeCostAbstract() {
       .def(bp::init<const int, const int>(bp::args("self", "ndx", "nu")))
       .def(bp::init<const CostAbstract &>(bp::args("self", "cost")))
       .def_readwrite("value", &CostData::value_)
-      .def_readwrite("grad", &CostData::grad_)
-      .def_readwrite("hess", &CostData::hess_)
+      .add_property("grad", make_getter_eigen_matrix(&CostData::grad_),
+                    make_setter_eigen_matrix(&CostData::grad_))
+      .add_property("hess", make_getter_eigen_matrix(&CostData::hess_),
+                    make_setter_eigen_matrix(&CostData::hess_))
       .add_property(
           "Lx", bp::make_getter(&CostData::Lx_,
                                 bp::return_value_policy<bp::return_by_value>()))
@@ -32,6 +32,18 @@ struct FunctionDataWrapper : StageFunctionData, bp::wrapper<StageFunctionData> {
 
 void exposeFunctionBase() {
   register_polymorphic_to_python<PolyFunction>();
+  bp::class_<JacobianPattern>(
+      "JacobianPattern",
+      "Ranges of the columns of the Jacobians which can be nonzero.",
+      bp::init<int, int>(("self"_a, "ndx", "nu")))
+      .def(bp::init<int, int, int, int>(
+          ("self"_a, "x_begin", "x_size", "u_begin", "u_size")))
+      .def_readwrite("x_begin", &JacobianPattern::x_begin)
+      .def_readwrite("x_size", &JacobianPattern::x_size)
+      .def_readwrite("u_begin", &JacobianPattern::u_begin)
+      .def_readwrite("u_size", &JacobianPattern::u_size)
+      .def("isDense", &JacobianPattern::isDense, ("self"_a, "ndx", "nu"));
+
   bp::class_<PyStageFunction<>, boost::noncopyable>(
       "StageFunction",
       "Base class for ternary functions f(x,u,x') on a stage of the problem.",
@@ -49,6 +61,10 @@ void exposeFunctionBase() {
       .def_readonly("ndx1", &StageFunction::ndx1, "Current state space.")
       .def_readonly("nu", &StageFunction::nu, "Control dimension.")
       .def_readonly("nr", &StageFunction::nr, "Function codimension.")
+      .def_readwrite("jac_pattern", &StageFunction::jac_pattern,
+                     "Columns of the Jacobians which can be nonzero.")
+      .def("hasConstantJacobians", &StageFunction::hasConstantJacobians,
+           "self"_a, "Whether the Jacobians do not depend on (x, u).")
       .def(SlicingVisitor<StageFunction>())
       .def(func_visitor)
       .def(CreateDataPolymorphicPythonVisitor<StageFunction,
@@ -8,6 +8,7 @@
 #include <eigenpy/std-vector.hpp>
 
 namespace aligator::python {
+using context::ConstMatrixRef;
 using context::ConstVectorRef;
 using context::Manifold;
 using context::MatrixRef;
@@ -35,6 +36,11 @@ void exposeManifolds() {
       "ManifoldAbstract", "Manifold abstract class.", bp::no_init)
       .add_property("nx", &Manifold::nx, "Manifold representation dimension.")
       .add_property("ndx", &Manifold::ndx, "Tangent space dimension.")
+      .add_property("nonEuclideanDim", &Manifold::nonEuclideanDim,
+                    "Number of leading tangent coordinates on which the "
+                    "manifold is not Euclidean.")
+      .add_property("isEuclidean", &Manifold::isEuclidean,
+                    "Whether the manifold is a vector space.")
       .def(
           "neutral", +[](const Manifold &m) { return m.neutral(); }, "self"_a,
           "Get the neutral point from the manifold (if a Lie group).")
@@ -93,6 +99,37 @@ void exposeManifolds() {
           },
           ("self"_a, "x0", "x1", "arg"),
           "Compute and return the Jacobian of the log.")
+      .def(
+          "integrateBatch",
+          +[](const Manifold &m, const ConstMatrixRef &xs,
+              const ConstMatrixRef &vs, Scalar alpha) {
+            MatrixXs out(m.nx(), xs.cols());
+            m.integrateBatch(xs, vs, alpha, out);
+            return out;
+          },
+          ("self"_a, "xs", "vs", "alpha"_a = 1.),
+          "Integrate the columns of xs along alpha times those of vs.")
+      .def(
+          "differenceBatch",
+          +[](const Manifold &m, const ConstMatrixRef &x0s,
+              const ConstMatrixRef &x1s) {
+            MatrixXs out(m.ndx(), x0s.cols());
+            m.differenceBatch(x0s, x1s, out);
+            return out;
+          },
+          ("self"_a, "x0s", "x1s"),
+          "Differences between the columns of x1s and x0s.")
+      .def(
+          "JdifferenceBatch",
+          +[](const Manifold &m, const ConstMatrixRef &x0s,
+              const ConstMatrixRef &x1s, int arg) {
+            MatrixXs Jout(m.ndx(), m.ndx() * x0s.cols());
+            m.JdifferenceBatch(x0s, x1s, Jout, arg);
+            return Jout;
+          },
+          ("self"_a, "x0s", "x1s", "arg"),
+          "Jacobians of the differences between the columns of x1s and x0s, "
+          "stacked horizontally.")
       .def("tangent_space", &Manifold::tangentSpace, bp::args("self"),
            "Returns an object representing the tangent space to this manifold.")
       .def(
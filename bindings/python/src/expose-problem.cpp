@@ -81,7 +81,21 @@ void exposeProblem() {
            ("self"_a, "model"),
            "Circularly replace the last stage in the problem, dropping the "
            "first stage.")
-      .def("checkIntegrity", &TrajOptProblem::checkIntegrity, ("self"_a));
+      .def("checkIntegrity", &TrajOptProblem::checkIntegrity, ("self"_a))
+      .def<StageParametersTpl<Scalar> &(TrajOptProblem::*)(std::size_t)>(
+          "getStageParameters", &TrajOptProblem::getStageParameters,
+          ("self"_a, "i"), bp::return_internal_reference<>(),
+          "Parameters of stage i.")
+      .def("setStageParameters", &TrajOptProblem::setStageParameters,
+           ("self"_a, "i", "values"),
+           "Overwrite the parameters of stage i with a flat vector.")
+      .def("setStageParameter", &TrajOptProblem::setStageParameter,
+           ("self"_a, "i", "name", "value"),
+           "Set a parameter slot of stage i.")
+      .def("registerParameters", &TrajOptProblem::registerParameters,
+           "self"_a,
+           "Declare the parameter slots read by the functions of every "
+           "stage.");
 
   bp::def("computeTrajectoryCost", computeTrajectoryCost<Scalar>,
           ("problem_data"_a),
@@ -150,9 +150,17 @@ void exposeProxDDP() {
           //       dynamics.")
           .def_readwrite("max_al_iters", &SolverType::max_al_iters,
                          "Maximum number of AL iterations.")
+          .def_readwrite("warm_start", &SolverType::warm_start_,
+                         "Warm-start run() from the ALM penalty, "
+                         "regularization, tolerances and iterate of the "
+                         "previous solve (for MPC).")
           .def_readwrite("ls_mode", &SolverType::ls_mode, "Linesearch mode.")
           .def_readwrite("sa_strategy", &SolverType::sa_strategy_,
                          "StepAcceptance strategy.")
+          .def_readwrite("speculative_ls_lanes",
+                         &SolverType::speculative_ls_lanes,
+                         "Number of step sizes evaluated concurrently during "
+                         "the linesearch (set before calling setup()).")
           .def_readwrite("rollout_type", &SolverType::rollout_type_,
                          "Rollout type.")
           .def_readwrite("dual_weight", &SolverType::dual_weight,
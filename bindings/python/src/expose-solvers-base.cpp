@@ -32,11 +32,38 @@ void exposeSolverCommon() {
            "Insert a StageData object and cycle the workspace left (using "
            "`cycleLeft()`) and insert the allocated data (useful for MPC).");
 
+  bp::class_<SolverStats>(
+      "SolverStats",
+      "Per-phase timings (in seconds) and counters of the last solver run.",
+      bp::no_init)
+      .def_readonly("evaluate", &SolverStats::evaluate)
+      .def_readonly("derivatives", &SolverStats::derivatives)
+      .def_readonly("multipliers", &SolverStats::multipliers)
+      .def_readonly("lq_assembly", &SolverStats::lq_assembly)
+      .def_readonly("backward", &SolverStats::backward)
+      .def_readonly("forward", &SolverStats::forward)
+      .def_readonly("linesearch", &SolverStats::linesearch,
+                    "Step acceptance, including all trial point evaluations.")
+      .def_readonly("num_merit_evals", &SolverStats::num_merit_evals)
+      .def_readonly("num_ls_lane_hits", &SolverStats::num_ls_lane_hits)
+      .def_readonly("num_ls_lane_evals", &SolverStats::num_ls_lane_evals)
+      .def_readonly("num_reg_increases", &SolverStats::num_reg_increases)
+      .def_readonly("bytes_allocated", &SolverStats::bytes_allocated)
+      .def("total", &SolverStats::total, "self"_a,
+           "Sum of the phase timings.");
+
   using ResultsBase = ResultsBaseTpl<Scalar>;
   bp::class_<ResultsBase>("ResultsBase", "Base results struct.", bp::no_init)
       .def_readonly("num_iters", &ResultsBase::num_iters,
                     "Number of solver iterations.")
       .def_readonly("conv", &ResultsBase::conv)
+      .def_readonly("timed_out", &ResultsBase::timed_out,
+                    "Whether the solver stopped because of its time limit.")
+      .def_readonly("gains_stale", &ResultsBase::gains_stale,
+                    "Whether the gains are from the last LQ solve, one iterate "
+                    "behind the returned one (time limit reached).")
+      .def_readonly("stats", &ResultsBase::stats,
+                    "Per-phase timings and counters of the last run.")
       .def_readonly("gains", &ResultsBase::gains_)
       .def_readonly("xs", &ResultsBase::xs)
       .def_readonly("us", &ResultsBase::us)
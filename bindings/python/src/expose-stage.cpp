@@ -28,6 +28,70 @@ void exposeStageData() {
       .def_readwrite("constraint_data", &StageData::constraint_data);
 }
 
+void exposeStageParameters() {
+  using context::ConstVectorRef;
+  using context::Scalar;
+  using context::VectorRef;
+  using StageParameters = StageParametersTpl<Scalar>;
+  // the returned arrays are views, which keep the parameters alive
+  using ViewPolicy =
+      bp::return_value_policy<bp::return_by_value,
+                              bp::with_custodian_and_ward_postcall<0, 1>>;
+
+  bp::class_<StageParameters>(
+      "StageParameters",
+      "Named parameters (targets, weights...) of a stage, stored contiguously "
+      "in a flat vector.",
+      bp::init<>("self"_a))
+      .def("addSlot", &StageParameters::addSlot, ("self"_a, "name", "value"),
+           "Add a slot, and return its index.")
+      .def("hasSlot", &StageParameters::hasSlot, ("self"_a, "name"))
+      .def("__contains__", &StageParameters::hasSlot, ("self"_a, "name"))
+      .def("__len__", &StageParameters::numSlots, "self"_a)
+      .def(
+          "offset",
+          +[](const StageParameters &self, const std::string &name) {
+            return self.slot(name).offset;
+          },
+          ("self"_a, "name"), "Offset of a slot in the flat vector.")
+      .add_property(
+          "slot_names",
+          +[](const StageParameters &self) {
+            bp::list names;
+            for (const auto &slot : self.slots())
+              names.append(slot.name);
+            return names;
+          },
+          "Names of the slots, in storage order.")
+      .add_property("size", &StageParameters::size,
+                    "Total number of parameters.")
+      .add_property(
+          "values",
+          bp::make_function(
+              +[](StageParameters &self) -> VectorRef { return self.values(); },
+              ViewPolicy()),
+          "View on the flat vector of parameters.")
+      .def(
+          "__getitem__",
+          +[](StageParameters &self, const std::string &name) -> VectorRef {
+            return self[name];
+          },
+          ViewPolicy(), ("self"_a, "name"), "View on the values of a slot.")
+      .def(
+          "__setitem__",
+          +[](StageParameters &self, const std::string &name,
+              const ConstVectorRef &value) {
+            VectorRef slot = self[name];
+            if (slot.size() != value.size())
+              ALIGATOR_RUNTIME_ERROR(
+                  "Wrong size for parameter '{}' (got {:d}, expected {:d})",
+                  name, value.size(), slot.size());
+            slot = value;
+          },
+          ("self"_a, "name", "value"))
+      .def(CopyableVisitor<StageParameters>());
+}
+
 void exposeStage() {
   using context::ConstraintSet;
   using context::Manifold;
@@ -79,6 +143,17 @@ void exposeStage() {
                     bp::make_getter(&StageModel::cost_,
                                     bp::return_internal_reference<>()),
                     "Stage cost.")
+      .add_property("parameters",
+                    bp::make_getter(&StageModel::parameters_,
+                                    bp::return_internal_reference<>()),
+                    "Parameters read by the functions of the stage.")
+      .def_readwrite("use_data_arena", &StageModel::use_data_arena_,
+                     "Allocate the buffers of the stage datas from a single "
+                     "arena per data.")
+      .def("dataArenaSizeHint", &StageModel::dataArenaSizeHint, "self"_a,
+           "Size in bytes of the buffers of the base function datas.")
+      .def("registerParameters", &StageModel::registerParameters, "self"_a,
+           "Declare the parameter slots read by the cost and constraints.")
       .def("evaluate", &StageModel::evaluate, ("self"_a, "x", "u", "data"),
            "Evaluate the stage cost, dynamics, constraints.")
       .def("computeFirstOrderDerivatives",
@@ -101,6 +176,7 @@ void exposeStage() {
       .def(PolymorphicVisitor<PolyStage>());
 #pragma GCC diagnostic pop
 
+  exposeStageParameters();
   exposeStageData();
 }
 
@@ -63,6 +63,7 @@ void exposeGAR() {
       .def_readonly("nc", &knot_t::nc)
       .def_readonly("nx2", &knot_t::nx2)
       .def_readonly("nth", &knot_t::nth)
+      .def_readonly("nca", &knot_t::nca, "Number of active constraint rows.")
       //
       .def_readwrite("Q", &knot_t::Q)
       .def_readwrite("S", &knot_t::S)
@@ -83,6 +84,14 @@ void exposeGAR() {
       .def_readwrite("Gu", &knot_t::Gu)
       .def_readwrite("gamma", &knot_t::gamma)
       //
+      .def(
+          "setActiveRows",
+          +[](knot_t &self, const Eigen::Matrix<bool, -1, 1> &active) {
+            self.setActiveRows(active);
+          },
+          ("self"_a, "active"))
+      .def("setAllRowsActive", &knot_t::setAllRowsActive, ("self"_a))
+      //
       .def("isApprox", &knot_t::isApprox,
            ("self"_a, "prec"_a = std::numeric_limits<Scalar>::epsilon()))
       //
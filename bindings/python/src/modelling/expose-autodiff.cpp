@@ -6,6 +6,43 @@
 namespace aligator {
 namespace python {
 
+/// Sparsity pattern methods shared by the finite difference helpers.
+template <typename FiniteDiffType>
+struct FiniteDifferenceSparsityVisitor
+    : bp::def_visitor<FiniteDifferenceSparsityVisitor<FiniteDiffType>> {
+  using Scalar = context::Scalar;
+  using MatrixXs = context::MatrixXs;
+  using ConstVectorRef = context::ConstVectorRef;
+
+  static void setSparsityPattern(FiniteDiffType &self,
+                                 const MatrixXs &pattern) {
+    self.setSparsityPattern((pattern.array() != 0.).matrix());
+  }
+
+  static MatrixXs computeSparsityPattern(const FiniteDiffType &self,
+                                         const ConstVectorRef &x,
+                                         const ConstVectorRef &u,
+                                         const Scalar tol) {
+    return self.computeSparsityPattern(x, u, tol).template cast<Scalar>();
+  }
+
+  template <class PyClass> void visit(PyClass &cl) const {
+    cl.def("setSparsityPattern", &setSparsityPattern, ("self"_a, "pattern"),
+           "Set the structurally nonzero entries of the Jacobian [Jx Ju], "
+           "and group its independent columns.")
+        .def("computeSparsityPattern", &computeSparsityPattern,
+             ("self"_a, "x", "u", "tol"_a = 0.),
+             "Detect the sparsity pattern from a dense finite-difference "
+             "Jacobian at (x, u).")
+        .def("numColors", &FiniteDiffType::numColors, "self"_a,
+             "Number of evaluations per Jacobian.")
+        .add_property("num_threads", &FiniteDiffType::getNumThreads,
+                      &FiniteDiffType::setNumThreads,
+                      "Number of threads, used by the datas created "
+                      "afterwards.");
+  }
+};
+
 /// Expose finite difference helpers.
 void exposeAutodiff() {
   using namespace autodiff;
@@ -25,7 +62,8 @@ void exposeAutodiff() {
         "Make a function into a differentiable function/dynamics using"
         " finite differences.",
         bp::init<xyz::polymorphic<Manifold>, xyz::polymorphic<StageFunction>,
-                 const Scalar>(("self"_a, "space", "func", "eps")));
+                 const Scalar>(("self"_a, "space", "func", "eps")))
+        .def(FiniteDifferenceSparsityVisitor<FiniteDiffType>());
     bp::class_<FiniteDiffType::Data, bp::bases<StageFunctionData>>("Data",
                                                                    bp::no_init);
   }
@@ -35,7 +73,8 @@ void exposeAutodiff() {
     bp::scope _ = bp::class_<DynFiniteDiffType, bp::bases<ExplicitDynamics>>(
         "DynamicsFiniteDifferenceHelper",
         bp::init<xyz::polymorphic<Manifold>, xyz::polymorphic<ExplicitDynamics>,
-                 const Scalar>(("self"_a, "space", "dyn", "eps")));
+                 const Scalar>(("self"_a, "space", "dyn", "eps")))
+        .def(FiniteDifferenceSparsityVisitor<DynFiniteDiffType>());
     bp::class_<DynFiniteDiffType::Data, bp::bases<ExplicitDynamicsData>>(
         "Data", bp::no_init);
   }
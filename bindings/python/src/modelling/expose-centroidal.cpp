@@ -9,6 +9,8 @@
 #include "aligator/modelling/centroidal/centroidal-acceleration.hpp"
 #include "aligator/modelling/centroidal/centroidal-friction-cone.hpp"
 #include "aligator/modelling/centroidal/centroidal-wrench-cone.hpp"
+#include "aligator/modelling/centroidal/multi-contact-friction-cone.hpp"
+#include "aligator/modelling/centroidal/multi-contact-wrench-cone.hpp"
 #include "aligator/modelling/centroidal/angular-acceleration.hpp"
 #include "aligator/modelling/centroidal/centroidal-wrapper.hpp"
 #include "aligator/modelling/contact-map.hpp"
@@ -67,6 +69,14 @@ void exposeCentroidalFunctions() {
   using CentroidalWrenchConeResidual = CentroidalWrenchConeResidualTpl<Scalar>;
   using CentroidalWrenchConeData = CentroidalWrenchConeDataTpl<Scalar>;
 
+  using MultiContactFrictionConeResidual =
+      MultiContactFrictionConeResidualTpl<Scalar>;
+  using MultiContactFrictionConeData = MultiContactFrictionConeDataTpl<Scalar>;
+
+  using MultiContactWrenchConeResidual =
+      MultiContactWrenchConeResidualTpl<Scalar>;
+  using MultiContactWrenchConeData = MultiContactWrenchConeDataTpl<Scalar>;
+
   using AngularAccelerationResidual = AngularAccelerationResidualTpl<Scalar>;
   using AngularAccelerationData = AngularAccelerationDataTpl<Scalar>;
 
@@ -168,6 +178,42 @@ void exposeCentroidalFunctions() {
       "CentroidalWrenchConeData", "Data Structure for CentroidalWrenchCone",
       bp::no_init);
 
+  bp::class_<MultiContactFrictionConeResidual, bp::bases<StageFunction>>(
+      "MultiContactFrictionConeResidual",
+      "The friction cones of several contacts, stacked by kind: "
+      ":math:`r(x) = [\\epsilon - f_{k,z}, f_{k,x}^2 + f_{k,y}^2 - \\mu^2 "
+      "f_{k,z}^2]`",
+      bp::init<const int, const int, const std::vector<int> &, const double,
+               const double>(
+          ("self"_a, "ndx", "nu", "contact_ids", "mu", "epsilon")))
+      .def_readonly("contact_ids",
+                    &MultiContactFrictionConeResidual::contact_ids_)
+      .def(func_visitor);
+
+  bp::register_ptr_to_python<shared_ptr<MultiContactFrictionConeData>>();
+
+  bp::class_<MultiContactFrictionConeData, bp::bases<StageFunctionData>>(
+      "MultiContactFrictionConeData",
+      "Data Structure for MultiContactFrictionCone", bp::no_init);
+
+  bp::class_<MultiContactWrenchConeResidual, bp::bases<StageFunction>>(
+      "MultiContactWrenchConeResidual",
+      "The wrench cones of several rectangular contacts, stacked by contact: "
+      ":math:`r(x) = [A f_k]`",
+      bp::init<const int, const int, const std::vector<int> &, const double,
+               const double, const double>(
+          ("self"_a, "ndx", "nu", "contact_ids", "mu", "L", "W")))
+      .def_readonly("contact_ids",
+                    &MultiContactWrenchConeResidual::contact_ids_)
+      .def_readonly("A", &MultiContactWrenchConeResidual::A_)
+      .def(func_visitor);
+
+  bp::register_ptr_to_python<shared_ptr<MultiContactWrenchConeData>>();
+
+  bp::class_<MultiContactWrenchConeData, bp::bases<StageFunctionData>>(
+      "MultiContactWrenchConeData",
+      "Data Structure for MultiContactWrenchCone", bp::no_init);
+
   bp::class_<AngularAccelerationResidual, bp::bases<StageFunction>>(
       "AngularAccelerationResidual",
       "A residual function :math:`r(x) = Ldot(x)` ",
@@ -34,6 +34,9 @@ void exposeComposites() {
           bp::args("self", "space", "function", "weights")))
       .def_readwrite("residual", &QuadResCost::residual_)
       .def_readwrite("weights", &QuadResCost::weights_)
+      .def_readwrite("weights_parameter", &QuadResCost::weights_parameter_,
+                     "Name of the stage parameter slot holding the weights "
+                     "(column-major), if not empty.")
       .def(CopyableVisitor<QuadResCost>())
       .def(visitor);
 
@@ -79,6 +82,8 @@ void exposeComposites() {
       .add_property("target", &QuadStateCost::getTarget,
                     &QuadStateCost::setTarget,
                     "Target of the quadratic distance.")
+      .def("setTargetParameter", &QuadStateCost::setTargetParameter,
+           ("self"_a, "name"), "Read the target from a stage parameter slot.")
       .def(visitor);
 
   bp::class_<QuadControlCost, bp::bases<QuadResCost>>(
@@ -93,6 +98,8 @@ void exposeComposites() {
       .add_property("target", &QuadControlCost::getTarget,
                     &QuadControlCost::setTarget,
                     "Reference of the control cost.")
+      .def("setTargetParameter", &QuadControlCost::setTargetParameter,
+           ("self"_a, "name"), "Read the target from a stage parameter slot.")
       .def(visitor);
 }
 } // namespace python
@@ -56,6 +56,10 @@ void exposeCostStack() {
                 "Construct the CostStack from a CostMap object."))
             .def_readonly("components", &CostStack::components_,
                           "Components of this cost stack.")
+            .def_readwrite("stacked_gauss_newton",
+                           &CostStack::stacked_gauss_newton,
+                           "Form the Gauss-Newton Hessians of the quadratic "
+                           "residual components with a single product.")
             .def(
                 "getComponent",
                 +[](CostStack &self, const CostKey &key) -> PolyCost & {
@@ -2,6 +2,7 @@
 /// @copyright Copyright (C) 2023 LAAS-CNRS, 2023-2025 INRIA
 #include "aligator/python/fwd.hpp"
 #include "aligator/python/visitors.hpp"
+#include "aligator/python/eigen-member.hpp"
 #include "aligator/python/modelling/explicit-dynamics.hpp"
 #include "aligator/modelling/linear-discrete-dynamics.hpp"
 
@@ -70,8 +71,13 @@ void exposeExplicitBase() {
   bp::class_<ExplicitDataWrapper, boost::noncopyable>(
       "ExplicitDynamicsData", "Data struct for explicit dynamics models.",
       bp::no_init)
-      .def_readwrite("xnext", &ExplicitDataWrapper::xnext_)
-      .def_readwrite("jac_buffer", &ExplicitDataWrapper::jac_buffer_)
+      .add_property("xnext",
+                    make_getter_eigen_matrix(&ExplicitDynamicsData::xnext_),
+                    make_setter_eigen_matrix(&ExplicitDynamicsData::xnext_))
+      .add_property(
+          "jac_buffer",
+          make_getter_eigen_matrix(&ExplicitDynamicsData::jac_buffer_),
+          make_setter_eigen_matrix(&ExplicitDynamicsData::jac_buffer_))
       .add_property(
           "Jx",
           +[](ExplicitDynamicsData &self) -> context::MatrixRef {
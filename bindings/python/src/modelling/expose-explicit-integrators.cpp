@@ -7,6 +7,8 @@
 #include "aligator/modelling/dynamics/fwd.hpp"
 #include "aligator/modelling/dynamics/integrator-euler.hpp"
 #include "aligator/modelling/dynamics/integrator-rk2.hpp"
+#include "aligator/modelling/dynamics/integrator-rk23.hpp"
+#include "aligator/modelling/dynamics/integrator-rk4.hpp"
 #include "aligator/modelling/dynamics/integrator-semi-euler.hpp"
 
 namespace aligator {
@@ -85,6 +87,36 @@ void exposeExplicitIntegrators() {
 
   bp::class_<IntegratorRK2DataTpl<Scalar>, bp::bases<ExplicitIntegratorData>>(
       "IntegratorRK2Data", bp::no_init);
+
+  bp::class_<IntegratorRK4Tpl<Scalar>, bp::bases<ExplicitIntegratorAbstract>>(
+      "IntegratorRK4",
+      "The classical fourth-order Runge-Kutta integrator; this integrator has "
+      "local error :math:`O(\\Delta t^5)`.",
+      bp::init<const polymorphic<ODEType> &, Scalar>(
+          bp::args("self", "ode", "timestep")))
+      .def_readwrite("timestep", &IntegratorRK4Tpl<Scalar>::timestep_,
+                     "Time step.")
+      .def(conversions_visitor);
+
+  bp::class_<IntegratorRK4DataTpl<Scalar>, bp::bases<ExplicitIntegratorData>>(
+      "IntegratorRK4Data", bp::no_init);
+
+  bp::class_<IntegratorRK23Tpl<Scalar>, bp::bases<ExplicitIntegratorAbstract>>(
+      "IntegratorRK23",
+      "The Bogacki-Shampine embedded Runge-Kutta pair of orders 3 and 2. "
+      "The step is taken with the third-order solution, and the data holds "
+      "the difference with the second-order one as a local error estimate.",
+      bp::init<const polymorphic<ODEType> &, Scalar>(
+          bp::args("self", "ode", "timestep")))
+      .def_readwrite("timestep", &IntegratorRK23Tpl<Scalar>::timestep_,
+                     "Time step.")
+      .def(conversions_visitor);
+
+  bp::class_<IntegratorRK23DataTpl<Scalar>, bp::bases<ExplicitIntegratorData>>(
+      "IntegratorRK23Data", bp::no_init)
+      .def_readonly("error", &IntegratorRK23DataTpl<Scalar>::error_,
+                    "Local error estimate, in the tangent space at the "
+                    "current state.");
 }
 
 } // namespace python
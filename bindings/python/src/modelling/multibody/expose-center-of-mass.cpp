@@ -67,8 +67,7 @@ void exposeCenterOfMassFunctions() {
   bp::class_<CenterOfMassTranslationData, bp::bases<StageFunctionData>>(
       "CenterOfMassTranslationResidualData",
       "Data Structure for CenterOfMassTranslation", bp::no_init)
-      .def_readonly("pin_data", &CenterOfMassTranslationData::pin_data_,
-                    "Pinocchio data struct.");
+      .def(PinDataVisitor<CenterOfMassTranslationData>());
 
   bp::class_<CenterOfMassVelocity, bp::bases<UnaryFunction>>(
       "CenterOfMassVelocityResidual",
@@ -148,8 +147,14 @@ void exposeCenterOfMassFunctions() {
   bp::class_<CentroidalMomentumData, bp::bases<StageFunctionData>>(
       "CentroidalMomentumResidualData",
       "Data Structure for CentroidalMomentumResidual", bp::no_init)
-      .def_readonly("pin_data", &CentroidalMomentumData::pin_data_,
-                    "Pinocchio data struct.");
+      .add_property(
+          "pin_data",
+          bp::make_function(
+              +[](const CentroidalMomentumData &d) -> const PinData & {
+                return d.pin_data_;
+              },
+              bp::return_internal_reference<>()),
+          "Pinocchio data struct.");
 }
 
 } // namespace python
@@ -44,7 +44,13 @@ void exposeFlyHigh() {
   bp::class_<FlyHighResidual::Data, bp::bases<StageFunctionData>>(
       "FlyHighResidualData", bp::no_init)
       .def_readonly("ez", &FlyHighResidual::Data::ez)
-      .def_readonly("pin_data", &FlyHighResidual::Data::pdata_);
+      .add_property(
+          "pin_data",
+          bp::make_function(
+              +[](const FlyHighResidual::Data &d) -> const PinData & {
+                return d.pdata_;
+              },
+              bp::return_internal_reference<>()));
 }
 
 } // namespace python
@@ -25,7 +25,13 @@ void exposeGravityCompensation() {
       .def(bp::init<int, const MatrixXs &, const PinModel &>(
           ("self"_a, "ndx", "actuation_matrix", "model")))
       .def(bp::init<int, const PinModel &>(("self"_a, "ndx", "model")))
-      .def_readonly("pin_model", &GravityCompensationResidual::pin_model_)
+      .add_property(
+          "pin_model",
+          bp::make_function(
+              +[](const GravityCompensationResidual &f) -> const PinModel & {
+                return f.getModel();
+              },
+              bp::return_internal_reference<>()))
       .def_readonly("actuation_matrix",
                     &GravityCompensationResidual::actuation_matrix_)
       .def_readonly("use_actuation_matrix",
@@ -16,6 +16,7 @@
 #include "aligator/modelling/multibody/frame-velocity.hpp"
 #include "aligator/modelling/multibody/frame-translation.hpp"
 #include "aligator/modelling/multibody/frame-collision.hpp"
+#include "aligator/modelling/multibody/multi-frame-collision.hpp"
 
 #include "aligator/modelling/multibody/constrained-rnea.hpp"
 
@@ -66,6 +67,9 @@ void exposeFrameFunctions() {
   using FrameCollision = FrameCollisionResidualTpl<Scalar>;
   using FrameCollisionData = FrameCollisionDataTpl<Scalar>;
 
+  using MultiFrameCollision = MultiFrameCollisionResidualTpl<Scalar>;
+  using MultiFrameCollisionData = MultiFrameCollisionDataTpl<Scalar>;
+
   using pinocchio::GeometryModel;
 
   if (!eigenpy::check_registration<shared_ptr<PinData>>())
@@ -112,7 +116,11 @@ void exposeFrameFunctions() {
       .def("getReference", &FramePlacement::getReference, "self"_a,
            bp::return_internal_reference<>(), "Get the target frame in SE3.")
       .def("setReference", &FramePlacement::setReference, ("self"_a, "p_new"),
-           "Set the target frame in SE3.");
+           "Set the target frame in SE3.")
+      .def_readwrite("reference_parameter",
+                     &FramePlacement::reference_parameter_,
+                     "Name of the stage parameter slot holding the target "
+                     "frame as (x, y, z, qx, qy, qz, qw), if not empty.");
 
   bp::register_ptr_to_python<shared_ptr<FramePlacementData>>();
 
@@ -122,8 +130,7 @@ void exposeFrameFunctions() {
       .def_readonly("rMf", &FramePlacementData::rMf_, "Frame placement error.")
       .def_readonly("rJf", &FramePlacementData::rJf_)
       .def_readonly("fJf", &FramePlacementData::fJf_)
-      .def_readonly("pin_data", &FramePlacementData::pin_data_,
-                    "Pinocchio data struct.");
+      .def(PinDataVisitor<FramePlacementData>());
 
   bp::class_<FrameVelocity, bp::bases<UnaryFunction>>(
       "FrameVelocityResidual", "Frame velocity residual function.",
@@ -132,7 +139,12 @@ void exposeFrameFunctions() {
           ("self"_a, "ndx", "nu", "model", "v_ref", "id", "reference_frame")))
       .def(FrameAPIVisitor<FrameVelocity>())
       .def(unary_visitor)
-      .def_readonly("pin_model", &FrameVelocity::pin_model_)
+      .add_property("pin_model",
+                    bp::make_function(
+                        +[](const FrameVelocity &f) -> const PinModel & {
+                          return f.getModel();
+                        },
+                        bp::return_internal_reference<>()))
       .def_readwrite("vref", &FrameVelocity::vref_)
       .def_readwrite("type", &FrameVelocity::type_)
       .def("getReference", &FrameVelocity::getReference, "self"_a,
@@ -146,8 +158,7 @@ void exposeFrameFunctions() {
   bp::class_<FrameVelocityData, bp::bases<context::StageFunctionData>>(
       "FrameVelocityData", "Data struct for FrameVelocityResidual.",
       bp::no_init)
-      .def_readonly("pin_data", &FrameVelocityData::pin_data_,
-                    "Pinocchio data struct.");
+      .def(PinDataVisitor<FrameVelocityData>());
 
   bp::class_<FrameTranslation, bp::bases<UnaryFunction>>(
       "FrameTranslationResidual", "Frame placement residual function.",
@@ -160,7 +171,11 @@ void exposeFrameFunctions() {
            bp::return_internal_reference<>(),
            "Get the target frame translation.")
       .def("setReference", &FrameTranslation::setReference, ("self"_a, "p_new"),
-           "Set the target frame translation.");
+           "Set the target frame translation.")
+      .def_readwrite("reference_parameter",
+                     &FrameTranslation::reference_parameter_,
+                     "Name of the stage parameter slot holding the target "
+                     "translation, if not empty.");
 
   bp::register_ptr_to_python<shared_ptr<FrameTranslationData>>();
 
@@ -168,8 +183,7 @@ void exposeFrameFunctions() {
       "FrameTranslationData", "Data struct for FrameTranslationResidual.",
       bp::no_init)
       .def_readonly("fJf", &FrameTranslationData::fJf_)
-      .def_readonly("pin_data", &FrameTranslationData::pin_data_,
-                    "Pinocchio data struct.");
+      .def(PinDataVisitor<FrameTranslationData>());
 
   bp::class_<FrameCollision, bp::bases<UnaryFunction>>(
       "FrameCollisionResidual", "Frame collision residual function.",
@@ -184,10 +198,47 @@ void exposeFrameFunctions() {
   bp::class_<FrameCollisionData, bp::bases<context::StageFunctionData>>(
       "FrameCollisionData", "Data struct for FrameCollisionResidual.",
       bp::no_init)
-      .def_readonly("pin_data", &FrameCollisionData::pin_data_,
-                    "Pinocchio data struct.")
+      .def(PinDataVisitor<FrameCollisionData>())
       .def_readonly("geom_data", &FrameCollisionData::geom_data,
                     "Geometry data struct.");
+
+  bp::class_<MultiFrameCollision, bp::bases<UnaryFunction>>(
+      "MultiFrameCollisionResidual",
+      "Distances of several collision pairs, with broadphase culling.",
+      bp::init<int, int, const PinModel &, const GeometryModel &,
+               const std::vector<pinocchio::PairIndex> &, Scalar>(
+          ("self"_a, "ndx", "nu", "model", "geom_model", "pair_ids",
+           "broadphase_distance")))
+      .def(bp::init<int, int, const PinModel &, const GeometryModel &>(
+          ("self"_a, "ndx", "nu", "model", "geom_model"),
+          "Constructor for all the collision pairs of the geometry model, "
+          "without culling."))
+      .def(unary_visitor)
+      .add_property("num_pairs", &MultiFrameCollision::numPairs)
+      .def_readonly("pair_ids", &MultiFrameCollision::pair_ids_)
+      .def_readwrite("broadphase_distance",
+                     &MultiFrameCollision::broadphase_distance_,
+                     "Distance between the bounding boxes of a pair above "
+                     "which its narrowphase is skipped.");
+
+  bp::register_ptr_to_python<shared_ptr<MultiFrameCollisionData>>();
+
+  bp::class_<MultiFrameCollisionData, bp::bases<context::StageFunctionData>>(
+      "MultiFrameCollisionData", "Data struct for MultiFrameCollisionResidual.",
+      bp::no_init)
+      .def(PinDataVisitor<MultiFrameCollisionData>())
+      .def_readonly("geom_data", &MultiFrameCollisionData::geom_data,
+                    "Geometry data struct.")
+      .add_property(
+          "active_pairs",
+          +[](const MultiFrameCollisionData &d) {
+            bp::list out;
+            for (const bool active : d.active_pairs_)
+              out.append(active);
+            return out;
+          },
+          "Whether the narrowphase was run for each pair at the last "
+          "evaluation.");
 }
 
 auto underactuatedConstraintInvDyn_proxy(const PinModel &model, PinData &data,
@@ -98,10 +98,15 @@ def createStage(cont_states, cont_pos):
         rcost.addCost(aligator.QuadraticResidualCost(space, frame_res, w_trans))
 
     stm = aligator.StageModel(rcost, create_dynamics(cont_states))
+    contact_ids = [i for i in range(len(cont_states)) if cont_states[i]]
+    if contact_ids:
+        # friction cones of all the contacts in a single constraint
+        cone_cstr = aligator.MultiContactFrictionConeResidual(
+            space.ndx, nu, contact_ids, mu, 1e-5
+        )
+        stm.addConstraint(cone_cstr, constraints.NegativeOrthant())
     for i in range(len(cont_states)):
         if cont_states[i]:
-            cone_cstr = aligator.FrictionConeResidual(space.ndx, nu, i, mu, 1e-5)
-            stm.addConstraint(cone_cstr, constraints.NegativeOrthant())
             frame_res = aligator.FrameTranslationResidual(
                 space.ndx, nu, rmodel, cont_pos[i], feet_ids[i]
             )
@@ -184,6 +184,8 @@ TrajOptProblem defineLocomotionProblem(const std::size_t T_ss,
   contact_phases.insert(contact_phases.end(), double_phase.begin(),
                         double_phase.end());
 
+  // all the stages share the space's Pinocchio model
+  auto stage_space = MultibodyPhaseSpace(rmodel);
   std::vector<xyz::polymorphic<StageModel>> stage_models;
   size_t ts = 0;
   for (std::vector<Support>::iterator phase = contact_phases.begin();
@@ -191,8 +193,6 @@ TrajOptProblem defineLocomotionProblem(const std::size_t T_ss,
     Support ph = *phase;
     ts += 1;
 
-    auto stage_space = MultibodyPhaseSpace(rmodel);
-
     auto rcost = CostStack(stage_space, nu);
 
     rcost.addCost("quad_state", QuadraticStateCost(stage_space, nu, x0, w_x));
@@ -205,14 +205,16 @@ TrajOptProblem defineLocomotionProblem(const std::size_t T_ss,
     case LEFT:
       getFootTraj(T_ss, ts, RF_placement.translation());
       frame_fn_RF = std::make_shared<FramePlacementResidual>(
-          stage_space.ndx(), nu, rmodel, RF_placement, foot_frame_ids[1]);
+          stage_space.ndx(), nu, stage_space.getModelHandle(), RF_placement,
+          foot_frame_ids[1]);
       rcost.addCost("frame_fn_RF",
                     QuadraticResidualCost(stage_space, *frame_fn_RF, w_LFRF));
       break;
     case RIGHT:
       getFootTraj(T_ss, ts, LF_placement.translation());
       frame_fn_LF = std::make_shared<FramePlacementResidual>(
-          stage_space.ndx(), nu, rmodel, LF_placement, foot_frame_ids[0]);
+          stage_space.ndx(), nu, stage_space.getModelHandle(), LF_placement,
+          foot_frame_ids[0]);
       rcost.addCost("frame_fn_LF",
                     QuadraticResidualCost(stage_space, *frame_fn_LF, w_LFRF));
       break;
@@ -224,9 +226,9 @@ TrajOptProblem defineLocomotionProblem(const std::size_t T_ss,
         StageModel(rcost, createDynamics(stage_space, ph, actuation_matrix,
                                          prox_settings, constraint_models)));
   }
-  auto ter_space = MultibodyPhaseSpace(rmodel);
-  auto term_cost = CostStack(ter_space, nu);
-  term_cost.addCost("quad_state", QuadraticStateCost(ter_space, nu, x0, w_x));
+  auto term_cost = CostStack(stage_space, nu);
+  term_cost.addCost("quad_state",
+                    QuadraticStateCost(stage_space, nu, x0, w_x));
 
   return TrajOptProblem(x0, stage_models, term_cost);
 }
@@ -542,6 +542,7 @@ struct BunchKaufman : SolverBase<BunchKaufman<MatrixType_, UpLo_>> {
 
   BunchKaufman()
       : m_matrix()
+      , m_size(0)
       , m_subdiag()
       , m_pivot_count(0)
       , m_pivots()
@@ -551,6 +552,7 @@ struct BunchKaufman : SolverBase<BunchKaufman<MatrixType_, UpLo_>> {
       , m_workspace() {}
   explicit BunchKaufman(Index size)
       : m_matrix(size, size)
+      , m_size(size)
       , m_subdiag(size)
       , m_pivot_count(0)
       , m_pivots(size)
@@ -562,6 +564,7 @@ struct BunchKaufman : SolverBase<BunchKaufman<MatrixType_, UpLo_>> {
   template <typename InputType>
   explicit BunchKaufman(const EigenBase<InputType> &matrix)
       : m_matrix(matrix.rows(), matrix.cols())
+      , m_size(matrix.rows())
       , m_subdiag(matrix.rows())
       , m_pivot_count(0)
       , m_pivots(matrix.rows())
@@ -574,14 +577,10 @@ struct BunchKaufman : SolverBase<BunchKaufman<MatrixType_, UpLo_>> {
 
   // EIGEN_DEVICE_FUNC inline EIGEN_CONSTEXPR Index rows() const noexcept
   // { return m_matrix.rows(); }
-  EIGEN_DEVICE_FUNC inline Index rows() const noexcept {
-    return m_matrix.rows();
-  }
+  EIGEN_DEVICE_FUNC inline Index rows() const noexcept { return m_size; }
   // EIGEN_DEVICE_FUNC inline EIGEN_CONSTEXPR Index cols() const noexcept
   // { return m_matrix.cols(); }
-  EIGEN_DEVICE_FUNC inline Index cols() const noexcept {
-    return m_matrix.cols();
-  }
+  EIGEN_DEVICE_FUNC inline Index cols() const noexcept { return m_size; }
 
   inline const MatrixType &matrixLDLT() const { return m_matrix; }
 
@@ -592,6 +591,12 @@ struct BunchKaufman : SolverBase<BunchKaufman<MatrixType_, UpLo_>> {
   template <typename InputType>
   BunchKaufman &compute(const EigenBase<InputType> &matrix);
 
+  /// @brief Factorize a matrix no larger than the current storage, without
+  /// reallocating. Only the leading block of the storage is used, and
+  /// matrixLDLT(), pivots() and subdiag() should not be used afterwards.
+  template <typename InputType>
+  BunchKaufman &computeNoResize(const EigenBase<InputType> &matrix);
+
   ComputationInfo info() const { return m_info; }
 
 #ifdef EIGEN_PARSED_BY_DOXYGEN
@@ -612,6 +617,7 @@ struct BunchKaufman : SolverBase<BunchKaufman<MatrixType_, UpLo_>> {
 
 private:
   MatrixType m_matrix;
+  Index m_size;
   VecType m_subdiag;
   Index m_pivot_count;
   IndicesType m_pivots;
@@ -627,8 +633,9 @@ template <typename RhsType, typename DstType>
 void BunchKaufman<MatrixType_, UpLo_>::_solve_impl(const RhsType &rhs,
                                                    DstType &dst) const {
   dst = rhs;
-  internal::bunch_kaufman_solve_in_place<false>(this->m_matrix, this->m_subdiag,
-                                                this->m_pivots, dst);
+  internal::bunch_kaufman_solve_in_place<false>(
+      this->m_matrix.topLeftCorner(m_size, m_size),
+      this->m_subdiag.head(m_size), this->m_pivots.head(m_size), dst);
 }
 
 template <typename MatrixType_, int UpLo_>
@@ -637,7 +644,8 @@ void BunchKaufman<MatrixType_, UpLo_>::_solve_impl_transposed(
     const RhsType &rhs, DstType &dst) const {
   dst = rhs;
   internal::bunch_kaufman_solve_in_place<!Conjugate>(
-      this->m_matrix, this->m_subdiag, this->m_pivots, dst);
+      this->m_matrix.topLeftCorner(m_size, m_size),
+      this->m_subdiag.head(m_size), this->m_pivots.head(m_size), dst);
 }
 
 template <typename MatrixType_, int UpLo_>
@@ -656,6 +664,7 @@ BunchKaufman<MatrixType_, UpLo_> &
 BunchKaufman<MatrixType_, UpLo_>::compute(const EigenBase<InputType> &a) {
   eigen_assert(a.rows() == a.cols());
   Index n = a.rows();
+  this->m_size = n;
   this->m_matrix.resize(n, n);
   this->m_subdiag.resize(n);
   this->m_pivots.resize(n);
@@ -674,6 +683,36 @@ BunchKaufman<MatrixType_, UpLo_>::compute(const EigenBase<InputType> &a) {
   this->m_isInitialized = true;
   return *this;
 }
+
+template <typename MatrixType_, int UpLo_>
+template <typename InputType>
+BunchKaufman<MatrixType_, UpLo_> &
+BunchKaufman<MatrixType_, UpLo_>::computeNoResize(
+    const EigenBase<InputType> &a) {
+  eigen_assert(a.rows() == a.cols());
+  const Index n = a.rows();
+  const Index blocksize = n <= BlockSize ? 0 : BlockSize;
+  eigen_assert(n <= m_matrix.rows() && n <= m_workspace.rows() &&
+               blocksize <= m_workspace.cols());
+  this->m_size = n;
+  this->m_blocksize = blocksize;
+
+  auto mat = this->m_matrix.topLeftCorner(n, n);
+  auto subdiag = this->m_subdiag.head(n);
+  auto pivots = this->m_pivots.head(n);
+  auto workspace = this->m_workspace.topLeftCorner(n, blocksize);
+  mat.setZero();
+  subdiag.setZero();
+  pivots.setZero();
+  workspace.setZero();
+
+  mat.template triangularView<Lower>() =
+      a.derived().template triangularView<UpLo_>();
+  this->m_info = internal::bunch_kaufman_in_place(
+      mat, subdiag, pivots, workspace, this->m_pivot_count);
+  this->m_isInitialized = true;
+  return *this;
+}
 } // namespace Eigen
 
 namespace aligator {
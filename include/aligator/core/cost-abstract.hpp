@@ -5,6 +5,8 @@
 
 #include "aligator/context.hpp"
 #include "aligator/core/manifold-base.hpp"
+#include "aligator/core/shared-data-scope.hpp"
+#include "aligator/core/arena-matrix.hpp"
 #include "aligator/third-party/polymorphic_cxx14.h"
 
 namespace aligator {
@@ -45,6 +47,15 @@ template <typename _Scalar> struct CostAbstractTpl {
     return std::make_shared<CostData>(ndx(), nu);
   }
 
+  /// @brief Declare the stage parameter slots this cost reads.
+  /// @sa StageFunctionTpl::registerParameters()
+  virtual void registerParameters(StageParametersTpl<Scalar> &) const {}
+
+  /// @brief Whether the Hessians do not depend on \f$(x, u)\f$, e.g. for
+  /// quadratic costs.
+  /// @sa StageFunctionTpl::hasConstantJacobians()
+  virtual bool hasConstantHessians() const { return false; }
+
   virtual ~CostAbstractTpl() = default;
 };
 
@@ -75,8 +86,10 @@ template <typename _Scalar> struct CostDataAbstractTpl {
   ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
   int ndx_, nu_;
   Scalar value_;
-  VectorXs grad_;
-  MatrixXs hess_;
+  /// Memory resource of the gradient and Hessian, see SharedDataScope.
+  shared_ptr<std::pmr::memory_resource> arena_;
+  ArenaMatrix<VectorXs> grad_;
+  ArenaMatrix<MatrixXs> hess_;
 
   /// @brief Gradient \f$\ell_x\f$
   VectorRef Lx_;
@@ -95,8 +108,9 @@ template <typename _Scalar> struct CostDataAbstractTpl {
       : ndx_(ndx)
       , nu_(nu)
       , value_(0.)
-      , grad_(ndx + nu)
-      , hess_(ndx + nu, ndx + nu)
+      , arena_(SharedDataScope::currentArena())
+      , grad_(ndx + nu, dataAllocator(arena_))
+      , hess_(ndx + nu, ndx + nu, dataAllocator(arena_))
       , Lx_(grad_.head(ndx))
       , Lu_(grad_.tail(nu))
       , Lxx_(hess_.topLeftCorner(ndx, ndx))
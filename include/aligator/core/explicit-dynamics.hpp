@@ -4,6 +4,8 @@
 
 #include "aligator/context.hpp"
 #include "aligator/core/manifold-base.hpp"
+#include "aligator/core/shared-data-scope.hpp"
+#include "aligator/core/arena-matrix.hpp"
 #include "aligator/third-party/polymorphic_cxx14.h"
 
 #include <fmt/format.h>
@@ -52,6 +54,10 @@ template <typename _Scalar> struct ExplicitDynamicsModelTpl {
     return std::make_shared<Data>(*this);
   }
 
+  /// @brief Whether the Jacobians do not depend on \f$(x, u)\f$.
+  /// @sa StageFunctionTpl::hasConstantJacobians()
+  virtual bool hasConstantJacobians() const { return false; }
+
   virtual ~ExplicitDynamicsModelTpl() = default;
 
   polymorphic<Manifold> space_;
@@ -69,12 +75,13 @@ protected:
       : ndx1(ndx1)
       , nu(nu)
       , ndx2(ndx2)
-      , xnext_(nx2)
-      , jac_buffer_(ndx2, ndx1 + nu)
-      , Jtmp_xnext(ndx2, ndx2)
-      , Hxx_(ndx1, ndx1)
-      , Hxu_(ndx1, nu)
-      , Huu_(nu, nu) {
+      , arena_(SharedDataScope::currentArena())
+      , xnext_(nx2, dataAllocator(arena_))
+      , jac_buffer_(ndx2, ndx1 + nu, dataAllocator(arena_))
+      , Jtmp_xnext(ndx2, ndx2, dataAllocator(arena_))
+      , Hxx_(ndx1, ndx1, dataAllocator(arena_))
+      , Hxu_(ndx1, nu, dataAllocator(arena_))
+      , Huu_(nu, nu, dataAllocator(arena_)) {
     xnext_.setZero();
     jac_buffer_.setZero();
     Jtmp_xnext.setZero();
@@ -87,16 +94,19 @@ public:
   using Scalar = _Scalar;
   using Model = ExplicitDynamicsModelTpl<Scalar>;
   ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  /// Arena of the enclosing SharedDataScope at construction, or nullptr. Kept
+  /// alive by the data since the buffers below live in it.
+  shared_ptr<std::pmr::memory_resource> arena_;
   /// Next state.
-  VectorXs xnext_;
+  ArenaMatrix<VectorXs> xnext_;
   // Jacobians
-  MatrixXs jac_buffer_;
-  MatrixXs Jtmp_xnext;
+  ArenaMatrix<MatrixXs> jac_buffer_;
+  ArenaMatrix<MatrixXs> Jtmp_xnext;
 
   // Vector-Hessian products
-  MatrixXs Hxx_;
-  MatrixXs Hxu_;
-  MatrixXs Huu_;
+  ArenaMatrix<MatrixXs> Hxx_;
+  ArenaMatrix<MatrixXs> Hxu_;
+  ArenaMatrix<MatrixXs> Huu_;
 
   auto Jx() { return jac_buffer_.leftCols(ndx1); }
   auto Jx() const { return jac_buffer_.leftCols(ndx1); }
@@ -4,10 +4,38 @@
 #pragma once
 
 #include "aligator/context.hpp"
+#include "aligator/core/arena-matrix.hpp"
 #include <ostream>
 
 namespace aligator {
 
+/// @brief Static column sparsity pattern of the Jacobian of a stage function.
+/// @details The Jacobian \f$J_x\f$ (resp. \f$J_u\f$) of the function can only
+/// be nonzero in the columns `[x_begin, x_begin + x_size)` (resp.
+/// `[u_begin, u_begin + u_size)`). Consumers of the Jacobians skip the other
+/// columns, e.g. when forming \f$J^\top WJ\f$ or \f$J^\top\lambda\f$.
+struct JacobianPattern {
+  int x_begin;
+  int x_size;
+  int u_begin;
+  int u_size;
+
+  /// Pattern of a dense Jacobian.
+  JacobianPattern(const int ndx, const int nu)
+      : JacobianPattern(0, ndx, 0, nu) {}
+
+  JacobianPattern(const int x_begin, const int x_size, const int u_begin,
+                  const int u_size)
+      : x_begin(x_begin)
+      , x_size(x_size)
+      , u_begin(u_begin)
+      , u_size(u_size) {}
+
+  bool isDense(const int ndx, const int nu) const {
+    return x_size == ndx && u_size == nu;
+  }
+};
+
 /// @brief    Class representing ternary functions \f$f(x,u,x')\f$.
 template <typename _Scalar> struct StageFunctionTpl {
 public:
@@ -21,6 +49,10 @@ public:
   const int nu;
   /// @brief Function codimension
   const int nr;
+  /// @brief Columns of the Jacobians which can be nonzero, dense by default.
+  /// Functions whose Jacobians have structural zeros set it in their
+  /// constructor.
+  JacobianPattern jac_pattern;
 
   StageFunctionTpl(const int ndx, const int nu, const int nr);
 
@@ -67,6 +99,18 @@ public:
 
   /// @brief Instantiate a Data object.
   virtual shared_ptr<Data> createData() const;
+
+  /// @brief Declare the stage parameter slots this function reads, with their
+  /// default values.
+  /// @details Called by StageModelTpl on its parameters. The default
+  /// implementation declares nothing.
+  virtual void registerParameters(StageParametersTpl<Scalar> &) const {}
+
+  /// @brief Whether the Jacobians do not depend on \f$(x, u)\f$, e.g. for
+  /// linear functions.
+  /// @details StageModelTpl then only computes them once per solve, see
+  /// StageDataTpl::constant_jacobians_ready.
+  virtual bool hasConstantJacobians() const { return false; }
 };
 
 /// @brief  Base struct for function data.
@@ -80,13 +124,16 @@ template <typename _Scalar> struct StageFunctionDataTpl {
   /// @brief Total number of variables.
   const int nvar = ndx1 + nu;
 
+  /// Arena the buffers below are allocated from, if the data was created in
+  /// a SharedDataScope holding one.
+  shared_ptr<std::pmr::memory_resource> arena_;
   /// Function value.
-  VectorXs value_;
+  ArenaMatrix<VectorXs> value_;
   VectorRef valref_;
   /// Full Jacobian.
-  MatrixXs jac_buffer_;
+  ArenaMatrix<MatrixXs> jac_buffer_;
   /// Vector-Hessian product buffer.
-  MatrixXs vhp_buffer_;
+  ArenaMatrix<MatrixXs> vhp_buffer_;
   /// Jacobian with respect to \f$x\f$.
   MatrixRef Jx_;
   /// Jacobian with respect to \f$u\f$.
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "aligator/core/function-abstract.hpp"
+#include "aligator/core/shared-data-scope.hpp"
 #include <fmt/format.h>
 
 namespace aligator {
@@ -11,7 +12,8 @@ StageFunctionTpl<Scalar>::StageFunctionTpl(const int ndx, const int nu,
                                            const int nr)
     : ndx1(ndx)
     , nu(nu)
-    , nr(nr) {}
+    , nr(nr)
+    , jac_pattern(ndx, nu) {}
 
 template <typename Scalar>
 void StageFunctionTpl<Scalar>::computeVectorHessianProducts(
@@ -32,10 +34,11 @@ StageFunctionDataTpl<Scalar>::StageFunctionDataTpl(const int ndx1, const int nu,
     : ndx1(ndx1)
     , nu(nu)
     , nr(nr)
-    , value_(nr)
+    , arena_(SharedDataScope::currentArena())
+    , value_(nr, dataAllocator(arena_))
     , valref_(value_)
-    , jac_buffer_(nr, nvar)
-    , vhp_buffer_(nvar, nvar)
+    , jac_buffer_(nr, nvar, dataAllocator(arena_))
+    , vhp_buffer_(nvar, nvar, dataAllocator(arena_))
     , Jx_(jac_buffer_.leftCols(ndx1))
     , Ju_(jac_buffer_.middleCols(ndx1, nu))
     , Hxx_(vhp_buffer_.topLeftCorner(ndx1, ndx1))
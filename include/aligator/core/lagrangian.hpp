@@ -67,8 +67,11 @@ void LagrangianDerivatives<Scalar>::compute(const TrajOptProblem &problem,
     BlkView v_(vs[i], stack.dims());
     for (std::size_t j = 0; j < stack.size(); j++) {
       const StageFunctionData &cd = *sd.constraint_data[j];
-      Lxs[i].noalias() += cd.Jx_.transpose() * v_[j];
-      Lus[i].noalias() += cd.Ju_.transpose() * v_[j];
+      const JacobianPattern &p = stack.funcs[j]->jac_pattern;
+      Lxs[i].segment(p.x_begin, p.x_size).noalias() +=
+          cd.Jx_.middleCols(p.x_begin, p.x_size).transpose() * v_[j];
+      Lus[i].segment(p.u_begin, p.u_size).noalias() +=
+          cd.Ju_.middleCols(p.u_begin, p.u_size).transpose() * v_[j];
     }
 
     if (has_lbdas) {
@@ -86,7 +89,9 @@ void LagrangianDerivatives<Scalar>::compute(const TrajOptProblem &problem,
     BlkView vN(vs[nsteps], stack.dims());
     for (std::size_t j = 0; j < stack.size(); j++) {
       const StageFunctionData &cd = *pd.term_cstr_data[j];
-      Lxs[nsteps].noalias() += cd.Jx_.transpose() * vN[j];
+      const JacobianPattern &p = stack.funcs[j]->jac_pattern;
+      Lxs[nsteps].segment(p.x_begin, p.x_size).noalias() +=
+          cd.Jx_.middleCols(p.x_begin, p.x_size).transpose() * vN[j];
     }
   }
 }
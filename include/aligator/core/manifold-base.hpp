@@ -17,7 +17,8 @@ public:
 
   ManifoldAbstractTpl(int nx, int ndx)
       : nx_(nx)
-      , ndx_(ndx) {}
+      , ndx_(ndx)
+      , non_euclidean_dim_(ndx) {}
 
   virtual ~ManifoldAbstractTpl() = default;
 
@@ -26,6 +27,19 @@ public:
   /// @brief    Get manifold tangent space dimension.
   inline int ndx() const { return ndx_; }
 
+  /// @brief    Number of leading tangent coordinates on which the manifold is
+  /// not Euclidean.
+  ///
+  /// @details  The Jacobians of integrate() and difference() are
+  /// block-diagonal, with identity (or minus identity) blocks on the last
+  /// `ndx() - nonEuclideanDim()` coordinates, on which the transport is the
+  /// identity. This is e.g. the free-flyer block of a floating-base robot's
+  /// phase space. Callers can skip the operations on these coordinates.
+  inline int nonEuclideanDim() const { return non_euclidean_dim_; }
+  /// @brief    Whether the manifold is a vector space, on which the Jacobians
+  /// of the operations are identities and the transports do nothing.
+  inline bool isEuclidean() const { return non_euclidean_dim_ == 0; }
+
   /// @brief Get the neutral element \f$e \in M\f$ from the manifold (if this
   /// makes sense).
   [[nodiscard]] VectorXs neutral() const {
@@ -71,6 +85,8 @@ public:
   void JintegrateTransport(const ConstVectorRef &x, const ConstVectorRef &v,
                            MatrixRef Jout, int arg) const {
     assert(Jout.rows() == v.size());
+    if (isEuclidean())
+      return;
     JintegrateTransport_impl(x, v, Jout, arg);
   }
 
@@ -119,9 +135,40 @@ public:
 
   /// \}
 
+  /// \name Batched operations.
+  /// The knots of a trajectory are stored as the columns of the matrices.
+  /// \{
+
+  /// @brief Batched integration \f$y_i = x_i \oplus \alpha v_i\f$, without
+  /// forming the scaled increments.
+  void integrateBatch(const ConstMatrixRef &xs, const ConstMatrixRef &vs,
+                      const Scalar alpha, MatrixRef out) const {
+    assert(xs.cols() == vs.cols() && out.cols() == xs.cols());
+    integrateBatch_impl(xs, vs, alpha, out);
+  }
+
+  /// @brief Batched difference \f$v_i = x_{1,i} \ominus x_{0,i}\f$.
+  void differenceBatch(const ConstMatrixRef &x0s, const ConstMatrixRef &x1s,
+                       MatrixRef out) const {
+    assert(x0s.cols() == x1s.cols() && out.cols() == x0s.cols());
+    differenceBatch_impl(x0s, x1s, out);
+  }
+
+  /// @brief Batched Jacobians of the difference, stacked horizontally in
+  /// @p Jout (of size `ndx x (n * ndx)`).
+  void JdifferenceBatch(const ConstMatrixRef &x0s, const ConstMatrixRef &x1s,
+                        MatrixRef Jout, int arg) const {
+    assert(x0s.cols() == x1s.cols() && Jout.cols() == x0s.cols() * ndx());
+    JdifferenceBatch_impl(x0s, x1s, Jout, arg);
+  }
+
+  /// \}
+
 protected:
   int nx_;
   int ndx_;
+  /// Defaults to ndx, i.e. no assumption on the structure of the manifold.
+  int non_euclidean_dim_;
 
   /// Perform the manifold integration operation.
   virtual void integrate_impl(const ConstVectorRef &x, const ConstVectorRef &v,
@@ -151,6 +198,21 @@ protected:
     integrate(x0, u * difference(x0, x1), out);
   }
 
+  /// Batched operations, by default looping over the knots. The scaled
+  /// increments are formed in a buffer on the stack, so that the integration
+  /// does not allocate.
+  virtual void integrateBatch_impl(const ConstMatrixRef &xs,
+                                   const ConstMatrixRef &vs,
+                                   const Scalar alpha, MatrixRef out) const;
+
+  virtual void differenceBatch_impl(const ConstMatrixRef &x0s,
+                                    const ConstMatrixRef &x1s,
+                                    MatrixRef out) const;
+
+  virtual void JdifferenceBatch_impl(const ConstMatrixRef &x0s,
+                                     const ConstMatrixRef &x1s, MatrixRef Jout,
+                                     int arg) const;
+
   virtual void neutral_impl(VectorRef out) const {
     assert(out.size() == nx());
     out.setZero();
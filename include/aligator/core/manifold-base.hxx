@@ -46,4 +46,39 @@ void ManifoldAbstractTpl<Scalar>::interpolate(const ConstVectorRef &x0,
   interpolate_impl(x0, x1, u, out);
 }
 
+/* Batched operations */
+
+template <typename Scalar>
+void ManifoldAbstractTpl<Scalar>::integrateBatch_impl(const ConstMatrixRef &xs,
+                                                      const ConstMatrixRef &vs,
+                                                      const Scalar alpha,
+                                                      MatrixRef out) const {
+  if (alpha == Scalar(1)) {
+    for (Eigen::Index i = 0; i < xs.cols(); i++)
+      integrate_impl(xs.col(i), vs.col(i), out.col(i));
+    return;
+  }
+  ALIGATOR_STACK_VECTOR(Scalar, v, ndx());
+  for (Eigen::Index i = 0; i < xs.cols(); i++) {
+    v = alpha * vs.col(i);
+    integrate_impl(xs.col(i), v, out.col(i));
+  }
+}
+
+template <typename Scalar>
+void ManifoldAbstractTpl<Scalar>::differenceBatch_impl(
+    const ConstMatrixRef &x0s, const ConstMatrixRef &x1s, MatrixRef out) const {
+  for (Eigen::Index i = 0; i < x0s.cols(); i++)
+    difference_impl(x0s.col(i), x1s.col(i), out.col(i));
+}
+
+template <typename Scalar>
+void ManifoldAbstractTpl<Scalar>::JdifferenceBatch_impl(
+    const ConstMatrixRef &x0s, const ConstMatrixRef &x1s, MatrixRef Jout,
+    int arg) const {
+  const int n = ndx();
+  for (Eigen::Index i = 0; i < x0s.cols(); i++)
+    Jdifference_impl(x0s.col(i), x1s.col(i), Jout.middleCols(i * n, n), arg);
+}
+
 } // namespace aligator
@@ -1,6 +1,7 @@
 /// @copyright Copyright (C) 2025 INRIA
 #pragma once
 
+#include <atomic>
 #include <memory_resource>
 
 namespace aligator {
@@ -8,7 +9,30 @@ namespace aligator {
 /// @brief A memory_resource wrapping around mimalloc.
 class mimalloc_resource : public std::pmr::memory_resource {
 public:
-  mimalloc_resource() = default;
+  /// @param count_bytes Whether to count the bytes allocated through this
+  /// resource, see bytes_allocated().
+  explicit mimalloc_resource(bool count_bytes = false) noexcept
+      : count_bytes_(count_bytes) {}
+
+  /// The copy starts from the byte count of @p other.
+  mimalloc_resource(const mimalloc_resource &other) noexcept
+      : std::pmr::memory_resource(other)
+      , count_bytes_(other.count_bytes_)
+      , bytes_allocated_(other.bytes_allocated()) {}
+
+  mimalloc_resource &operator=(const mimalloc_resource &other) noexcept {
+    count_bytes_ = other.count_bytes_;
+    bytes_allocated_.store(other.bytes_allocated(), std::memory_order_relaxed);
+    return *this;
+  }
+
+  /// Whether the allocated bytes are counted.
+  bool counts_bytes() const noexcept { return count_bytes_; }
+
+  /// Total number of bytes allocated through this resource, if counted.
+  size_t bytes_allocated() const noexcept {
+    return bytes_allocated_.load(std::memory_order_relaxed);
+  }
 
 private:
   [[nodiscard]] void *do_allocate(size_t bytes, size_t alignment) override;
@@ -19,6 +43,9 @@ private:
     // Check if 'other' is also a mimalloc_resource
     return dynamic_cast<const mimalloc_resource *>(&other) != nullptr;
   }
+
+  bool count_bytes_;
+  std::atomic<size_t> bytes_allocated_{0};
 };
 
 } // namespace aligator
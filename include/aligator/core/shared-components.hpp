@@ -0,0 +1,147 @@
+/// @file
+/// @brief Thin handles on functions, costs and dynamics shared between stages.
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/core/function-abstract.hpp"
+#include "aligator/core/cost-abstract.hpp"
+#include "aligator/core/explicit-dynamics.hpp"
+
+namespace aligator {
+
+/// @brief Stage function forwarding to a shared, immutable function.
+/// @details Copying it only copies the handle. Used by the stages which share
+/// their structure, see StageModelTpl::StageModelTpl(shared_ptr<const
+/// StageModelTpl>).
+template <typename _Scalar>
+struct SharedStageFunctionTpl : StageFunctionTpl<_Scalar> {
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = StageFunctionTpl<Scalar>;
+  using Data = StageFunctionDataTpl<Scalar>;
+
+  explicit SharedStageFunctionTpl(shared_ptr<const Base> func)
+      : Base(func->ndx1, func->nu, func->nr)
+      , func_(std::move(func)) {
+    this->jac_pattern = func_->jac_pattern;
+  }
+
+  void evaluate(const ConstVectorRef &x, const ConstVectorRef &u,
+                Data &data) const override {
+    func_->evaluate(x, u, data);
+  }
+
+  void computeJacobians(const ConstVectorRef &x, const ConstVectorRef &u,
+                        Data &data) const override {
+    func_->computeJacobians(x, u, data);
+  }
+
+  void computeVectorHessianProducts(const ConstVectorRef &x,
+                                    const ConstVectorRef &u,
+                                    const ConstVectorRef &lbda,
+                                    Data &data) const override {
+    func_->computeVectorHessianProducts(x, u, lbda, data);
+  }
+
+  shared_ptr<Data> createData() const override { return func_->createData(); }
+
+  void registerParameters(StageParametersTpl<Scalar> &params) const override {
+    func_->registerParameters(params);
+  }
+
+  bool hasConstantJacobians() const override {
+    return func_->hasConstantJacobians();
+  }
+
+  /// The shared function.
+  const Base &function() const { return *func_; }
+
+private:
+  shared_ptr<const Base> func_;
+};
+
+/// @brief Cost forwarding to a shared, immutable cost.
+template <typename _Scalar> struct SharedCostTpl : CostAbstractTpl<_Scalar> {
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = CostAbstractTpl<Scalar>;
+  using CostData = CostDataAbstractTpl<Scalar>;
+
+  explicit SharedCostTpl(shared_ptr<const Base> cost)
+      : Base(cost->space, cost->nu)
+      , cost_(std::move(cost)) {}
+
+  void evaluate(const ConstVectorRef &x, const ConstVectorRef &u,
+                CostData &data) const override {
+    cost_->evaluate(x, u, data);
+  }
+
+  void computeGradients(const ConstVectorRef &x, const ConstVectorRef &u,
+                        CostData &data) const override {
+    cost_->computeGradients(x, u, data);
+  }
+
+  void computeHessians(const ConstVectorRef &x, const ConstVectorRef &u,
+                       CostData &data) const override {
+    cost_->computeHessians(x, u, data);
+  }
+
+  shared_ptr<CostData> createData() const override {
+    return cost_->createData();
+  }
+
+  void registerParameters(StageParametersTpl<Scalar> &params) const override {
+    cost_->registerParameters(params);
+  }
+
+  bool hasConstantHessians() const override {
+    return cost_->hasConstantHessians();
+  }
+
+  /// The shared cost.
+  const Base &cost() const { return *cost_; }
+
+private:
+  shared_ptr<const Base> cost_;
+};
+
+/// @brief Explicit dynamics forwarding to shared, immutable dynamics.
+template <typename _Scalar>
+struct SharedExplicitDynamicsTpl : ExplicitDynamicsModelTpl<_Scalar> {
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = ExplicitDynamicsModelTpl<Scalar>;
+  using Data = ExplicitDynamicsDataTpl<Scalar>;
+
+  explicit SharedExplicitDynamicsTpl(shared_ptr<const Base> dynamics)
+      : Base(dynamics->space_, dynamics->nu)
+      , dynamics_(std::move(dynamics)) {
+    this->space_next_ = dynamics_->space_next_;
+  }
+
+  void forward(const ConstVectorRef &x, const ConstVectorRef &u,
+               Data &data) const override {
+    dynamics_->forward(x, u, data);
+  }
+
+  void dForward(const ConstVectorRef &x, const ConstVectorRef &u,
+                Data &data) const override {
+    dynamics_->dForward(x, u, data);
+  }
+
+  shared_ptr<Data> createData() const override {
+    return dynamics_->createData();
+  }
+
+  bool hasConstantJacobians() const override {
+    return dynamics_->hasConstantJacobians();
+  }
+
+  /// The shared dynamics.
+  const Base &dynamics() const { return *dynamics_; }
+
+private:
+  shared_ptr<const Base> dynamics_;
+};
+
+} // namespace aligator
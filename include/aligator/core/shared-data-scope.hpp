@@ -0,0 +1,93 @@
+/// @file
+/// @brief Registry of objects shared by the function datas of a stage.
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/fwd.hpp"
+#include "aligator/core/allocator.hpp"
+
+#include <typeindex>
+#include <vector>
+
+namespace aligator {
+
+/// @brief Registry of objects shared between the datas of the functions of a
+/// single stage.
+///
+/// @details StageDataTpl (and TrajOptDataTpl, for the terminal cost and
+/// constraints) opens a scope around the creation of its cost, dynamics and
+/// constraint datas. While the scope is open, data constructors can fetch an
+/// object already created by another function of the same stage through
+/// current(), e.g. a kinematics cache. Outside of any scope, current() returns
+/// nullptr and every data owns its own objects.
+///
+/// A scope can also carry an arena, a memory resource from which the datas
+/// created in the scope allocate their buffers (see dataAllocator()), so that
+/// the buffers of a stage are laid out contiguously.
+///
+/// Scopes nest, and are local to the thread which creates them. A nested
+/// scope uses the arena of the enclosing one unless given its own.
+class SharedDataScope {
+public:
+  SharedDataScope() noexcept
+      : arena_(current_ ? current_->arena_ : nullptr)
+      , prev_(current_) {
+    current_ = this;
+  }
+  explicit SharedDataScope(
+      shared_ptr<std::pmr::memory_resource> arena) noexcept
+      : arena_(std::move(arena))
+      , prev_(current_) {
+    current_ = this;
+  }
+  SharedDataScope(const SharedDataScope &) = delete;
+  SharedDataScope &operator=(const SharedDataScope &) = delete;
+  ~SharedDataScope() { current_ = prev_; }
+
+  /// Innermost open scope on this thread, or nullptr.
+  static SharedDataScope *current() noexcept { return current_; }
+
+  /// @brief Get the registered object of type @p T whose key satisfies @p
+  /// match, or create and register one using @p make.
+  /// @param key Key stored alongside a newly created object, passed back to
+  /// @p match. It must remain valid until the scope closes.
+  template <typename T, typename Match, typename Make>
+  shared_ptr<T> getOrCreate(const void *key, Match &&match, Make &&make) {
+    const std::type_index type{typeid(T)};
+    for (const Entry &e : entries_) {
+      if (e.type == type && match(e.key))
+        return std::static_pointer_cast<T>(e.object);
+    }
+    shared_ptr<T> obj = make();
+    entries_.push_back({type, key, obj});
+    return obj;
+  }
+
+  std::size_t size() const noexcept { return entries_.size(); }
+
+  /// Arena of the innermost open scope on this thread, or nullptr.
+  static shared_ptr<std::pmr::memory_resource> currentArena() {
+    return current_ ? current_->arena_ : nullptr;
+  }
+
+private:
+  struct Entry {
+    std::type_index type;
+    const void *key;
+    shared_ptr<void> object;
+  };
+  std::vector<Entry> entries_;
+  shared_ptr<std::pmr::memory_resource> arena_;
+  SharedDataScope *prev_;
+  inline static thread_local SharedDataScope *current_ = nullptr;
+};
+
+/// @brief Allocator for the buffers of a data holding @p arena (e.g. from
+/// SharedDataScope::currentArena()), using the default memory resource if
+/// @p arena is null.
+inline polymorphic_allocator
+dataAllocator(const shared_ptr<std::pmr::memory_resource> &arena) noexcept {
+  return arena ? polymorphic_allocator(arena.get()) : polymorphic_allocator();
+}
+
+} // namespace aligator
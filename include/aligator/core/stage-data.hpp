@@ -3,6 +3,9 @@
 #pragma once
 
 #include "aligator/context.hpp"
+#include "aligator/core/stage-parameters.hpp"
+
+#include <memory_resource>
 
 namespace aligator {
 
@@ -22,6 +25,26 @@ template <typename _Scalar> struct StageDataTpl {
   shared_ptr<CostData> cost_data;
   // Data for the system dynamics.
   shared_ptr<DynamicsData> dynamics_data;
+  /// Arena holding the buffers of the function datas if
+  /// StageModelTpl::use_data_arena_ is set, or nullptr. It is shared with the
+  /// datas, and lives as long as any of them.
+  shared_ptr<std::pmr::memory_resource> arena;
+  /// Parameters of the stage this data is evaluated with, shared with the
+  /// function datas.
+  shared_ptr<StageParameterBindingTpl<Scalar>> parameter_binding;
+  /// Reuse the constant derivatives of the stage (see
+  /// StageFunctionTpl::hasConstantJacobians() and
+  /// CostAbstractTpl::hasConstantHessians()) once computed in this data. The
+  /// solvers enable this for the duration of a solve.
+  bool cache_constant_derivatives = false;
+  /// Whether the constant Jacobians of the dynamics and constraints are
+  /// stored in this data.
+  bool constant_jacobians_ready = false;
+  /// Whether the constant cost Hessian is stored in this data.
+  bool constant_hessians_ready = false;
+  /// Whether the stage dynamics have constant Jacobians, see
+  /// ExplicitDynamicsModelTpl::hasConstantJacobians().
+  bool constant_dynamics_jacobians = false;
 
   /// @brief    Constructor.
   ///
@@ -31,6 +54,14 @@ template <typename _Scalar> struct StageDataTpl {
 
   virtual ~StageDataTpl() = default;
 
+  /// @brief Drop the cached constant derivatives, and enable or disable the
+  /// caching.
+  void resetConstantDerivatives(bool enable) {
+    cache_constant_derivatives = enable;
+    constant_jacobians_ready = false;
+    constant_hessians_ready = false;
+  }
+
   /// @brief Check data integrity.
   virtual void checkData() {
     constexpr std::string_view msg = "StageData integrity check failed.";
@@ -4,14 +4,29 @@
 #include "stage-model.hpp"
 #include "explicit-dynamics.hpp"
 #include "cost-abstract.hpp"
+#include "shared-data-scope.hpp"
 
 namespace aligator {
 
 template <typename Scalar>
 StageDataTpl<Scalar>::StageDataTpl(const StageModel &stage_model)
-    : constraint_data(stage_model.numConstraints())
-    , cost_data(stage_model.cost_->createData())
-    , dynamics_data(stage_model.dynamics_->createData()) {
+    : constraint_data(stage_model.numConstraints()) {
+  if (stage_model.use_data_arena_) {
+    // grows past the size hint for the datas of derived types, e.g. the
+    // components of a cost stack
+    arena = std::make_shared<std::pmr::monotonic_buffer_resource>(
+        stage_model.dataArenaSizeHint());
+  }
+  // datas created in this scope can share objects, e.g. kinematics caches
+  SharedDataScope scope(arena);
+  using Binding = StageParameterBindingTpl<Scalar>;
+  parameter_binding = scope.getOrCreate<Binding>(
+      &stage_model, [](const void *) { return true; },
+      [] { return std::make_shared<Binding>(); });
+  parameter_binding->parameters = &stage_model.parameters_;
+  cost_data = stage_model.cost_->createData();
+  dynamics_data = stage_model.dynamics_->createData();
+  constant_dynamics_jacobians = stage_model.dynamics_->hasConstantJacobians();
   const std::size_t nc = stage_model.numConstraints();
 
   for (std::size_t j = 0; j < nc; j++) {
@@ -4,6 +4,7 @@
 
 #include "aligator/core/function-abstract.hpp"
 #include "aligator/core/constraint.hpp"
+#include "aligator/core/stage-parameters.hpp"
 #include <fmt/format.h>
 
 namespace aligator {
@@ -47,34 +48,73 @@ public:
   PolyCost cost_;
   /// Dynamics model
   PolyDynamics dynamics_;
+  /// Parameters read by the functions of the stage, see StageParametersTpl.
+  StageParametersTpl<Scalar> parameters_;
+  /// @brief Allocate the buffers of the datas of this stage (function values
+  /// and Jacobians, cost gradients and Hessians, next states) from a single
+  /// arena per StageDataTpl, one after the other, instead of the heap.
+  bool use_data_arena_ = false;
 
   /// @brief Get a pointer to an expected concrete type for the cost function.
+  /// @details For a stage sharing the structure of another, the shared cost
+  /// cannot be modified: this throws if only the shared cost has type @p U,
+  /// use the const overload or the stage parameters instead.
   template <typename U> U *getCost() {
     ALIGATOR_CHECK_DERIVED_CLASS(Cost, U);
-    return dynamic_cast<U *>(&*cost_);
+    U *cost = dynamic_cast<U *>(&*cost_);
+    if (cost == nullptr && dynamic_cast<const U *>(&sharedCost()))
+      ALIGATOR_RUNTIME_ERROR("The cost of this stage is shared with other "
+                             "stages and cannot be modified.");
+    return cost;
   }
 
   /// @copybrief castCost()
+  /// @details For a stage sharing the structure of another, this resolves the
+  /// shared cost.
   template <typename U> const U *getCost() const {
     ALIGATOR_CHECK_DERIVED_CLASS(Cost, U);
-    return dynamic_cast<const U *>(&*cost_);
+    if (const U *cost = dynamic_cast<const U *>(&*cost_))
+      return cost;
+    return dynamic_cast<const U *>(&sharedCost());
   }
 
   /// @brief Get a pointer to an expected concrete type for the dynamics class.
+  /// @details Same as getCost() for a stage sharing the structure of another.
   template <typename U> U *getDynamics() {
     ALIGATOR_CHECK_DERIVED_CLASS(Dynamics, U);
-    return dynamic_cast<U *>(&*dynamics_);
+    U *dynamics = dynamic_cast<U *>(&*dynamics_);
+    if (dynamics == nullptr && dynamic_cast<const U *>(&sharedDynamics()))
+      ALIGATOR_RUNTIME_ERROR("The dynamics of this stage are shared with other "
+                             "stages and cannot be modified.");
+    return dynamics;
   }
 
   /// @copybrief castDynamics()
   template <typename U> const U *getDynamics() const {
     ALIGATOR_CHECK_DERIVED_CLASS(Dynamics, U);
-    return dynamic_cast<const U *>(&*dynamics_);
+    if (const U *dynamics = dynamic_cast<const U *>(&*dynamics_))
+      return dynamics;
+    return dynamic_cast<const U *>(&sharedDynamics());
   }
 
+  /// The cost of the stage this one shares its structure with, or cost_.
+  const Cost &sharedCost() const;
+  /// The dynamics of the stage this one shares its structure with, or
+  /// dynamics_.
+  const Dynamics &sharedDynamics() const;
+
   /// Constructor assumes the control space is a Euclidean space of
   /// dimension @p nu.
   StageModelTpl(const PolyCost &cost, const PolyDynamics &dynamics);
+
+  /// @brief Stage sharing the functions of @p structure, which must not be
+  /// modified afterwards.
+  /// @details The cost, dynamics and constraint functions are thin handles on
+  /// those of @p structure (see SharedCostTpl), so that copying this stage is
+  /// cheap. The parameters are copied: stages of a problem built this way
+  /// only differ by their parameters_. The const overloads of getCost<T>()
+  /// and getDynamics<T>() return the shared functions.
+  explicit StageModelTpl(const shared_ptr<const StageModelTpl> &structure);
   virtual ~StageModelTpl() = default;
 
   const Manifold &xspace() const { return *xspace_; }
@@ -105,10 +145,19 @@ public:
   void addConstraint(const PolyFunction &func,
                      const PolyConstraintSet &cstr_set);
 
+  /// @brief Declare the parameter slots read by the cost and constraints in
+  /// parameters_, keeping the values of existing slots.
+  /// @details Called on construction and by addConstraint(). Call it again
+  /// after telling a function of the stage to read a new slot.
+  void registerParameters();
+
   /* Evaluate costs, constraints, ... */
 
   /// @brief    Evaluate all the functions (cost, dynamics, constraints) at this
   /// node.
+  /// @details The dynamics are evaluated first, so that the quantities they
+  /// share through the stage data (see SharedDataScope) can be reused by the
+  /// constraints and costs. The same holds for the derivatives.
   virtual void evaluate(const ConstVectorRef &x, const ConstVectorRef &u,
                         Data &data) const;
 
@@ -124,6 +173,11 @@ public:
 
   /// @brief    Create a StageData object.
   virtual shared_ptr<Data> createData() const;
+
+  /// @brief Size in bytes of the buffers allocated by the base datas of the
+  /// cost, dynamics and constraints, used as the initial size of the data
+  /// arena (see use_data_arena_).
+  std::size_t dataArenaSizeHint() const;
 };
 
 #ifdef ALIGATOR_ENABLE_TEMPLATE_INSTANTIATION
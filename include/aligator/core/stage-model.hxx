@@ -6,6 +6,7 @@
 #include "aligator/core/stage-data.hpp"
 #include "aligator/core/explicit-dynamics.hpp"
 #include "aligator/core/cost-abstract.hpp"
+#include "aligator/core/shared-components.hpp"
 #include "aligator/core/vector-space.hpp"
 #include "aligator/tracy.hpp"
 
@@ -25,6 +26,28 @@ StageModelTpl<Scalar>::StageModelTpl(const PolyCost &cost,
         "Inconsistent control dimension cost.nu ({:d}) and dynamics.nu ({:d}).",
         cost->nu, dynamics->nu);
   }
+  registerParameters();
+}
+
+template <typename Scalar>
+StageModelTpl<Scalar>::StageModelTpl(
+    const shared_ptr<const StageModelTpl> &structure)
+    : xspace_(structure->xspace_)
+    , xspace_next_(structure->xspace_next_)
+    , uspace_(structure->uspace_)
+    , cost_(SharedCostTpl<Scalar>(
+          shared_ptr<const Cost>(structure, &*structure->cost_)))
+    , dynamics_(SharedExplicitDynamicsTpl<Scalar>(
+          shared_ptr<const Dynamics>(structure, &*structure->dynamics_)))
+    , parameters_(structure->parameters_)
+    , use_data_arena_(structure->use_data_arena_) {
+  using StageFunction = StageFunctionTpl<Scalar>;
+  const ConstraintStackTpl<Scalar> &cstrs = structure->constraints_;
+  for (std::size_t j = 0; j < cstrs.size(); j++) {
+    shared_ptr<const StageFunction> func(structure, &*cstrs.funcs[j]);
+    constraints_.pushBack(SharedStageFunctionTpl<Scalar>(std::move(func)),
+                          cstrs.sets[j]);
+  }
 }
 
 template <typename Scalar>
@@ -36,6 +59,13 @@ void StageModelTpl<Scalar>::addConstraint(const PolyFunction &func,
         func->nu, this->nu());
   }
   constraints_.pushBack(func, cstr_set);
+  func->registerParameters(parameters_);
+}
+
+template <typename Scalar> void StageModelTpl<Scalar>::registerParameters() {
+  cost_->registerParameters(parameters_);
+  for (std::size_t j = 0; j < numConstraints(); j++)
+    constraints_.funcs[j]->registerParameters(parameters_);
 }
 
 template <typename Scalar>
@@ -43,6 +73,8 @@ void StageModelTpl<Scalar>::evaluate(const ConstVectorRef &x,
                                      const ConstVectorRef &u,
                                      Data &data) const {
   ALIGATOR_TRACY_ZONE_SCOPED_N("StageModel::evaluate");
+  data.parameter_binding->parameters = &parameters_;
+  // dynamics first: they publish their results to the shared stage data
   dynamics_->forward(x, u, *data.dynamics_data);
   for (std::size_t j = 0; j < numConstraints(); j++) {
     constraints_.funcs[j]->evaluate(x, u, *data.constraint_data[j]);
@@ -54,10 +86,16 @@ template <typename Scalar>
 void StageModelTpl<Scalar>::computeFirstOrderDerivatives(
     const ConstVectorRef &x, const ConstVectorRef &u, Data &data) const {
   ALIGATOR_TRACY_ZONE_SCOPED_N("StageModel::computeFirstOrderDerivatives");
-  dynamics_->dForward(x, u, *data.dynamics_data);
+  data.parameter_binding->parameters = &parameters_;
+  const bool cached = data.constant_jacobians_ready;
+  if (!cached || !dynamics_->hasConstantJacobians())
+    dynamics_->dForward(x, u, *data.dynamics_data);
   for (std::size_t j = 0; j < numConstraints(); j++) {
-    constraints_.funcs[j]->computeJacobians(x, u, *data.constraint_data[j]);
+    const auto &func = constraints_.funcs[j];
+    if (!cached || !func->hasConstantJacobians())
+      func->computeJacobians(x, u, *data.constraint_data[j]);
   }
+  data.constant_jacobians_ready = data.cache_constant_derivatives;
   cost_->computeGradients(x, u, *data.cost_data);
 }
 
@@ -65,7 +103,10 @@ template <typename Scalar>
 void StageModelTpl<Scalar>::computeSecondOrderDerivatives(
     const ConstVectorRef &x, const ConstVectorRef &u, Data &data) const {
   ALIGATOR_TRACY_ZONE_SCOPED_N("StageModel::computeSecondOrderDerivatives");
-  cost_->computeHessians(x, u, *data.cost_data);
+  data.parameter_binding->parameters = &parameters_;
+  if (!data.constant_hessians_ready || !cost_->hasConstantHessians())
+    cost_->computeHessians(x, u, *data.cost_data);
+  data.constant_hessians_ready = data.cache_constant_derivatives;
 }
 
 template <typename Scalar>
@@ -73,4 +114,44 @@ auto StageModelTpl<Scalar>::createData() const -> shared_ptr<Data> {
   return std::make_shared<Data>(*this);
 }
 
+template <typename Scalar>
+auto StageModelTpl<Scalar>::sharedCost() const -> const Cost & {
+  if (const auto *shared = dynamic_cast<const SharedCostTpl<Scalar> *>(&*cost_))
+    return shared->cost();
+  return *cost_;
+}
+
+template <typename Scalar>
+auto StageModelTpl<Scalar>::sharedDynamics() const -> const Dynamics & {
+  using SharedDynamics = SharedExplicitDynamicsTpl<Scalar>;
+  if (const auto *shared = dynamic_cast<const SharedDynamics *>(&*dynamics_))
+    return shared->dynamics();
+  return *dynamics_;
+}
+
+template <typename Scalar>
+std::size_t StageModelTpl<Scalar>::dataArenaSizeHint() const {
+  // each buffer is padded to the alignment of the arena matrices
+  const auto buffer_size = [](const long size) {
+    constexpr std::size_t align =
+        std::max<std::size_t>(EIGEN_DEFAULT_ALIGN_BYTES, alignof(Scalar));
+    const std::size_t bytes = std::size_t(size) * sizeof(Scalar);
+    return (bytes + align - 1) / align * align;
+  };
+  const long nx = nx2(), ndx = ndx1(), ndxn = ndx2(), nvar = ndx1() + nu();
+  // cost: gradient and Hessian
+  std::size_t size = buffer_size(nvar) + buffer_size(nvar * nvar);
+  // dynamics: next state, Jacobians and vector-Hessian products
+  size += buffer_size(nx) + buffer_size(ndxn * nvar) +
+          buffer_size(ndxn * ndxn) + buffer_size(ndx * ndx) +
+          buffer_size(ndx * nu()) + buffer_size(nu() * nu());
+  // constraints: values, Jacobians and vector-Hessian products
+  for (std::size_t j = 0; j < numConstraints(); j++) {
+    const long nr = constraints_.funcs[j]->nr;
+    size += buffer_size(nr) + buffer_size(nr * nvar) +
+            buffer_size(nvar * nvar);
+  }
+  return size;
+}
+
 } // namespace aligator
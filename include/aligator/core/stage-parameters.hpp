@@ -0,0 +1,202 @@
+/// @file
+/// @brief Per-stage parameters (targets, weights...) read by the functions at
+/// evaluation time.
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/context.hpp"
+#include "aligator/core/shared-data-scope.hpp"
+#include "aligator/utils/exceptions.hpp"
+
+#include <string>
+#include <vector>
+
+namespace aligator {
+
+/// @brief Named parameters of a stage, stored contiguously in a flat vector.
+///
+/// @details Each slot is a named segment of values(). Functions which support
+/// it can be told to read, e.g., their target from a slot of the parameters of
+/// the stage they are evaluated in (see StageParameterViewTpl) instead of their
+/// own member. This allows the stages of a problem to share their structure
+/// (see StageModelTpl::StageModelTpl(shared_ptr<const StageModelTpl>)) and
+/// only differ by their parameters.
+template <typename _Scalar> struct StageParametersTpl {
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+
+  struct Slot {
+    std::string name;
+    Eigen::Index offset;
+    Eigen::Index size;
+  };
+
+  /// @brief Add a slot @p name, initialized to @p value.
+  /// @returns The index of the slot.
+  std::size_t addSlot(const std::string &name, const ConstVectorRef &value) {
+    if (findSlot(name) != npos)
+      ALIGATOR_RUNTIME_ERROR("Parameter slot '{}' already exists.", name);
+    const Eigen::Index offset = values_.size();
+    values_.conservativeResize(offset + value.size());
+    values_.tail(value.size()) = value;
+    slots_.push_back({name, offset, value.size()});
+    return slots_.size() - 1;
+  }
+
+  /// @brief Add slot @p name if it does not exist yet, see addSlot().
+  /// @details Used by the functions to declare the slots they read, several
+  /// functions can read the same slot.
+  /// @returns The index of the slot.
+  std::size_t declareSlot(const std::string &name,
+                          const ConstVectorRef &value) {
+    const std::size_t i = findSlot(name);
+    if (i == npos)
+      return addSlot(name, value);
+    if (slots_[i].size != value.size())
+      ALIGATOR_RUNTIME_ERROR("Parameter slot '{}' has size {:d}, cannot "
+                             "declare it with size {:d}.",
+                             name, slots_[i].size, value.size());
+    return i;
+  }
+
+  /// Index of slot @p name, or npos.
+  std::size_t findSlot(const std::string &name) const {
+    for (std::size_t i = 0; i < slots_.size(); i++) {
+      if (slots_[i].name == name)
+        return i;
+    }
+    return npos;
+  }
+
+  bool hasSlot(const std::string &name) const { return findSlot(name) != npos; }
+
+  const Slot &slot(const std::string &name) const {
+    const std::size_t i = findSlot(name);
+    if (i == npos)
+      ALIGATOR_RUNTIME_ERROR("No parameter slot named '{}'.", name);
+    return slots_[i];
+  }
+
+  /// Values of slot @p name.
+  VectorRef operator[](const std::string &name) {
+    const Slot &s = slot(name);
+    return values_.segment(s.offset, s.size);
+  }
+  ConstVectorRef operator[](const std::string &name) const {
+    const Slot &s = slot(name);
+    return values_.segment(s.offset, s.size);
+  }
+
+  /// Flat vector of the values of all the slots.
+  VectorRef values() { return values_; }
+  ConstVectorRef values() const { return values_; }
+
+  const std::vector<Slot> &slots() const { return slots_; }
+  std::size_t numSlots() const { return slots_.size(); }
+  /// Total number of parameters.
+  Eigen::Index size() const { return values_.size(); }
+
+  /// Whether @p other has the same slots, i.e. the same layout.
+  bool sameLayout(const StageParametersTpl &other) const {
+    if (slots_.size() != other.slots_.size())
+      return false;
+    for (std::size_t i = 0; i < slots_.size(); i++) {
+      const Slot &a = slots_[i];
+      const Slot &b = other.slots_[i];
+      if (a.name != b.name || a.offset != b.offset || a.size != b.size)
+        return false;
+    }
+    return true;
+  }
+
+  static constexpr std::size_t npos = std::size_t(-1);
+
+private:
+  std::vector<Slot> slots_;
+  VectorXs values_;
+};
+
+/// @brief Parameters of the stage a StageDataTpl is evaluated with.
+/// @details Created by StageDataTpl, and shared with the function datas
+/// through the SharedDataScope. StageModelTpl points it to its own parameters
+/// before evaluating its functions.
+template <typename Scalar> struct StageParameterBindingTpl {
+  const StageParametersTpl<Scalar> *parameters = nullptr;
+};
+
+/// @brief Read access of a function data to a slot of the stage parameters.
+///
+/// @details The view is bound when the function data is created within a
+/// StageDataTpl. The slot is then resolved in the parameters of the stage the
+/// data is evaluated with: its index is cached, and looked up again by name if
+/// that stage has a different layout. Outside of a stage, or if no slot name
+/// is given, the view is unbound and valueOr() returns the function's own
+/// value.
+template <typename _Scalar> struct StageParameterViewTpl {
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Binding = StageParameterBindingTpl<Scalar>;
+  using Parameters = StageParametersTpl<Scalar>;
+
+  StageParameterViewTpl() = default;
+
+  /// @brief Bind to slot @p name of the parameters of the stage whose data is
+  /// being created.
+  /// @param size Expected size of the slot.
+  StageParameterViewTpl(const std::string &name, const Eigen::Index size)
+      : name_(name)
+      , size_(size) {
+    SharedDataScope *scope = SharedDataScope::current();
+    if (name.empty() || scope == nullptr)
+      return;
+    binding_ = scope->template getOrCreate<Binding>(
+        nullptr, [](const void *) { return true; },
+        [] { return std::make_shared<Binding>(); });
+    if (binding_->parameters == nullptr) {
+      // e.g. terminal cost: there are no stage parameters
+      binding_.reset();
+      return;
+    }
+    resolve(*binding_->parameters);
+  }
+
+  bool isBound() const { return binding_ && binding_->parameters; }
+
+  /// Value of the slot, the view must be bound.
+  ConstVectorRef value() const {
+    assert(isBound());
+    const Parameters &params = *binding_->parameters;
+    if (index_ >= params.numSlots() || params.slots()[index_].name != name_ ||
+        params.slots()[index_].size != size_)
+      resolve(params);
+    const typename Parameters::Slot &slot = params.slots()[index_];
+    return params.values().segment(slot.offset, slot.size);
+  }
+
+  /// Value of the slot, or @p fallback if the view is unbound.
+  ConstVectorRef valueOr(const ConstVectorRef &fallback) const {
+    if (!isBound())
+      return fallback;
+    return value();
+  }
+
+private:
+  /// Look up the slot in @p params and check its size.
+  void resolve(const Parameters &params) const {
+    const std::size_t i = params.findSlot(name_);
+    if (i == Parameters::npos)
+      ALIGATOR_RUNTIME_ERROR("No parameter slot named '{}'.", name_);
+    if (params.slots()[i].size != size_)
+      ALIGATOR_RUNTIME_ERROR(
+          "Parameter slot '{}' has size {:d}, expected {:d}.", name_,
+          params.slots()[i].size, size_);
+    index_ = i;
+  }
+
+  shared_ptr<Binding> binding_;
+  std::string name_;
+  Eigen::Index size_ = 0;
+  mutable std::size_t index_ = 0;
+};
+
+} // namespace aligator
@@ -25,9 +25,18 @@ template <typename _Scalar> struct TrajOptDataTpl {
   shared_ptr<CostData> term_cost_data;
   /// Terminal constraint data.
   std::vector<shared_ptr<StageFunctionData>> term_cstr_data;
+  /// Reuse the constant Hessian of the terminal cost once computed, see
+  /// StageDataTpl::cache_constant_derivatives.
+  bool cache_constant_derivatives = false;
+  /// Whether the constant terminal cost Hessian is stored in term_cost_data.
+  bool term_constant_hessians_ready = false;
 
   inline std::size_t numSteps() const { return stage_data.size(); }
 
+  /// @brief Drop the cached constant derivatives of all the stages and of the
+  /// terminal cost, and enable or disable the caching.
+  void resetConstantDerivatives(bool enable);
+
   TrajOptDataTpl() = default;
   TrajOptDataTpl(const TrajOptProblemTpl<Scalar> &problem);
 };
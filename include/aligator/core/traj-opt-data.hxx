@@ -6,6 +6,7 @@
 #include "aligator/core/traj-opt-problem.hpp"
 #include "stage-data.hpp"
 #include "cost-abstract.hpp"
+#include "shared-data-scope.hpp"
 #include "aligator/tracy.hpp"
 
 namespace aligator {
@@ -18,6 +19,8 @@ TrajOptDataTpl<Scalar>::TrajOptDataTpl(const TrajOptProblemTpl<Scalar> &problem)
     stage_data.push_back(problem.stages_[i]->createData());
     stage_data[i]->checkData();
   }
+  // the terminal cost and constraints share objects, like stages do
+  SharedDataScope scope;
   term_cost_data = problem.term_cost_->createData();
 
   if (!problem.term_cstrs_.empty())
@@ -28,6 +31,14 @@ TrajOptDataTpl<Scalar>::TrajOptDataTpl(const TrajOptProblemTpl<Scalar> &problem)
   }
 }
 
+template <typename Scalar>
+void TrajOptDataTpl<Scalar>::resetConstantDerivatives(bool enable) {
+  for (auto &sd : stage_data)
+    sd->resetConstantDerivatives(enable);
+  cache_constant_derivatives = enable;
+  term_constant_hessians_ready = false;
+}
+
 template <typename Scalar>
 Scalar computeTrajectoryCost(const TrajOptDataTpl<Scalar> &problem_data) {
   ALIGATOR_NOMALLOC_SCOPED;
@@ -112,6 +112,7 @@ template <typename _Scalar> struct TrajOptProblemTpl {
   using Manifold = ManifoldAbstractTpl<Scalar>;
   using CostAbstract = CostAbstractTpl<Scalar>;
   using ConstraintSet = ConstraintSetTpl<Scalar>;
+  using StageParameters = StageParametersTpl<Scalar>;
   using StateErrorResidual = StateErrorResidualTpl<Scalar>;
   using InitializationStrategy =
       std::function<void(const Self &, std::vector<VectorXs> &)>;
@@ -191,6 +192,34 @@ template <typename _Scalar> struct TrajOptProblemTpl {
 
   [[nodiscard]] std::size_t numSteps() const;
 
+  /// @name Stage parameters
+  /// @brief Targets, weights... read by the functions of each stage, see
+  /// StageParametersTpl. The functions declare their slots when added to a
+  /// stage.
+  /// @{
+
+  /// @brief Parameters of stage @p i.
+  StageParameters &getStageParameters(std::size_t i) {
+    return stages_.at(i)->parameters_;
+  }
+  const StageParameters &getStageParameters(std::size_t i) const {
+    return stages_.at(i)->parameters_;
+  }
+
+  /// @brief Overwrite the parameters of stage @p i with the flat vector
+  /// @p values, laid out as StageParametersTpl::values(). Does not allocate.
+  void setStageParameters(std::size_t i, const ConstVectorRef &values);
+
+  /// @brief Set slot @p name of the parameters of stage @p i.
+  void setStageParameter(std::size_t i, const std::string &name,
+                         const ConstVectorRef &value);
+
+  /// @brief Declare the slots read by the functions of every stage, e.g.
+  /// after telling a function to read a new slot.
+  /// @sa StageModelTpl::registerParameters()
+  void registerParameters();
+  /// @}
+
   /// @brief Rollout the problem costs, constraints, dynamics, stage per stage.
   Scalar evaluate(const std::vector<VectorXs> &xs,
                   const std::vector<VectorXs> &us, Data &prob_data,
@@ -112,7 +112,12 @@ void TrajOptProblemTpl<Scalar>::computeDerivatives(
 
   term_cost_->computeGradients(xs[nsteps], unone_, *prob_data.term_cost_data);
   if (compute_second_order) {
-    term_cost_->computeHessians(xs[nsteps], unone_, *prob_data.term_cost_data);
+    if (!prob_data.term_constant_hessians_ready ||
+        !term_cost_->hasConstantHessians())
+      term_cost_->computeHessians(xs[nsteps], unone_,
+                                  *prob_data.term_cost_data);
+    prob_data.term_constant_hessians_ready =
+        prob_data.cache_constant_derivatives;
   }
 
   for (std::size_t k = 0; k < term_cstrs_.size(); ++k) {
@@ -128,6 +133,34 @@ void TrajOptProblemTpl<Scalar>::addStage(
   stages_.push_back(stage);
 }
 
+template <typename Scalar>
+void TrajOptProblemTpl<Scalar>::setStageParameters(
+    std::size_t i, const ConstVectorRef &values) {
+  StageParameters &params = getStageParameters(i);
+  if (values.size() != params.size())
+    ALIGATOR_RUNTIME_ERROR(
+        "Wrong size for the parameters of stage {:d} (got {:d}, expected {:d})",
+        i, values.size(), params.size());
+  params.values() = values;
+}
+
+template <typename Scalar>
+void TrajOptProblemTpl<Scalar>::setStageParameter(
+    std::size_t i, const std::string &name, const ConstVectorRef &value) {
+  VectorRef slot = getStageParameters(i)[name];
+  if (value.size() != slot.size())
+    ALIGATOR_RUNTIME_ERROR(
+        "Wrong size for parameter '{}' of stage {:d} (got {:d}, expected {:d})",
+        name, i, value.size(), slot.size());
+  slot = value;
+}
+
+template <typename Scalar>
+void TrajOptProblemTpl<Scalar>::registerParameters() {
+  for (std::size_t i = 0; i < stages_.size(); i++)
+    stages_[i]->registerParameters();
+}
+
 template <typename Scalar>
 bool TrajOptProblemTpl<Scalar>::checkIntegrity() const {
   bool ok = true;
@@ -15,7 +15,11 @@ struct UnaryFunctionTpl : StageFunctionTpl<_Scalar> {
   using Base = StageFunctionTpl<Scalar>;
   using Data = StageFunctionDataTpl<Scalar>;
 
-  using Base::Base;
+  UnaryFunctionTpl(const int ndx, const int nu, const int nr)
+      : Base(ndx, nu, nr) {
+    // does not depend on u
+    this->jac_pattern.u_size = 0;
+  }
 
   virtual void evaluate(const ConstVectorRef &x, Data &data) const = 0;
   virtual void computeJacobians(const ConstVectorRef &x, Data &data) const = 0;
@@ -24,6 +24,7 @@ struct VectorSpaceTpl : ManifoldAbstractTpl<_Scalar> {
     static_assert(
         Dim == Eigen::Dynamic,
         "This constructor is only valid if the dimension is dynamic.");
+    this->non_euclidean_dim_ = 0;
   }
 
   int dim() const { return this->nx_; }
@@ -35,13 +36,16 @@ struct VectorSpaceTpl : ManifoldAbstractTpl<_Scalar> {
   template <int N = Dim,
             typename = typename std::enable_if_t<N != Eigen::Dynamic>>
   explicit VectorSpaceTpl()
-      : Base(Dim, Dim) {}
+      : Base(Dim, Dim) {
+    this->non_euclidean_dim_ = 0;
+  }
 
   /// Build from VectorSpaceTpl of different dimension
   template <int OtherDim>
   VectorSpaceTpl(const VectorSpaceTpl<Scalar, OtherDim> &other)
       : Base(other.nx_, other.nx_) {
     static_assert((Dim == OtherDim) || (Dim == Eigen::Dynamic));
+    this->non_euclidean_dim_ = 0;
   }
 
 protected:
@@ -87,6 +91,28 @@ protected:
                         const Scalar &u, VectorRef out) const {
     out = u * x1 + (static_cast<Scalar>(1.) - u) * x0;
   }
+
+  /* Batched operations, on all the knots at once */
+
+  void integrateBatch_impl(const ConstMatrixRef &xs, const ConstMatrixRef &vs,
+                           const Scalar alpha, MatrixRef out) const {
+    out = xs + alpha * vs;
+  }
+
+  void differenceBatch_impl(const ConstMatrixRef &x0s,
+                            const ConstMatrixRef &x1s, MatrixRef out) const {
+    out = x1s - x0s;
+  }
+
+  void JdifferenceBatch_impl(const ConstMatrixRef &x0s, const ConstMatrixRef &,
+                             MatrixRef Jout, int arg) const {
+    if (arg != 0 && arg != 1)
+      ALIGATOR_DOMAIN_ERROR("Wrong arg value.");
+    const int n = ndx();
+    Jout.setZero();
+    for (Eigen::Index i = 0; i < x0s.cols(); i++)
+      Jout.middleCols(i * n, n).diagonal().setConstant(arg == 0 ? -1 : 1);
+  }
 };
 
 } // namespace aligator
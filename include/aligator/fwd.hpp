@@ -24,8 +24,6 @@
   if (::aligator::math::check_value(value))                                    \
   ALIGATOR_RUNTIME_ERROR("Encountered NaN for variable {:s}\n", name)
 
-#define ALIGATOR_INLINE inline __attribute__((always_inline))
-
 /// \brief macros for pragma push/pop/ignore deprecated warnings
 #if defined(__GNUC__) || defined(__clang__)
 #define ALIGATOR_COMPILER_DIAGNOSTIC_PUSH ALIGATOR_PRAGMA(GCC diagnostic push)
@@ -129,6 +127,9 @@ template <typename Scalar> struct StageModelTpl;
 // fwd StageDataTpl
 template <typename Scalar> struct StageDataTpl;
 
+// fwd StageParametersTpl
+template <typename Scalar> struct StageParametersTpl;
+
 // fwd CallbackBaseTpl
 template <typename Scalar> struct CallbackBaseTpl;
 
@@ -10,6 +10,7 @@ template <typename Scalar> struct LqrKnotTpl;
 template <typename Scalar> struct LqrProblemTpl;
 template <typename Scalar> class RiccatiSolverBase;
 template <typename Scalar> class ProximalRiccatiSolver;
+template <typename Scalar> class ParallelRiccatiSolver;
 
 } // namespace gar
 } // namespace aligator
@@ -6,6 +6,7 @@
 #include "aligator/core/arena-matrix.hpp"
 
 #include <fmt/format.h>
+#include <numeric>
 #include <optional>
 
 namespace aligator {
@@ -55,6 +56,14 @@ template <typename Scalar> struct LqrKnotTpl {
   ArenaMatrix<MatrixXs> Gv;    //< \f$\nu^\top G_x \theta\f$ term in Lagrangian
   ArenaMatrix<VectorXs> gamma; //< \f$\gamma^\top \theta\f$ term in Lagrangian
 
+  /// Number of active constraint rows, i.e. rows of \f$(C, D, d)\f$ kept in
+  /// the stage KKT system by the Riccati kernel.
+  uint nca;
+  /// Indices of the constraint rows, active rows first, both in increasing
+  /// order. The inactive rows must be zero in \f$C\f$ and \f$D\f$: their
+  /// multipliers are then given in closed form.
+  std::pmr::vector<uint> active_rows;
+
   LqrKnotTpl() = default;
   explicit LqrKnotTpl(const allocator_type &alloc);
 
@@ -89,6 +98,28 @@ template <typename Scalar> struct LqrKnotTpl {
   // reallocates entire buffer for contigousness
   LqrKnotTpl &addParameterization(uint nth);
 
+  /// @brief Set the active constraint rows from a mask of size @ref nc.
+  template <typename MaskType>
+  void setActiveRows(const Eigen::MatrixBase<MaskType> &active) {
+    assert(active.size() == nc);
+    nca = 0;
+    for (uint i = 0; i < nc; i++) {
+      if (active[i])
+        active_rows[nca++] = i;
+    }
+    uint k = nca;
+    for (uint i = 0; i < nc; i++) {
+      if (!active[i])
+        active_rows[k++] = i;
+    }
+  }
+
+  /// @brief Keep all constraint rows in the stage KKT system (the default).
+  void setAllRowsActive() {
+    nca = nc;
+    std::iota(active_rows.begin(), active_rows.end(), 0u);
+  }
+
   bool isApprox(const LqrKnotTpl &other,
                 Scalar prec = std::numeric_limits<Scalar>::epsilon()) const;
 
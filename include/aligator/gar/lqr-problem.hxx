@@ -23,6 +23,8 @@ LqrKnotTpl<Scalar>::LqrKnotTpl(const allocator_type &alloc)
     , Gu(alloc)
     , Gv(alloc)
     , gamma(alloc)
+    , nca(0)
+    , active_rows(alloc)
     , m_allocator(alloc) {}
 
 template <typename Scalar>
@@ -49,6 +51,8 @@ LqrKnotTpl<Scalar>::LqrKnotTpl(uint nx, uint nu, uint nc, uint nx2, uint nth,
     , Gu(nu, nth, alloc)
     , Gv(nc, nth, alloc)
     , gamma(nth, alloc)
+    , nca(nc)
+    , active_rows(nc, alloc)
     , m_allocator(std::move(alloc)) {
   Q.setZero();
   S.setZero();
@@ -69,6 +73,7 @@ LqrKnotTpl<Scalar>::LqrKnotTpl(uint nx, uint nu, uint nc, uint nx2, uint nth,
   Gu.setZero();
   Gv.setZero();
   gamma.setZero();
+  setAllRowsActive();
 }
 
 template <typename Scalar>
@@ -98,6 +103,9 @@ void LqrKnotTpl<Scalar>::assign(const LqrKnotTpl &other) {
   this->Gu = other.Gu;
   this->Gv = other.Gv;
   this->gamma = other.gamma;
+
+  this->nca = other.nca;
+  this->active_rows = other.active_rows;
 }
 
 #define _c(name) name(other.name, alloc)
@@ -124,6 +132,8 @@ LqrKnotTpl<Scalar>::LqrKnotTpl(const LqrKnotTpl &other, allocator_type alloc)
     , _c(Gu)
     , _c(Gv)
     , _c(gamma)
+    , nca(other.nca)
+    , _c(active_rows)
     , m_allocator(alloc) {}
 #undef _c
 
@@ -151,6 +161,8 @@ LqrKnotTpl<Scalar>::LqrKnotTpl(LqrKnotTpl &&other) noexcept
     , _c(Gu)
     , _c(Gv)
     , _c(gamma)
+    , nca(other.nca)
+    , _c(active_rows)
     , m_allocator(other.m_allocator) {}
 #undef _c
 
@@ -178,6 +190,8 @@ LqrKnotTpl<Scalar>::LqrKnotTpl(LqrKnotTpl &&other, const allocator_type &alloc)
     , _c(Gu)
     , _c(Gv)
     , _c(gamma)
+    , nca(other.nca)
+    , _c(active_rows)
     , m_allocator(alloc) {}
 #undef _c
 
@@ -223,6 +237,8 @@ LqrKnotTpl<Scalar> &LqrKnotTpl<Scalar>::operator=(LqrKnotTpl &&other) {
     _c(Gv);
     _c(gamma);
 #undef _c
+    this->nca = other.nca;
+    this->active_rows = std::move(other.active_rows);
   }
 
   return *this;
@@ -7,9 +7,23 @@
 #include "aligator/gar/lqr-problem.hpp"
 #include "aligator/tracy.hpp"
 
-#ifdef ALIGATOR_MULTITHREADING
 namespace aligator {
 namespace gar {
+struct workrange_t {
+  uint beg;
+  uint end;
+};
+
+/// @brief Get a balanced work range corresponding to a horizon @p horz, thread
+/// ID @p tid, and number of threads @p num_threads.
+constexpr workrange_t get_work(uint horz, uint thread_id, uint num_threads) {
+  uint start = thread_id * (horz + 1) / num_threads;
+  uint stop = (thread_id + 1) * (horz + 1) / num_threads;
+  assert(stop <= horz + 1);
+  return {start, stop};
+}
+
+#ifdef ALIGATOR_MULTITHREADING
 
 /// @brief A parallel-condensing LQ solver.
 /// @details This solver condenses the problem into a
@@ -96,6 +110,12 @@ public:
   /// Number of parallel divisions in the problem: \f$J+1\f$ in the math.
   uint getNumThreads() const noexcept { return numThreads_; }
 
+  /// @brief Range of knots \f$[beg, end)\f$ of the @p i-th leg. Every leg but
+  /// the last is parameterized by the costate at its end.
+  workrange_t getLegRange(uint i) const noexcept {
+    return get_work((uint)problem_->horizon(), i, numThreads_);
+  }
+
   /// @brief Initialize the buffers for the block-tridiagonal system.
   void initializeTridiagSystem();
 
@@ -114,6 +134,6 @@ ParallelRiccatiSolver(LqrProblemTpl<Scalar> &, const uint)
 #ifdef ALIGATOR_ENABLE_TEMPLATE_INSTANTIATION
 extern template class ParallelRiccatiSolver<context::Scalar>;
 #endif
+#endif
 } // namespace gar
 } // namespace aligator
-#endif
@@ -8,6 +8,35 @@
 namespace aligator {
 namespace gar {
 
+namespace detail {
+/// Gather the active rows @p src of a knot's constraints, scaled by @p alpha,
+/// into the leading rows of @p dst.
+template <typename Scalar, typename Src, typename Dst>
+void gatherActiveRows(const LqrKnotTpl<Scalar> &model, const Src &src,
+                      const Scalar alpha, Dst &&dst) {
+  for (uint k = 0; k < model.nca; k++)
+    dst.row(k) = alpha * src.row(model.active_rows[k]);
+}
+
+/// Move the leading rows of @p dst, computed for the active rows, back to the
+/// rows they belong to. The inactive rows are set to @p src divided by
+/// @p mueq.
+template <typename Scalar, typename Src, typename Dst>
+void scatterActiveRows(const LqrKnotTpl<Scalar> &model, const Src &src,
+                       const Scalar mueq, Dst &&dst) {
+  // active_rows[k] >= k: rows are moved down, last row first
+  for (uint k = model.nca; k-- > 0;) {
+    const uint i = model.active_rows[k];
+    if (i != k)
+      dst.row(i) = dst.row(k);
+  }
+  for (uint k = model.nca; k < model.nc; k++) {
+    const uint i = model.active_rows[k];
+    dst.row(i) = src.row(i) / mueq;
+  }
+}
+} // namespace detail
+
 template <typename Scalar>
 StageFactor<Scalar>::StageFactor(uint nx, uint nu, uint nc, uint nx2, uint nth,
                                  const allocator_type &alloc)
@@ -229,13 +258,34 @@ void ProximalRiccatiKernel<Scalar>::stageKernelSolve(const KnotType &model,
   // clang-format on
 
   // factorize reduced KKT system
-  d.kktMat(0, 0) = d.Rhat;
-  d.kktMat(0, 1) = model.D.transpose();
-  d.kktMat(1, 0) = model.D;
-  d.kktMat(1, 1).diagonal().setConstant(-mueq);
-  d.kktMat.matrix() =
-      d.kktMat.matrix().template selfadjointView<Eigen::Lower>();
-  d.kktChol.compute(d.kktMat.matrix());
+  // Inactive constraint rows (zero in C and D) are decoupled from the rest of
+  // the system: when there are some, only the active rows are factorized.
+  const uint nu = model.nu;
+  const uint na = model.nca;
+  const bool compact = na < model.nc;
+  if (compact) {
+#ifndef NDEBUG
+    for (uint k = na; k < model.nc; k++) {
+      const uint i = model.active_rows[k];
+      assert(model.C.row(i).isZero(0) && model.D.row(i).isZero(0));
+    }
+#endif
+    auto kkt = d.kktMat.matrix().topLeftCorner(nu + na, nu + na);
+    kkt.topLeftCorner(nu, nu) = d.Rhat;
+    detail::gatherActiveRows(model, model.D, Scalar(1),
+                             kkt.bottomLeftCorner(na, nu));
+    kkt.bottomRightCorner(na, na).diagonal().setConstant(-mueq);
+    // only the lower triangle is read
+    d.kktChol.computeNoResize(kkt);
+  } else {
+    d.kktMat(0, 0) = d.Rhat;
+    d.kktMat(0, 1) = model.D.transpose();
+    d.kktMat(1, 0) = model.D;
+    d.kktMat(1, 1).diagonal().setConstant(-mueq);
+    d.kktMat.matrix() =
+        d.kktMat.matrix().template selfadjointView<Eigen::Lower>();
+    d.kktChol.compute(d.kktMat.matrix());
+  }
   if (d.kktChol.info() != Eigen::Success) {
     ALIGATOR_RUNTIME_ERROR("Failed stage LDL factorization");
   }
@@ -246,20 +296,31 @@ void ProximalRiccatiKernel<Scalar>::stageKernelSolve(const KnotType &model,
 
   // fill feedback system
   kff = -d.rhat;
-  zff = -model.d;
 
   // rhs (feedback)
   RowMatrixRef K = d.fb.blockRow(0);
   RowMatrixRef Z = d.fb.blockRow(1);
   RowMatrixRef Aff = d.fb.blockRow(2); // closed-loop matrix
   K = -d.Shat.transpose();
-  Z = -model.C;
 
   // solve
-  auto ffview = d.ff.template topBlkRows<2>();
-  auto fbview = d.fb.template topBlkRows<2>();
-  d.kktChol.solveInPlace(ffview.matrix());
-  d.kktChol.solveInPlace(fbview.matrix());
+  if (compact) {
+    detail::gatherActiveRows(model, model.d, Scalar(-1), zff);
+    detail::gatherActiveRows(model, model.C, Scalar(-1), Z);
+    auto ffview = d.ff.matrix().topRows(nu + na);
+    auto fbview = d.fb.matrix().topRows(nu + na);
+    d.kktChol.solveInPlace(ffview);
+    d.kktChol.solveInPlace(fbview);
+    detail::scatterActiveRows(model, model.d, mueq, zff);
+    detail::scatterActiveRows(model, model.C, mueq, Z);
+  } else {
+    zff = -model.d;
+    Z = -model.C;
+    auto ffview = d.ff.template topBlkRows<2>();
+    auto fbview = d.fb.template topBlkRows<2>();
+    d.kktChol.solveInPlace(ffview.matrix());
+    d.kktChol.solveInPlace(fbview.matrix());
+  }
 
   // set closed loop dynamics
   // clang-format off
@@ -288,9 +349,16 @@ void ProximalRiccatiKernel<Scalar>::stageKernelSolve(const KnotType &model,
 
     // set rhs of 2x2 block system and solve
     Kth = -d.Guhat;
-    Zth = -model.Gv;
-    BlkMatrix<RowMatrixRef, 2, 1> fthview = d.fth.template topBlkRows<2>();
-    d.kktChol.solveInPlace(fthview.matrix());
+    if (compact) {
+      detail::gatherActiveRows(model, model.Gv, Scalar(-1), Zth);
+      auto fthview = d.fth.matrix().topRows(nu + na);
+      d.kktChol.solveInPlace(fthview);
+      detail::scatterActiveRows(model, model.Gv, mueq, Zth);
+    } else {
+      Zth = -model.Gv;
+      BlkMatrix<RowMatrixRef, 2, 1> fthview = d.fth.template topBlkRows<2>();
+      d.kktChol.solveInPlace(fthview.matrix());
+    }
 
     Yth.noalias() = model.B * Kth;
 
@@ -5,6 +5,9 @@
 
 #include <Eigen/Core>
 #include <cassert>
+#include <cstdlib>
+
+#define ALIGATOR_INLINE inline __attribute__((always_inline))
 
 #define ALIGATOR_DYNAMIC_TYPEDEFS(Scalar)                                      \
   using VectorXs = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;                   \
@@ -51,6 +54,20 @@
 /// @brief Exiting performance-critical code.
 #define ALIGATOR_NOMALLOC_END ALIGATOR_EIGEN_ALLOW_MALLOC(true)
 
+/// @brief Declare @p name, a dynamic-size vector of (trivial) scalars mapped on
+/// a scratch buffer on the stack, freed when the function returns (on the
+/// heap where Eigen has no alloca). Meant for small work vectors, e.g. tangent
+/// vectors.
+#ifdef EIGEN_ALLOCA
+#define ALIGATOR_STACK_VECTOR(Scalar, name, size)                              \
+  Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> name(                   \
+      static_cast<Scalar *>(EIGEN_ALLOCA(sizeof(Scalar) * std::size_t(size))), \
+      size)
+#else
+#define ALIGATOR_STACK_VECTOR(Scalar, name, size)                              \
+  Eigen::Matrix<Scalar, Eigen::Dynamic, 1> name(size)
+#endif
+
 namespace aligator {
 
 /// This type class recognises whether
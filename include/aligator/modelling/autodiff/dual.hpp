@@ -0,0 +1,225 @@
+/// @file
+/// @brief Dual numbers for forward-mode automatic differentiation.
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/math.hpp"
+
+#include <cmath>
+#include <ostream>
+
+namespace aligator {
+namespace autodiff {
+
+/// @brief Dual number carrying a value and its derivatives along @p N
+/// directions at once, propagated by the chain rule through each operation.
+///
+/// @details The derivatives are stored in a fixed-size Eigen vector, so that
+/// the propagation of a chunk of directions is vectorized. The elementary
+/// functions are found by argument-dependent lookup: generic code should call
+/// them unqualified, after e.g. `using std::sin;`.
+template <typename _Scalar, int N> struct DualTpl {
+  using Scalar = _Scalar;
+  using Derivatives = Eigen::Matrix<Scalar, N, 1>;
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  Scalar val;
+  Derivatives der;
+
+  DualTpl()
+      : val(0.)
+      , der(Derivatives::Zero()) {}
+
+  /// A constant, with zero derivatives.
+  DualTpl(const Scalar &v)
+      : val(v)
+      , der(Derivatives::Zero()) {}
+
+  template <typename Der>
+  DualTpl(const Scalar &v, const Eigen::MatrixBase<Der> &d)
+      : val(v)
+      , der(d) {}
+
+  /// @brief Value \f$\varphi(a)\f$ and derivative \f$\varphi'(a)\f$ of a
+  /// function composed with @p a.
+  static DualTpl chain(const DualTpl &a, const Scalar &v, const Scalar &dv) {
+    return DualTpl(v, dv * a.der);
+  }
+
+  DualTpl &operator+=(const DualTpl &b) {
+    val += b.val;
+    der += b.der;
+    return *this;
+  }
+  DualTpl &operator-=(const DualTpl &b) {
+    val -= b.val;
+    der -= b.der;
+    return *this;
+  }
+  DualTpl &operator*=(const DualTpl &b) {
+    der = b.val * der + val * b.der;
+    val *= b.val;
+    return *this;
+  }
+  DualTpl &operator/=(const DualTpl &b) {
+    const Scalar inv = Scalar(1) / b.val;
+    val *= inv;
+    der = (der - val * b.der) * inv;
+    return *this;
+  }
+  DualTpl &operator+=(const Scalar &b) {
+    val += b;
+    return *this;
+  }
+  DualTpl &operator-=(const Scalar &b) {
+    val -= b;
+    return *this;
+  }
+  DualTpl &operator*=(const Scalar &b) {
+    val *= b;
+    der *= b;
+    return *this;
+  }
+  DualTpl &operator/=(const Scalar &b) { return *this *= Scalar(1) / b; }
+
+  friend DualTpl operator+(const DualTpl &a) { return a; }
+  friend DualTpl operator-(const DualTpl &a) { return DualTpl(-a.val, -a.der); }
+
+  friend DualTpl operator+(DualTpl a, const DualTpl &b) { return a += b; }
+  friend DualTpl operator+(DualTpl a, const Scalar &b) { return a += b; }
+  friend DualTpl operator+(const Scalar &a, DualTpl b) { return b += a; }
+  friend DualTpl operator-(DualTpl a, const DualTpl &b) { return a -= b; }
+  friend DualTpl operator-(DualTpl a, const Scalar &b) { return a -= b; }
+  friend DualTpl operator-(const Scalar &a, const DualTpl &b) {
+    return DualTpl(a - b.val, -b.der);
+  }
+  friend DualTpl operator*(const DualTpl &a, const DualTpl &b) {
+    return DualTpl(a.val * b.val, b.val * a.der + a.val * b.der);
+  }
+  friend DualTpl operator*(DualTpl a, const Scalar &b) { return a *= b; }
+  friend DualTpl operator*(const Scalar &a, DualTpl b) { return b *= a; }
+  friend DualTpl operator/(DualTpl a, const DualTpl &b) { return a /= b; }
+  friend DualTpl operator/(DualTpl a, const Scalar &b) { return a /= b; }
+  friend DualTpl operator/(const Scalar &a, const DualTpl &b) {
+    const Scalar inv = Scalar(1) / b.val;
+    return DualTpl(a * inv, (-a * inv * inv) * b.der);
+  }
+
+  // Comparisons only involve the values.
+#define ALIGATOR_DUAL_COMPARISON(op)                                           \
+  friend bool operator op(const DualTpl &a, const DualTpl &b) {                \
+    return a.val op b.val;                                                     \
+  }                                                                            \
+  friend bool operator op(const DualTpl &a, const Scalar &b) {                 \
+    return a.val op b;                                                         \
+  }                                                                            \
+  friend bool operator op(const Scalar &a, const DualTpl &b) {                 \
+    return a op b.val;                                                         \
+  }
+  ALIGATOR_DUAL_COMPARISON(==)
+  ALIGATOR_DUAL_COMPARISON(!=)
+  ALIGATOR_DUAL_COMPARISON(<)
+  ALIGATOR_DUAL_COMPARISON(<=)
+  ALIGATOR_DUAL_COMPARISON(>)
+  ALIGATOR_DUAL_COMPARISON(>=)
+#undef ALIGATOR_DUAL_COMPARISON
+
+  friend DualTpl abs(const DualTpl &a) { return a.val < 0 ? -a : a; }
+  friend DualTpl fabs(const DualTpl &a) { return abs(a); }
+  friend DualTpl sqrt(const DualTpl &a) {
+    const Scalar s = std::sqrt(a.val);
+    return chain(a, s, Scalar(0.5) / s);
+  }
+  friend DualTpl exp(const DualTpl &a) {
+    const Scalar e = std::exp(a.val);
+    return chain(a, e, e);
+  }
+  friend DualTpl log(const DualTpl &a) {
+    return chain(a, std::log(a.val), Scalar(1) / a.val);
+  }
+  friend DualTpl pow(const DualTpl &a, const Scalar &b) {
+    // b = 0 is constant, even at a = 0 where pow(a, b - 1) is infinite
+    const Scalar dp = b == 0 ? Scalar(0) : b * std::pow(a.val, b - 1);
+    return chain(a, std::pow(a.val, b), dp);
+  }
+  friend DualTpl pow(const DualTpl &a, const DualTpl &b) {
+    return exp(b * log(a));
+  }
+  friend DualTpl sin(const DualTpl &a) {
+    return chain(a, std::sin(a.val), std::cos(a.val));
+  }
+  friend DualTpl cos(const DualTpl &a) {
+    return chain(a, std::cos(a.val), -std::sin(a.val));
+  }
+  friend DualTpl tan(const DualTpl &a) {
+    const Scalar t = std::tan(a.val);
+    return chain(a, t, 1 + t * t);
+  }
+  friend DualTpl asin(const DualTpl &a) {
+    return chain(a, std::asin(a.val), 1 / std::sqrt(1 - a.val * a.val));
+  }
+  friend DualTpl acos(const DualTpl &a) {
+    return chain(a, std::acos(a.val), -1 / std::sqrt(1 - a.val * a.val));
+  }
+  friend DualTpl atan(const DualTpl &a) {
+    return chain(a, std::atan(a.val), 1 / (1 + a.val * a.val));
+  }
+  friend DualTpl atan2(const DualTpl &y, const DualTpl &x) {
+    const Scalar inv = 1 / (x.val * x.val + y.val * y.val);
+    return DualTpl(std::atan2(y.val, x.val),
+                   (x.val * inv) * y.der - (y.val * inv) * x.der);
+  }
+  friend DualTpl sinh(const DualTpl &a) {
+    return chain(a, std::sinh(a.val), std::cosh(a.val));
+  }
+  friend DualTpl cosh(const DualTpl &a) {
+    return chain(a, std::cosh(a.val), std::sinh(a.val));
+  }
+  friend DualTpl tanh(const DualTpl &a) {
+    const Scalar t = std::tanh(a.val);
+    return chain(a, t, 1 - t * t);
+  }
+  friend bool isfinite(const DualTpl &a) {
+    return std::isfinite(a.val) && a.der.allFinite();
+  }
+
+  friend std::ostream &operator<<(std::ostream &oss, const DualTpl &a) {
+    return oss << a.val;
+  }
+};
+
+} // namespace autodiff
+} // namespace aligator
+
+namespace Eigen {
+
+template <typename Scalar, int N>
+struct NumTraits<aligator::autodiff::DualTpl<Scalar, N>> : NumTraits<Scalar> {
+  using Real = aligator::autodiff::DualTpl<Scalar, N>;
+  using NonInteger = Real;
+  using Nested = Real;
+  using Literal = Real;
+  enum {
+    IsComplex = 0,
+    IsInteger = 0,
+    IsSigned = 1,
+    RequireInitialization = 1,
+    ReadCost = N + 1,
+    AddCost = N + 1,
+    MulCost = 2 * N + 1
+  };
+};
+
+template <typename Scalar, int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<aligator::autodiff::DualTpl<Scalar, N>, Scalar,
+                            BinaryOp> {
+  using ReturnType = aligator::autodiff::DualTpl<Scalar, N>;
+};
+
+template <typename Scalar, int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<Scalar, aligator::autodiff::DualTpl<Scalar, N>,
+                            BinaryOp> {
+  using ReturnType = aligator::autodiff::DualTpl<Scalar, N>;
+};
+
+} // namespace Eigen
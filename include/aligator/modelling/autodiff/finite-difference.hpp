@@ -5,37 +5,87 @@
 #include "aligator/core/function-abstract.hpp"
 #include "aligator/core/explicit-dynamics.hpp"
 #include "aligator/core/manifold-base.hpp"
+#include "aligator/core/shared-data-scope.hpp"
+#include "aligator/threads.hpp"
+
+#include <exception>
 
 namespace aligator {
 namespace autodiff {
 
+/// @brief Structurally nonzero entries of a Jacobian \f$[J_x\ J_u]\f$.
+using SparsityPattern = Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic>;
+
+/// @brief Greedy coloring of the columns of a Jacobian: the columns of a group
+/// have no nonzero row in common, so that they can be perturbed together.
+inline std::vector<std::vector<int>>
+colorJacobianColumns(const SparsityPattern &pattern) {
+  using RowMask = Eigen::Matrix<bool, Eigen::Dynamic, 1>;
+  std::vector<std::vector<int>> groups;
+  std::vector<RowMask> group_rows;
+  for (int c = 0; c < int(pattern.cols()); c++) {
+    const auto col = pattern.col(c);
+    std::size_t k = 0;
+    while (k < groups.size() && (group_rows[k].array() && col.array()).any())
+      k++;
+    if (k == groups.size()) {
+      groups.emplace_back();
+      group_rows.push_back(RowMask::Zero(pattern.rows()));
+    }
+    groups[k].push_back(c);
+    group_rows[k] = group_rows[k].array() || col.array();
+  }
+  return groups;
+}
+
 namespace internal {
 
+/// @brief Buffers of a thread perturbing the inputs of a function.
+template <typename Scalar, typename FuncData> struct finite_diff_workspace {
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  shared_ptr<FuncData> data;
+  VectorXs dx, du;
+  VectorXs xp, up;
+  /// Output difference, in the tangent space of the output.
+  VectorXs dv;
+
+  template <typename Func>
+  finite_diff_workspace(const Func &func, int nx, int ndx, int nu, int ndv)
+      : dx(VectorXs::Zero(ndx))
+      , du(VectorXs::Zero(nu))
+      , xp(nx)
+      , up(nu)
+      , dv(ndv) {
+    // own the objects shared by the datas of a stage (e.g. kinematics
+    // caches), which the perturbed evaluations would overwrite
+    SharedDataScope scope;
+    data = func.createData();
+  }
+};
+
 template <typename _Scalar, template <typename> class _BaseTpl>
 struct finite_diff_traits;
 
 template <typename Scalar> struct finite_diff_traits<Scalar, StageFunctionTpl> {
   ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Workspace = finite_diff_workspace<Scalar, StageFunctionDataTpl<Scalar>>;
   struct Data : StageFunctionDataTpl<Scalar> {
     using SFD = StageFunctionDataTpl<Scalar>;
     using SFD::ndx1;
+    using SFD::nr;
     using SFD::nu;
     shared_ptr<SFD> data_0;
-    shared_ptr<SFD> data_1;
-    VectorXs dx, du;
-    VectorXs xp, up;
+    /// One workspace per thread.
+    std::vector<Workspace> workspaces;
 
     template <typename U>
     Data(U const &model)
         : SFD(*model.func_)
-        , data_0(model.func_->createData())
-        , data_1(model.func_->createData())
-        , dx(ndx1)
-        , du(nu)
-        , xp(model.nx1)
-        , up(model.nu) {
-      dx.setZero();
-      du.setZero();
+        , data_0(model.func_->createData()) {
+      const std::size_t n = std::max(model.num_threads, std::size_t(1));
+      workspaces.reserve(n);
+      for (std::size_t i = 0; i < n; i++)
+        workspaces.emplace_back(*model.func_, model.nx1, ndx1, nu, nr);
     }
   };
 
@@ -48,30 +98,25 @@ template <typename Scalar> struct finite_diff_traits<Scalar, StageFunctionTpl> {
 template <typename Scalar>
 struct finite_diff_traits<Scalar, ExplicitDynamicsModelTpl> {
   ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Workspace =
+      finite_diff_workspace<Scalar, ExplicitDynamicsDataTpl<Scalar>>;
   struct Data : ExplicitDynamicsDataTpl<Scalar> {
     using EDD = ExplicitDynamicsDataTpl<Scalar>;
     using EDD::ndx1;
     using EDD::ndx2;
     using EDD::nu;
     shared_ptr<EDD> data_0;
-    shared_ptr<EDD> data_1;
-    VectorXs dx, du;
-    VectorXs xp, up;
-    VectorXs dxnext;
+    /// One workspace per thread.
+    std::vector<Workspace> workspaces;
 
     template <typename U>
     Data(U const &model)
         : EDD(*model.func_)
-        , data_0(model.func_->createData())
-        , data_1(model.func_->createData())
-        , dx(ndx1)
-        , du(nu)
-        , xp(model.nx1)
-        , up(model.nu)
-        , dxnext(ndx2) {
-      dx.setZero();
-      du.setZero();
-      dxnext.setZero();
+        , data_0(model.func_->createData()) {
+      const std::size_t n = std::max(model.num_threads, std::size_t(1));
+      workspaces.reserve(n);
+      for (std::size_t i = 0; i < n; i++)
+        workspaces.emplace_back(*model.func_, model.nx1, ndx1, nu, ndx2);
     }
   };
 
@@ -82,6 +127,8 @@ struct finite_diff_traits<Scalar, ExplicitDynamicsModelTpl> {
 };
 
 /// @brief Implementation details for finite-differencing.
+/// @details The columns of the Jacobian are computed by groups (colors_), one
+/// evaluation of the function per group, spread over num_threads threads.
 template <typename _Scalar, template <typename> class _BaseTpl>
 struct finite_difference_impl : finite_diff_traits<_Scalar, _BaseTpl> {
   using Scalar = _Scalar;
@@ -89,6 +136,7 @@ struct finite_difference_impl : finite_diff_traits<_Scalar, _BaseTpl> {
   using Traits = finite_diff_traits<Scalar, _BaseTpl>;
   using Data = typename Traits::Data;
   using Args = typename Traits::Args;
+  using Workspace = typename Traits::Workspace;
   using Base = _BaseTpl<Scalar>;
   using BaseData = typename Base::Data;
   using Manifold = ManifoldAbstractTpl<Scalar>;
@@ -99,6 +147,12 @@ struct finite_difference_impl : finite_diff_traits<_Scalar, _BaseTpl> {
   xyz::polymorphic<Base> func_;
   Scalar fd_eps;
   int nx1, nu, nx2;
+  /// Structurally nonzero entries of the Jacobian, empty if unknown.
+  SparsityPattern sparsity_;
+  /// Groups of columns of the Jacobian perturbed together.
+  std::vector<std::vector<int>> colors_;
+  /// Threads over which the groups are spread. Set before createData().
+  std::size_t num_threads = 1;
 
   static constexpr bool IsStage =
       std::is_same_v<Base, StageFunctionTpl<Scalar>>;
@@ -117,7 +171,15 @@ struct finite_difference_impl : finite_diff_traits<_Scalar, _BaseTpl> {
       , func_(std::move(func))
       , fd_eps(fd_eps)
       , nx1(space->nx())
-      , nx2(space->nx()) {}
+      , nu(func_->nu)
+      , nx2(space->nx()) {
+    // columns outside of the Jacobian pattern are zero
+    const JacobianPattern &p = func_->jac_pattern;
+    for (int i = p.x_begin; i < p.x_begin + p.x_size; i++)
+      colors_.push_back({i});
+    for (int i = p.u_begin; i < p.u_begin + p.u_size; i++)
+      colors_.push_back({ndx1() + i});
+  }
 
   template <typename U = Base,
             std::enable_if_t<
@@ -129,14 +191,57 @@ struct finite_difference_impl : finite_diff_traits<_Scalar, _BaseTpl> {
       , fd_eps(fd_eps)
       , nx1(space->nx())
       , nu(func->nu)
-      , nx2(func->space_next().nx()) {}
+      , nx2(func->space_next().nx()) {
+    for (int i = 0; i < ndx1() + nu; i++)
+      colors_.push_back({i});
+  }
+
+  int ndx1() const {
+    if constexpr (IsExplicitDynamics) {
+      return func_->ndx1();
+    } else {
+      return func_->ndx1;
+    }
+  }
+
+  /// Dimension of the output (tangent space of the next state, for dynamics).
+  int nout() const {
+    if constexpr (IsExplicitDynamics) {
+      return func_->ndx2();
+    } else {
+      return func_->nr;
+    }
+  }
+
+  void setSparsityPattern(const SparsityPattern &pattern) {
+    if (pattern.rows() != nout() || pattern.cols() != ndx1() + nu)
+      ALIGATOR_RUNTIME_ERROR("Wrong sparsity pattern dimensions (got {:d}x{:d}"
+                             ", expected {:d}x{:d})",
+                             pattern.rows(), pattern.cols(), nout(),
+                             ndx1() + nu);
+    sparsity_ = pattern;
+    colors_ = colorJacobianColumns(pattern);
+  }
+
+  /// @brief Detect the sparsity pattern from a dense finite-difference
+  /// Jacobian at @p args: its entries larger than @p tol in absolute value.
+  /// @warning Entries which vanish at @p args are missed, prefer a random
+  /// point.
+  SparsityPattern computeSparsityPattern(const Args &args,
+                                         const Scalar tol) const {
+    shared_ptr<BaseData> data = createDataImpl();
+    Data &d = static_cast<Data &>(*data);
+    evaluateImpl(args, d);
+    for (int c = 0; c < ndx1() + nu; c++)
+      perturbGroup(args, d.workspaces[0], {c}, d, false);
+    return d.jac_buffer_.array().abs() > tol;
+  }
 
   /// @details The @p y parameter is provided as a pointer, since is can be
   /// null.
   void evaluateImpl(const Args &args, BaseData &data) const {
     Data &d = static_cast<Data &>(data);
     assert(d.data_0);
-    assert(d.data_1);
     if constexpr (IsExplicitDynamics) {
       func_->forward(args.x, args.u, *d.data_0);
       d.xnext_ = d.data_0->xnext_;
@@ -146,57 +251,58 @@ struct finite_difference_impl : finite_diff_traits<_Scalar, _BaseTpl> {
     }
   }
 
+  /// @brief Fill the columns of the Jacobian in @p group, perturbing the
+  /// inputs along all of them at once.
+  void perturbGroup(const Args &args, Workspace &w,
+                    const std::vector<int> &group, Data &d,
+                    const bool masked) const {
+    const int ndx1 = this->ndx1();
+    for (int c : group)
+      (c < ndx1 ? w.dx[c] : w.du[c - ndx1]) = fd_eps;
+    space_->integrate(args.x, w.dx, w.xp);
+    w.up = args.u + w.du;
+    if constexpr (IsExplicitDynamics) {
+      func_->forward(w.xp, w.up, *w.data);
+      func_->space_next().difference(d.data_0->xnext_, w.data->xnext_, w.dv);
+    } else {
+      func_->evaluate(w.xp, w.up, *w.data);
+      w.dv = w.data->value_ - d.data_0->value_;
+    }
+    w.dv /= fd_eps;
+    for (int c : group) {
+      if (masked)
+        d.jac_buffer_.col(c) = sparsity_.col(c).select(w.dv, Scalar(0));
+      else
+        d.jac_buffer_.col(c) = w.dv;
+      (c < ndx1 ? w.dx[c] : w.du[c - ndx1]) = 0.;
+    }
+  }
+
   void computeJacobiansImpl(const Args &args, BaseData &data) const {
     Data &d = static_cast<Data &>(data);
     assert(d.data_0);
-    assert(d.data_1);
-
-    auto output_ref = [](auto &data_ref) -> VectorXs & {
-      if constexpr (IsExplicitDynamics) {
-        return data_ref.xnext_;
-      } else {
-        return data_ref.value_;
-      }
-    };
-
-    VectorXs &v0 = output_ref(*d.data_0);
-    VectorXs &vp = output_ref(*d.data_1);
-
-    const int ndx1 = [&]() {
-      if constexpr (IsExplicitDynamics) {
-        return func_->ndx1();
-      } else {
-        return func_->ndx1;
-      }
-    }();
-
-    for (int i = 0; i < ndx1; i++) {
-      d.dx[i] = fd_eps;
-      space_->integrate(args.x, d.dx, d.xp);
-      if constexpr (IsExplicitDynamics) {
-        func_->forward(d.xp, args.u, *d.data_1);
-        func_->space_next().difference(v0, vp, d.dxnext);
-        data.Jx().col(i) = d.dxnext / fd_eps;
-      } else {
-        func_->evaluate(d.xp, args.u, *d.data_1);
-        data.Jx_.col(i) = (vp - v0) / fd_eps;
-      }
-      d.dx[i] = 0.;
+    const bool masked = sparsity_.size() > 0;
+    const long num_groups = long(colors_.size());
+    const std::size_t nthreads = std::min(num_threads, d.workspaces.size());
+    if (nthreads <= 1) {
+      for (long k = 0; k < num_groups; k++)
+        perturbGroup(args, d.workspaces[0], colors_[size_t(k)], d, masked);
+      return;
     }
 
-    for (int i = 0; i < func_->nu; i++) {
-      d.du[i] = fd_eps;
-      d.up = args.u + d.du;
-      if constexpr (IsExplicitDynamics) {
-        func_->forward(args.x, d.up, *d.data_1);
-        func_->space_next().difference(v0, vp, d.dxnext);
-        data.Ju().col(i) = d.dxnext / fd_eps;
-      } else {
-        func_->evaluate(args.x, d.up, *d.data_1);
-        data.Ju_.col(i) = (vp - v0) / fd_eps;
+    std::exception_ptr error;
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (long k = 0; k < num_groups; k++) {
+      Workspace &w = d.workspaces[omp::get_thread_id()];
+      try {
+        perturbGroup(args, w, colors_[size_t(k)], d, masked);
+      } catch (...) {
+#pragma omp critical
+        error = std::current_exception();
       }
-      d.du[i] = 0.;
     }
+    if (error)
+      std::rethrow_exception(error);
   }
 
   void computeVectorHessianProductsImpl(const ConstVectorRef &,
@@ -217,6 +323,10 @@ template <typename _Scalar> struct FiniteDifferenceHelper;
 /** @brief    Approximate the derivatives of a given function
  * using finite differences, to downcast the function to a
  * StageFunctionTpl.
+ *
+ * @details Structurally independent columns of the Jacobian are perturbed
+ * together once a sparsity pattern is set (setSparsityPattern()), and the
+ * perturbations can be spread over several threads (setNumThreads()).
  */
 template <typename _Scalar>
 struct FiniteDifferenceHelper : StageFunctionTpl<_Scalar> {
@@ -234,7 +344,9 @@ struct FiniteDifferenceHelper : StageFunctionTpl<_Scalar> {
                          xyz::polymorphic<StageFunction> func,
                          const Scalar fd_eps)
       : StageFunction(func->ndx1, func->nu, func->nr)
-      , impl(space, func, fd_eps) {}
+      , impl(space, func, fd_eps) {
+    this->jac_pattern = func->jac_pattern;
+  }
 
   void evaluate(const ConstVectorRef &x, const ConstVectorRef &u,
                 BaseData &data) const {
@@ -248,6 +360,28 @@ struct FiniteDifferenceHelper : StageFunctionTpl<_Scalar> {
 
   shared_ptr<BaseData> createData() const { return impl.createDataImpl(); }
 
+  /// @brief Set the structurally nonzero entries of \f$[J_x\ J_u]\f$, and
+  /// color its columns.
+  void setSparsityPattern(const SparsityPattern &pattern) {
+    impl.setSparsityPattern(pattern);
+  }
+
+  /// @copydoc Impl::computeSparsityPattern()
+  SparsityPattern computeSparsityPattern(const ConstVectorRef &x,
+                                         const ConstVectorRef &u,
+                                         const Scalar tol = 0.) const {
+    return impl.computeSparsityPattern({x, u}, tol);
+  }
+
+  /// Number of evaluations of the function per Jacobian.
+  std::size_t numColors() const { return impl.colors_.size(); }
+
+  /// Number of threads, used by the datas created afterwards.
+  void setNumThreads(const std::size_t num_threads) {
+    impl.num_threads = num_threads;
+  }
+  std::size_t getNumThreads() const { return impl.num_threads; }
+
 private:
   Impl impl;
 };
@@ -283,6 +417,27 @@ struct DynamicsFiniteDifferenceHelper : ExplicitDynamicsModelTpl<_Scalar> {
 
   shared_ptr<BaseData> createData() const { return impl.createDataImpl(); }
 
+  /// @copydoc FiniteDifferenceHelper::setSparsityPattern()
+  void setSparsityPattern(const SparsityPattern &pattern) {
+    impl.setSparsityPattern(pattern);
+  }
+
+  /// @copydoc Impl::computeSparsityPattern()
+  SparsityPattern computeSparsityPattern(const ConstVectorRef &x,
+                                         const ConstVectorRef &u,
+                                         const Scalar tol = 0.) const {
+    return impl.computeSparsityPattern({x, u}, tol);
+  }
+
+  /// Number of evaluations of the dynamics per Jacobian.
+  std::size_t numColors() const { return impl.colors_.size(); }
+
+  /// Number of threads, used by the datas created afterwards.
+  void setNumThreads(const std::size_t num_threads) {
+    impl.num_threads = num_threads;
+  }
+  std::size_t getNumThreads() const { return impl.num_threads; }
+
 private:
   Impl impl;
 };
@@ -0,0 +1,165 @@
+/// @file
+/// @brief Stage functions and dynamics differentiated in forward mode, with
+/// dual numbers.
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/core/function-abstract.hpp"
+#include "aligator/core/explicit-dynamics.hpp"
+#include "aligator/core/vector-space.hpp"
+#include "aligator/modelling/autodiff/dual.hpp"
+
+namespace aligator {
+namespace autodiff {
+
+/// Vector of dual numbers.
+template <typename Scalar, int N>
+using VectorXDual = Eigen::Matrix<DualTpl<Scalar, N>, Eigen::Dynamic, 1>;
+
+namespace internal {
+
+/// @brief Evaluate the Jacobian \f$[J_x\ J_u]\f$ of @p f, seeding @p N columns
+/// per evaluation.
+template <int N, typename Functor, typename Scalar>
+void forwardModeJacobian(const Functor &f,
+                         const typename math_types<Scalar>::ConstVectorRef &x,
+                         const typename math_types<Scalar>::ConstVectorRef &u,
+                         VectorXDual<Scalar, N> &xd, VectorXDual<Scalar, N> &ud,
+                         VectorXDual<Scalar, N> &vd,
+                         typename math_types<Scalar>::MatrixRef jac) {
+  using Dual = DualTpl<Scalar, N>;
+  const int nx = int(x.size());
+  const int ncols = nx + int(u.size());
+  xd = x.template cast<Dual>();
+  ud = u.template cast<Dual>();
+  for (int c0 = 0; c0 < ncols; c0 += N) {
+    const int n = std::min(N, ncols - c0);
+    for (int k = 0; k < n; k++) {
+      const int c = c0 + k;
+      (c < nx ? xd[c] : ud[c - nx]).der[k] = 1.;
+    }
+    f(xd, ud, vd);
+    for (int k = 0; k < n; k++) {
+      const int c = c0 + k;
+      (c < nx ? xd[c] : ud[c - nx]).der[k] = 0.;
+    }
+    for (int i = 0; i < int(vd.size()); i++)
+      jac.row(i).segment(c0, n) = vd[i].der.head(n).transpose();
+  }
+}
+
+} // namespace internal
+
+/// @brief Stage function on a vector space, whose Jacobians are computed
+/// exactly in forward mode.
+///
+/// @details The functor is called as `f(x, u, out)` on Eigen vectors of
+/// either @p Scalar or DualTpl<Scalar, ChunkSize>, so it must be generic over
+/// the scalar type (e.g. a generic lambda). Each evaluation on dual numbers
+/// yields @p ChunkSize columns of \f$[J_x\ J_u]\f$.
+template <typename _Scalar, typename Functor, int ChunkSize = 8>
+struct AutoDiffFunctionTpl : StageFunctionTpl<_Scalar> {
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = StageFunctionTpl<Scalar>;
+  using BaseData = StageFunctionDataTpl<Scalar>;
+  using Dual = DualTpl<Scalar, ChunkSize>;
+  using DualVector = VectorXDual<Scalar, ChunkSize>;
+
+  struct Data : BaseData {
+    /// Dual inputs and output.
+    DualVector xd, ud, vd;
+
+    Data(const AutoDiffFunctionTpl &model)
+        : BaseData(model)
+        , xd(model.ndx1)
+        , ud(model.nu)
+        , vd(model.nr) {}
+  };
+
+  Functor func_;
+
+  AutoDiffFunctionTpl(const int ndx, const int nu, const int nr, Functor func)
+      : Base(ndx, nu, nr)
+      , func_(std::move(func)) {}
+
+  void evaluate(const ConstVectorRef &x, const ConstVectorRef &u,
+                BaseData &data) const override {
+    func_(x, u, data.value_);
+  }
+
+  void computeJacobians(const ConstVectorRef &x, const ConstVectorRef &u,
+                        BaseData &data) const override {
+    Data &d = static_cast<Data &>(data);
+    internal::forwardModeJacobian<ChunkSize>(func_, x, u, d.xd, d.ud, d.vd,
+                                             d.jac_buffer_);
+  }
+
+  shared_ptr<BaseData> createData() const override {
+    return std::make_shared<Data>(*this);
+  }
+};
+
+/// @brief Explicit dynamics on a vector space, whose Jacobians are computed
+/// exactly in forward mode.
+/// @details The functor is called as `f(x, u, xnext)`, see
+/// AutoDiffFunctionTpl.
+template <typename _Scalar, typename Functor, int ChunkSize = 8>
+struct AutoDiffDynamicsTpl : ExplicitDynamicsModelTpl<_Scalar> {
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = ExplicitDynamicsModelTpl<Scalar>;
+  using BaseData = ExplicitDynamicsDataTpl<Scalar>;
+  using Dual = DualTpl<Scalar, ChunkSize>;
+  using DualVector = VectorXDual<Scalar, ChunkSize>;
+
+  struct Data : BaseData {
+    /// Dual inputs and output.
+    DualVector xd, ud, vd;
+
+    Data(const AutoDiffDynamicsTpl &model)
+        : BaseData(model)
+        , xd(model.ndx1())
+        , ud(model.nu)
+        , vd(model.ndx2()) {}
+  };
+
+  Functor func_;
+
+  AutoDiffDynamicsTpl(const int nx, const int nu, Functor func)
+      : Base(VectorSpaceTpl<Scalar>(nx), nu)
+      , func_(std::move(func)) {}
+
+  void forward(const ConstVectorRef &x, const ConstVectorRef &u,
+               BaseData &data) const override {
+    func_(x, u, data.xnext_);
+  }
+
+  void dForward(const ConstVectorRef &x, const ConstVectorRef &u,
+                BaseData &data) const override {
+    Data &d = static_cast<Data &>(data);
+    internal::forwardModeJacobian<ChunkSize>(func_, x, u, d.xd, d.ud, d.vd,
+                                             d.jac_buffer_);
+  }
+
+  shared_ptr<BaseData> createData() const override {
+    return std::make_shared<Data>(*this);
+  }
+};
+
+/// @brief Make an AutoDiffFunctionTpl, deducing the functor type.
+template <typename Scalar, int ChunkSize = 8, typename Functor>
+AutoDiffFunctionTpl<Scalar, Functor, ChunkSize>
+makeAutoDiffFunction(const int ndx, const int nu, const int nr, Functor func) {
+  return {ndx, nu, nr, std::move(func)};
+}
+
+/// @brief Make an AutoDiffDynamicsTpl, deducing the functor type.
+template <typename Scalar, int ChunkSize = 8, typename Functor>
+AutoDiffDynamicsTpl<Scalar, Functor, ChunkSize>
+makeAutoDiffDynamics(const int nx, const int nu, Functor func) {
+  return {nx, nu, std::move(func)};
+}
+
+} // namespace autodiff
+} // namespace aligator
@@ -27,7 +27,9 @@ public:
 
   AngularMomentumResidualTpl(const int ndx, const int nu, const Vector3s &L_ref)
       : Base(ndx, nu, 3)
-      , L_ref_(L_ref) {}
+      , L_ref_(L_ref) {
+    this->jac_pattern = JacobianPattern(ndx - 3, 3, 0, 0);
+  }
 
   const Vector3s &getReference() const { return L_ref_; }
   void setReference(const Eigen::Ref<const Vector3s> &L_new) { L_ref_ = L_new; }
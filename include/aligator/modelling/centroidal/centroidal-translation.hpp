@@ -18,7 +18,9 @@ public:
 
   CentroidalCoMResidualTpl(const int ndx, const int nu, const Vector3s &p_ref)
       : Base(ndx, nu, 3)
-      , p_ref_(p_ref) {}
+      , p_ref_(p_ref) {
+    this->jac_pattern.x_size = 3;
+  }
 
   const Vector3s &getReference() const { return p_ref_; }
   void setReference(const Eigen::Ref<const Vector3s> &p_new) { p_ref_ = p_new; }
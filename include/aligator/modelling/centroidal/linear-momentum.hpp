@@ -26,7 +26,9 @@ public:
 
   LinearMomentumResidualTpl(const int ndx, const int nu, const Vector3s &h_ref)
       : Base(ndx, nu, 3)
-      , h_ref_(h_ref) {}
+      , h_ref_(h_ref) {
+    this->jac_pattern = JacobianPattern(3, 3, 0, 0);
+  }
 
   const Vector3s &getReference() const { return h_ref_; }
   void setReference(const Eigen::Ref<const Vector3s> &h_new) { h_ref_ = h_new; }
@@ -0,0 +1,75 @@
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/core/function-abstract.hpp"
+
+namespace aligator {
+
+/**
+ * @brief This residual implements the "ice cream" friction cones of several
+ * contacts at once, for a centroidal or kinodynamics model whose control
+ * starts with the 3D contact forces \f$u = (f_1, \dots, f_c, \dots) \f$.
+ *
+ * @details For the contacts \f$ k \f$ in `contact_ids`, the residual returns
+ * the conditions of CentroidalFrictionConeResidualTpl stacked by kind: first
+ * \f$ \epsilon - f_{k,z} \f$ for all contacts, then \f$ f_{k,x}^2 +
+ * f_{k,y}^2 - \mu^2 f_{k,z}^2 \f$ for all contacts. The forces are gathered in
+ * one array per component, so that the conditions of all contacts are
+ * evaluated with a few vectorized operations, and only the nonzero entries of
+ * the Jacobian are written. There is no multibody counterpart: multibody
+ * models use one MultibodyFrictionConeResidualTpl per contact.
+ */
+
+template <typename Scalar> struct MultiContactFrictionConeDataTpl;
+
+template <typename _Scalar>
+struct MultiContactFrictionConeResidualTpl : StageFunctionTpl<_Scalar> {
+
+public:
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = StageFunctionTpl<Scalar>;
+  using BaseData = typename Base::Data;
+  using Data = MultiContactFrictionConeDataTpl<Scalar>;
+
+  MultiContactFrictionConeResidualTpl(const int ndx, const int nu,
+                                      const std::vector<int> &contact_ids,
+                                      const double mu, const double epsilon);
+
+  void evaluate(const ConstVectorRef &, const ConstVectorRef &u,
+                BaseData &data) const;
+
+  void computeJacobians(const ConstVectorRef &, const ConstVectorRef &u,
+                        BaseData &data) const;
+
+  shared_ptr<BaseData> createData() const {
+    return std::make_shared<Data>(this);
+  }
+
+  int numContacts() const { return int(contact_ids_.size()); }
+
+  /// Indices of the contacts, i.e. of their forces in the control.
+  std::vector<int> contact_ids_;
+
+protected:
+  double mu2_;
+  double epsilon_;
+};
+
+template <typename Scalar>
+struct MultiContactFrictionConeDataTpl : StageFunctionDataTpl<Scalar> {
+  using Base = StageFunctionDataTpl<Scalar>;
+  using ArrayXs = Eigen::Array<Scalar, Eigen::Dynamic, 1>;
+
+  /// Components of the contact forces.
+  ArrayXs fx_, fy_, fz_;
+
+  MultiContactFrictionConeDataTpl(
+      const MultiContactFrictionConeResidualTpl<Scalar> *model);
+};
+
+} // namespace aligator
+
+#ifdef ALIGATOR_ENABLE_TEMPLATE_INSTANTIATION
+#include "aligator/modelling/centroidal/multi-contact-friction-cone.txx"
+#endif
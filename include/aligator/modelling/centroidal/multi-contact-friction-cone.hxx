@@ -0,0 +1,70 @@
+#pragma once
+
+#include "aligator/modelling/centroidal/multi-contact-friction-cone.hpp"
+
+#include <algorithm>
+
+namespace aligator {
+
+template <typename Scalar>
+MultiContactFrictionConeResidualTpl<Scalar>::
+    MultiContactFrictionConeResidualTpl(const int ndx, const int nu,
+                                        const std::vector<int> &contact_ids,
+                                        const double mu, const double epsilon)
+    : Base(ndx, nu, 2 * int(contact_ids.size()))
+    , contact_ids_(contact_ids)
+    , mu2_(mu * mu)
+    , epsilon_(epsilon) {
+  if (contact_ids.empty())
+    ALIGATOR_DOMAIN_ERROR("At least one contact is required.");
+  const auto [kmin, kmax] =
+      std::minmax_element(contact_ids.begin(), contact_ids.end());
+  if (*kmin < 0 || 3 * (*kmax + 1) > nu)
+    ALIGATOR_DOMAIN_ERROR("Contact indices should be in [0, {:d}).", nu / 3);
+  this->jac_pattern = JacobianPattern(0, 0, 3 * *kmin, 3 * (*kmax - *kmin + 1));
+}
+
+template <typename Scalar>
+void MultiContactFrictionConeResidualTpl<Scalar>::evaluate(
+    const ConstVectorRef &, const ConstVectorRef &u, BaseData &data) const {
+  Data &d = static_cast<Data &>(data);
+  const int nc = numContacts();
+
+  for (int i = 0; i < nc; i++) {
+    const int k = contact_ids_[size_t(i)];
+    d.fx_[i] = u[k * 3];
+    d.fy_[i] = u[k * 3 + 1];
+    d.fz_[i] = u[k * 3 + 2];
+  }
+  d.value_.head(nc) = epsilon_ - d.fz_;
+  d.value_.tail(nc) =
+      d.fx_.square() + d.fy_.square() - mu2_ * d.fz_.square();
+}
+
+template <typename Scalar>
+void MultiContactFrictionConeResidualTpl<Scalar>::computeJacobians(
+    const ConstVectorRef &, const ConstVectorRef &, BaseData &data) const {
+  Data &d = static_cast<Data &>(data);
+  const int nc = numContacts();
+
+  // the normal force rows are constant, set in the data constructor
+  for (int i = 0; i < nc; i++) {
+    const int k = contact_ids_[size_t(i)];
+    d.Ju_(nc + i, k * 3) = 2 * d.fx_[i];
+    d.Ju_(nc + i, k * 3 + 1) = 2 * d.fy_[i];
+    d.Ju_(nc + i, k * 3 + 2) = -2 * mu2_ * d.fz_[i];
+  }
+}
+
+template <typename Scalar>
+MultiContactFrictionConeDataTpl<Scalar>::MultiContactFrictionConeDataTpl(
+    const MultiContactFrictionConeResidualTpl<Scalar> *model)
+    : Base(*model)
+    , fx_(ArrayXs::Zero(model->numContacts()))
+    , fy_(ArrayXs::Zero(model->numContacts()))
+    , fz_(ArrayXs::Zero(model->numContacts())) {
+  for (int i = 0; i < model->numContacts(); i++)
+    this->Ju_(i, model->contact_ids_[size_t(i)] * 3 + 2) = -1.;
+}
+
+} // namespace aligator
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "aligator/context.hpp"
+#include "aligator/modelling/centroidal/multi-contact-friction-cone.hpp"
+
+namespace aligator {
+
+extern template struct MultiContactFrictionConeResidualTpl<context::Scalar>;
+extern template struct MultiContactFrictionConeDataTpl<context::Scalar>;
+
+} // namespace aligator
@@ -0,0 +1,77 @@
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/core/function-abstract.hpp"
+
+namespace aligator {
+
+/**
+ * @brief This residual implements the wrench cones of several rectangular
+ * contacts at once, for a centroidal model whose control starts with the 6D
+ * contact forces \f$u = (f_1, \dots, f_c, \dots) \f$.
+ *
+ * @details For the contacts \f$ k \f$ in `contact_ids`, the residual returns
+ * \f$ A f_k \f$ stacked by contact, with \f$A \in \mathbb{R}^{17 \times 6}\f$
+ * the wrench cone matrix of CentroidalWrenchConeResidualTpl. The forces are
+ * gathered as the columns of a \f$ 6 \times c \f$ matrix, so that all the
+ * cones are evaluated with a single matrix product. The Jacobian is constant,
+ * and set when creating the data. There is no multibody counterpart:
+ * multibody models use one MultibodyWrenchConeResidualTpl per contact.
+ */
+
+template <typename Scalar> struct MultiContactWrenchConeDataTpl;
+
+template <typename _Scalar>
+struct MultiContactWrenchConeResidualTpl : StageFunctionTpl<_Scalar> {
+
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = StageFunctionTpl<Scalar>;
+  using BaseData = typename Base::Data;
+  using Data = MultiContactWrenchConeDataTpl<Scalar>;
+  using Matrix17x6s = Eigen::Matrix<Scalar, 17, 6>;
+
+  MultiContactWrenchConeResidualTpl(const int ndx, const int nu,
+                                    const std::vector<int> &contact_ids,
+                                    const double mu, const double half_length,
+                                    const double half_width);
+
+  void evaluate(const ConstVectorRef &, const ConstVectorRef &u,
+                BaseData &data) const;
+
+  void computeJacobians(const ConstVectorRef &, const ConstVectorRef &,
+                        BaseData &) const {}
+
+  shared_ptr<BaseData> createData() const {
+    return std::make_shared<Data>(this);
+  }
+
+  bool hasConstantJacobians() const { return true; }
+
+  int numContacts() const { return int(contact_ids_.size()); }
+
+  /// Indices of the contacts, i.e. of their forces in the control.
+  std::vector<int> contact_ids_;
+  /// Wrench cone matrix, shared by the contacts.
+  Matrix17x6s A_;
+};
+
+template <typename Scalar>
+struct MultiContactWrenchConeDataTpl : StageFunctionDataTpl<Scalar> {
+  using Base = StageFunctionDataTpl<Scalar>;
+  using Matrix6Xs = typename math_types<Scalar>::Matrix6Xs;
+
+  /// Contact forces, one column per contact.
+  Matrix6Xs forces_;
+
+  MultiContactWrenchConeDataTpl(
+      const MultiContactWrenchConeResidualTpl<Scalar> *model);
+};
+
+} // namespace aligator
+
+#ifdef ALIGATOR_ENABLE_TEMPLATE_INSTANTIATION
+#include "aligator/modelling/centroidal/multi-contact-wrench-cone.txx"
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "aligator/modelling/centroidal/multi-contact-wrench-cone.hpp"
+
+#include <algorithm>
+
+namespace aligator {
+
+template <typename Scalar>
+MultiContactWrenchConeResidualTpl<Scalar>::MultiContactWrenchConeResidualTpl(
+    const int ndx, const int nu, const std::vector<int> &contact_ids,
+    const double mu, const double half_length, const double half_width)
+    : Base(ndx, nu, 17 * int(contact_ids.size()))
+    , contact_ids_(contact_ids) {
+  if (contact_ids.empty())
+    ALIGATOR_DOMAIN_ERROR("At least one contact is required.");
+  const auto [kmin, kmax] =
+      std::minmax_element(contact_ids.begin(), contact_ids.end());
+  if (*kmin < 0 || 6 * (*kmax + 1) > nu)
+    ALIGATOR_DOMAIN_ERROR("Contact indices should be in [0, {:d}).", nu / 6);
+  this->jac_pattern = JacobianPattern(0, 0, 6 * *kmin, 6 * (*kmax - *kmin + 1));
+
+  const Scalar hL = half_length;
+  const Scalar hW = half_width;
+  const Scalar mz = -(hL + hW) * mu;
+  // clang-format off
+  A_ <<   0,   0,  -1,   0,   0,  0, // unilateral contact
+         -1,   0, -mu,   0,   0,  0, // Coulomb friction
+          1,   0, -mu,   0,   0,  0,
+          0,  -1, -mu,   0,   0,  0,
+          0,   1, -mu,   0,   0,  0,
+          0,   0, -hW,  -1,   0,  0, // local CoP
+          0,   0, -hW,   1,   0,  0,
+          0,   0, -hL,   0,  -1,  0,
+          0,   0, -hL,   0,   1,  0,
+        -hW, -hL,  mz,  mu,  mu, -1, // z-torque limits
+        -hW,  hL,  mz,  mu, -mu, -1,
+         hW, -hL,  mz, -mu,  mu, -1,
+         hW,  hL,  mz, -mu, -mu, -1,
+         hW,  hL,  mz,  mu,  mu,  1,
+         hW, -hL,  mz,  mu, -mu,  1,
+        -hW,  hL,  mz, -mu,  mu,  1,
+        -hW, -hL,  mz, -mu, -mu,  1;
+  // clang-format on
+}
+
+template <typename Scalar>
+void MultiContactWrenchConeResidualTpl<Scalar>::evaluate(
+    const ConstVectorRef &, const ConstVectorRef &u, BaseData &data) const {
+  Data &d = static_cast<Data &>(data);
+  const int nc = numContacts();
+
+  for (int i = 0; i < nc; i++)
+    d.forces_.col(i) = u.template segment<6>(contact_ids_[size_t(i)] * 6);
+  Eigen::Map<Eigen::Matrix<Scalar, 17, Eigen::Dynamic>> values(
+      d.value_.data(), 17, nc);
+  values.noalias() = A_ * d.forces_;
+}
+
+template <typename Scalar>
+MultiContactWrenchConeDataTpl<Scalar>::MultiContactWrenchConeDataTpl(
+    const MultiContactWrenchConeResidualTpl<Scalar> *model)
+    : Base(*model)
+    , forces_(Matrix6Xs::Zero(6, model->numContacts())) {
+  for (int i = 0; i < model->numContacts(); i++)
+    this->Ju_.template block<17, 6>(17 * i,
+                                    6 * model->contact_ids_[size_t(i)]) =
+        model->A_;
+}
+
+} // namespace aligator
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "aligator/context.hpp"
+#include "aligator/modelling/centroidal/multi-contact-wrench-cone.hpp"
+
+namespace aligator {
+
+extern template struct MultiContactWrenchConeResidualTpl<context::Scalar>;
+extern template struct MultiContactWrenchConeDataTpl<context::Scalar>;
+
+} // namespace aligator
@@ -3,9 +3,14 @@
 #pragma once
 
 #include "aligator/core/constraint-set.hpp"
+#include "aligator/modelling/constraints/box-constraint.hpp"
+#include "aligator/modelling/constraints/equality-constraint.hpp"
+#include "aligator/modelling/constraints/negative-orthant.hpp"
 #include "aligator/third-party/polymorphic_cxx14.h"
 #include "aligator/utils/span.hpp"
 
+#include <typeinfo>
+
 namespace aligator {
 template <typename Derived>
 auto blockMatrixGetRow(const Eigen::MatrixBase<Derived> &matrix,
@@ -34,7 +39,15 @@ auto blockVectorGetRow(const Eigen::MatrixBase<Derived> &matrix,
 /// @brief Cartesian product of multiple constraint sets.
 /// This class makes computing multipliers and Jacobian matrix projections more
 /// convenient.
+///
+/// @details When all the components are boxes, negative orthants or equality
+/// sets, the product is itself a box (with empty interior for the equality
+/// components). Its bounds are then gathered at construction into flat
+/// vectors, and the projections, active set and projection Jacobians are
+/// computed in a single vectorized pass over the whole input, without going
+/// through the components.
 /// @warning This struct contains a non-owning vector of its component sets.
+/// @warning The bounds of box components are copied at construction.
 /// @todo Switch to using our aligator::BlkMatrix template class.
 template <typename Scalar>
 struct ConstraintSetProductTpl : ConstraintSetTpl<Scalar> {
@@ -50,6 +63,12 @@ struct ConstraintSetProductTpl : ConstraintSetTpl<Scalar> {
       ALIGATOR_RUNTIME_ERROR("Number of components and corresponding "
                              "block sizes should be the same.");
     }
+    m_blockOffsets.resize(blockSizes.size() + 1);
+    m_blockOffsets[0] = 0;
+    for (std::size_t i = 0; i < blockSizes.size(); i++) {
+      m_blockOffsets[i + 1] = m_blockOffsets[i] + blockSizes[i];
+    }
+    m_flat = compileFlatBounds();
   }
 
   ConstraintSetProductTpl(const ConstraintSetProductTpl &) = default;
@@ -58,55 +77,76 @@ struct ConstraintSetProductTpl : ConstraintSetTpl<Scalar> {
   ConstraintSetProductTpl &operator=(ConstraintSetProductTpl &&) = default;
 
   Scalar evaluate(const ConstVectorRef &zproj) const override {
+    if (m_flat)
+      return 0.;
     Scalar res = 0.;
     for (std::size_t i = 0; i < m_components.size(); i++) {
-      auto zblock = blockVectorGetRow(zproj, m_blockSizes, i);
-      res += m_components[i]->evaluate(zblock);
+      res += m_components[i]->evaluate(block(zproj, i));
     }
     return res;
   }
 
   void projection(const ConstVectorRef &z, VectorRef zout) const override {
+    if (m_flat) {
+      zout = z.cwiseMin(m_upper).cwiseMax(m_lower);
+      return;
+    }
     for (std::size_t i = 0; i < m_components.size(); i++) {
-      ConstVectorRef inblock = blockVectorGetRow(z, m_blockSizes, i);
-      VectorRef outblock = blockVectorGetRow(zout, m_blockSizes, i);
-      m_components[i]->projection(inblock, outblock);
+      m_components[i]->projection(block(z, i), block(zout, i));
     }
   }
 
   void normalConeProjection(const ConstVectorRef &z,
                             VectorRef zout) const override {
+    if (m_flat) {
+      zout = z - z.cwiseMin(m_upper).cwiseMax(m_lower);
+      return;
+    }
     for (std::size_t i = 0; i < m_components.size(); i++) {
-      ConstVectorRef inblock = blockVectorGetRow(z, m_blockSizes, i);
-      VectorRef outblock = blockVectorGetRow(zout, m_blockSizes, i);
-      m_components[i]->normalConeProjection(inblock, outblock);
+      m_components[i]->normalConeProjection(block(z, i), block(zout, i));
     }
   }
 
   void applyProjectionJacobian(const ConstVectorRef &z,
                                MatrixRef Jout) const override {
+    if (m_flat) {
+      for (Eigen::Index i = 0; i < z.size(); i++) {
+        if (isActive(z, i))
+          Jout.row(i).setZero();
+      }
+      return;
+    }
     for (std::size_t i = 0; i < m_components.size(); i++) {
-      ConstVectorRef inblock = blockVectorGetRow(z, m_blockSizes, i);
-      MatrixRef outblock = blockMatrixGetRow(Jout, m_blockSizes, i);
-      m_components[i]->applyProjectionJacobian(inblock, outblock);
+      m_components[i]->applyProjectionJacobian(block(z, i),
+                                               blockRows(Jout, i));
     }
   }
 
   void applyNormalConeProjectionJacobian(const ConstVectorRef &z,
                                          MatrixRef Jout) const override {
+    if (m_flat) {
+      for (Eigen::Index i = 0; i < z.size(); i++) {
+        if (!isActive(z, i))
+          Jout.row(i).setZero();
+      }
+      return;
+    }
     for (std::size_t i = 0; i < m_components.size(); i++) {
-      ConstVectorRef inblock = blockVectorGetRow(z, m_blockSizes, i);
-      MatrixRef outblock = blockMatrixGetRow(Jout, m_blockSizes, i);
-      m_components[i]->applyNormalConeProjectionJacobian(inblock, outblock);
+      m_components[i]->applyNormalConeProjectionJacobian(block(z, i),
+                                                         blockRows(Jout, i));
     }
   }
 
   void computeActiveSet(const ConstVectorRef &z,
                         Eigen::Ref<ActiveType> out) const override {
+    if (m_flat) {
+      out.array() = (z.array() > m_upper.array()) ||
+                    (z.array() < m_lower.array()) || m_equality.array();
+      return;
+    }
     for (std::size_t i = 0; i < m_components.size(); i++) {
-      ConstVectorRef inblock = blockVectorGetRow(z, m_blockSizes, i);
-      decltype(out) outblock = blockVectorGetRow(out, m_blockSizes, i);
-      m_components[i]->computeActiveSet(inblock, outblock);
+      decltype(out) outblock = block(out, i);
+      m_components[i]->computeActiveSet(block(z, i), outblock);
     }
   }
 
@@ -115,9 +155,69 @@ struct ConstraintSetProductTpl : ConstraintSetTpl<Scalar> {
   }
   const std::vector<Eigen::Index> &blockSizes() const { return m_blockSizes; }
 
+  /// Whether the product is projected by the flat kernel, i.e. all components
+  /// are boxes, negative orthants or equality sets.
+  bool isFlat() const { return m_flat; }
+
 private:
+  template <typename Derived>
+  auto block(const Eigen::MatrixBase<Derived> &z, std::size_t i) const {
+    return z.const_cast_derived().segment(m_blockOffsets[i], m_blockSizes[i]);
+  }
+
+  template <typename Derived>
+  auto blockRows(const Eigen::MatrixBase<Derived> &J, std::size_t i) const {
+    return J.const_cast_derived().middleRows(m_blockOffsets[i],
+                                             m_blockSizes[i]);
+  }
+
+  bool isActive(const ConstVectorRef &z, Eigen::Index i) const {
+    return m_equality[i] || (z[i] > m_upper[i]) || (z[i] < m_lower[i]);
+  }
+
+  /// Gather the bounds of the components, if they are all boxes. The types
+  /// are matched exactly: subclasses may override the projections.
+  bool compileFlatBounds() {
+    const Eigen::Index nr = m_blockOffsets.back();
+    m_lower.setConstant(nr, -std::numeric_limits<Scalar>::infinity());
+    m_upper.setConstant(nr, std::numeric_limits<Scalar>::infinity());
+    m_equality.setConstant(nr, false);
+    for (std::size_t i = 0; i < m_components.size(); i++) {
+      const Base &set = *m_components[i];
+      const std::type_info &type = typeid(set);
+      auto lower = block(m_lower, i);
+      auto upper = block(m_upper, i);
+      if (type == typeid(NegativeOrthantTpl<Scalar>)) {
+        upper.setZero();
+      } else if (type == typeid(EqualityConstraintTpl<Scalar>)) {
+        lower.setZero();
+        upper.setZero();
+        block(m_equality, i).setConstant(true);
+      } else if (type == typeid(BoxConstraintTpl<Scalar>)) {
+        const auto &box = static_cast<const BoxConstraintTpl<Scalar> &>(set);
+        lower = box.lower_limit;
+        upper = box.upper_limit;
+      } else {
+        m_lower.resize(0);
+        m_upper.resize(0);
+        m_equality.resize(0);
+        return false;
+      }
+    }
+    return true;
+  }
+
   std::vector<xyz::polymorphic<Base>> m_components;
   std::vector<Eigen::Index> m_blockSizes;
+  /// Start of each block, followed by the total size.
+  std::vector<Eigen::Index> m_blockOffsets;
+  bool m_flat;
+  /// @name Bounds of the flat kernel
+  /// @{
+  VectorXs m_lower;
+  VectorXs m_upper;
+  ActiveType m_equality;
+  /// @}
 };
 
 } // namespace aligator
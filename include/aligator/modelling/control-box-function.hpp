@@ -47,6 +47,8 @@ struct ALIGATOR_DEPRECATED_MESSAGE(
   /// @copybrief Base::createData()
   /// @details   This override sets the appropriate values of the Jacobians.
   virtual shared_ptr<Data> createData() const override;
+
+  bool hasConstantJacobians() const override { return true; }
 };
 
 } // namespace aligator
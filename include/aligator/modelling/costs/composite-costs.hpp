@@ -5,6 +5,7 @@
 #include "aligator/fwd.hpp"
 #include "aligator/core/function-abstract.hpp"
 #include "aligator/core/cost-abstract.hpp"
+#include "aligator/core/stage-parameters.hpp"
 
 #include <fmt/ostream.h>
 
@@ -21,6 +22,8 @@ struct CompositeCostDataTpl : CostDataAbstractTpl<Scalar> {
   shared_ptr<StageFunctionData> residual_data;
   RowMatrixXs JtW_buf;
   VectorXs Wv_buf;
+  /// Weights, if the cost reads them from the stage parameters.
+  StageParameterViewTpl<Scalar> weights;
   CompositeCostDataTpl(const int ndx, const int nu,
                        shared_ptr<StageFunctionData> rdata)
       : Base(ndx, nu)
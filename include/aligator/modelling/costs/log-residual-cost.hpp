@@ -52,6 +52,10 @@ template <typename Scalar> struct LogResidualCostTpl : CostAbstractTpl<Scalar> {
                                   residual_->createData());
   }
 
+  void registerParameters(StageParametersTpl<Scalar> &params) const {
+    residual_->registerParameters(params);
+  }
+
   /// @brief Get a pointer to the underlying type of the residual, by attempting
   /// to cast.
   template <typename Derived> Derived *getResidual() {
@@ -50,7 +50,7 @@ void LogResidualCostTpl<Scalar>::computeGradients(
   MatrixRef J = res_data.jac_buffer_.leftCols(data.grad_.size());
   residual_->computeJacobians(x, u, res_data);
   d.grad_.setZero();
-  VectorXs &v = res_data.value_;
+  const auto &v = res_data.value_;
   const int nrows = residual_->nr;
   for (int i = 0; i < nrows; i++) {
     auto g_i = J.row(i);
@@ -67,7 +67,7 @@ void LogResidualCostTpl<Scalar>::computeHessians(const ConstVectorRef &,
   const Eigen::Index size = data.grad_.size();
   d.hess_.setZero();
   MatrixRef J = res_data.jac_buffer_.leftCols(size);
-  VectorXs &v = res_data.value_;
+  const auto &v = res_data.value_;
   const int nrows = residual_->nr;
   for (int i = 0; i < nrows; i++) {
     auto g_i = J.row(i); // row vector
@@ -103,6 +103,8 @@ public:
   void computeHessians(const ConstVectorRef &, const ConstVectorRef &,
                        CostData &) const {}
 
+  bool hasConstantHessians() const { return true; }
+
   shared_ptr<CostData> createData() const {
     auto data = std::make_shared<Data>(this->ndx(), this->nu);
     data->Lxx_ = Wxx_;
@@ -27,6 +27,9 @@ struct QuadraticResidualCostTpl : CostAbstractTpl<_Scalar> {
   MatrixXs weights_;
   xyz::polymorphic<StageFunction> residual_;
   bool gauss_newton = true;
+  /// Name of the stage parameter slot to read the weights from (column-major),
+  /// if not empty.
+  std::string weights_parameter_;
 
   QuadraticResidualCostTpl(xyz::polymorphic<Manifold> space,
                            xyz::polymorphic<StageFunction> function,
@@ -42,8 +45,34 @@ struct QuadraticResidualCostTpl : CostAbstractTpl<_Scalar> {
                        CostData &data_) const;
 
   shared_ptr<CostData> createData() const {
-    return std::make_shared<Data>(this->ndx(), this->nu,
-                                  residual_->createData());
+    auto data = std::make_shared<Data>(this->ndx(), this->nu,
+                                       residual_->createData());
+    data->weights = StageParameterViewTpl<Scalar>(weights_parameter_,
+                                                  weights_.size());
+    return data;
+  }
+
+  void registerParameters(StageParametersTpl<Scalar> &params) const {
+    residual_->registerParameters(params);
+    if (!weights_parameter_.empty())
+      params.declareSlot(weights_parameter_,
+                         Eigen::Map<const VectorXs>(weights_.data(),
+                                                    weights_.size()));
+  }
+
+  /// Gauss-Newton Hessians of residuals with constant Jacobians, if the
+  /// weights are not read from the stage parameters.
+  bool hasConstantHessians() const {
+    return gauss_newton && weights_parameter_.empty() &&
+           residual_->hasConstantJacobians();
+  }
+
+  /// Weights used with @p data: weights_, or the stage parameters.
+  ConstMatrixRef getWeights(const Data &data) const {
+    if (!data.weights.isBound())
+      return weights_;
+    return Eigen::Map<const MatrixXs>(data.weights.value().data(),
+                                      weights_.rows(), weights_.cols());
   }
 
   /// @brief Get a pointer to the underlying type of the residual, by attempting
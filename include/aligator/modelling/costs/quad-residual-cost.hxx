@@ -27,7 +27,7 @@ void QuadraticResidualCostTpl<Scalar>::evaluate(const ConstVectorRef &x,
   StageFunctionDataTpl<Scalar> &under_data = *data.residual_data;
   residual_->evaluate(x, u, under_data);
   ALIGATOR_NOMALLOC_SCOPED;
-  data.Wv_buf.noalias() = weights_ * under_data.value_;
+  data.Wv_buf.noalias() = getWeights(data) * under_data.value_;
   data.value_ = .5 * under_data.value_.dot(data.Wv_buf);
 }
 
@@ -39,10 +39,21 @@ void QuadraticResidualCostTpl<Scalar>::computeGradients(const ConstVectorRef &x,
   StageFunctionDataTpl<Scalar> &under_data = *data.residual_data;
   residual_->computeJacobians(x, u, under_data);
   const Eigen::Index size = data.grad_.size();
+  const JacobianPattern &p = residual_->jac_pattern;
   ALIGATOR_NOMALLOC_SCOPED;
-  MatrixRef J = under_data.jac_buffer_.leftCols(size);
-  data.Wv_buf.noalias() = weights_ * under_data.value_;
-  data.grad_.noalias() = J.transpose() * data.Wv_buf;
+  data.Wv_buf.noalias() = getWeights(data) * under_data.value_;
+  if (p.isDense(under_data.ndx1, under_data.nu)) {
+    MatrixRef J = under_data.jac_buffer_.leftCols(size);
+    data.grad_.noalias() = J.transpose() * data.Wv_buf;
+    return;
+  }
+  // the other entries of the gradient are zero since construction
+  data.Lx_.segment(p.x_begin, p.x_size).noalias() =
+      under_data.Jx_.middleCols(p.x_begin, p.x_size).transpose() *
+      data.Wv_buf;
+  data.Lu_.segment(p.u_begin, p.u_size).noalias() =
+      under_data.Ju_.middleCols(p.u_begin, p.u_size).transpose() *
+      data.Wv_buf;
 }
 
 template <typename Scalar>
@@ -53,8 +64,29 @@ void QuadraticResidualCostTpl<Scalar>::computeHessians(const ConstVectorRef &x,
   Data &data = static_cast<Data &>(data_);
   StageFunctionDataTpl<Scalar> &under_data = *data.residual_data;
   const Eigen::Index size = data.grad_.size();
+  const JacobianPattern &p = residual_->jac_pattern;
+  if (gauss_newton && !p.isDense(under_data.ndx1, under_data.nu)) {
+    // only form the blocks of J^T W J for the nonzero columns of J, the
+    // other entries of the Hessian are zero since construction
+    const ConstMatrixRef W = getWeights(data);
+    const auto Jx = under_data.Jx_.middleCols(p.x_begin, p.x_size);
+    const auto Ju = under_data.Ju_.middleCols(p.u_begin, p.u_size);
+    auto JxtW = data.JtW_buf.middleRows(p.x_begin, p.x_size);
+    auto JutW = data.JtW_buf.middleRows(under_data.ndx1 + p.u_begin, p.u_size);
+    JxtW.noalias() = Jx.transpose() * W;
+    JutW.noalias() = Ju.transpose() * W;
+    auto Lxu = data.Lxu_.block(p.x_begin, p.u_begin, p.x_size, p.u_size);
+    data.Lxx_.block(p.x_begin, p.x_begin, p.x_size, p.x_size).noalias() =
+        JxtW * Jx;
+    Lxu.noalias() = JxtW * Ju;
+    data.Lux_.block(p.u_begin, p.x_begin, p.u_size, p.x_size) =
+        Lxu.transpose();
+    data.Luu_.block(p.u_begin, p.u_begin, p.u_size, p.u_size).noalias() =
+        JutW * Ju;
+    return;
+  }
   MatrixRef J = under_data.jac_buffer_.leftCols(size);
-  data.JtW_buf.noalias() = J.transpose() * weights_;
+  data.JtW_buf.noalias() = J.transpose() * getWeights(data);
   data.hess_.noalias() = data.JtW_buf * J;
   if (!gauss_newton) {
     ALIGATOR_NOMALLOC_END;
@@ -16,6 +16,8 @@ struct QuadraticStateCostTpl : QuadraticResidualCostTpl<Scalar> {
   using StateError = StateErrorResidualTpl<Scalar>;
   using Manifold = ManifoldAbstractTpl<Scalar>;
   using StageFunction = StageFunctionTpl<Scalar>;
+  using typename Base::CostData;
+  using typename Base::Data;
 
   // StateError's space variable holds a pointer to the state manifold
   QuadraticStateCostTpl(const StateError &resdl, const MatrixXs &weights)
@@ -35,6 +37,21 @@ struct QuadraticStateCostTpl : QuadraticResidualCostTpl<Scalar> {
 
   void setTarget(const ConstVectorRef target) { residual().target_ = target; }
   ConstVectorRef getTarget() const { return residual().target_; }
+  /// Read the target from stage parameter slot @p name, see
+  /// StageParametersTpl.
+  void setTargetParameter(const std::string &name) {
+    residual().target_parameter_ = name;
+  }
+
+  /// The Jacobian of the state error is the identity past the non-Euclidean
+  /// block of the state space (see ManifoldAbstractTpl::nonEuclideanDim()),
+  /// only the products with this block are formed.
+  void computeGradients(const ConstVectorRef &x, const ConstVectorRef &u,
+                        CostData &data_) const;
+
+  /// @copydoc computeGradients()
+  void computeHessians(const ConstVectorRef &x, const ConstVectorRef &u,
+                       CostData &data_) const;
 
 protected:
   StateError &residual() { return static_cast<StateError &>(*this->residual_); }
@@ -69,6 +86,11 @@ struct QuadraticControlCostTpl : QuadraticResidualCostTpl<Scalar> {
 
   void setTarget(const ConstVectorRef &target) { residual().target_ = target; }
   ConstVectorRef getTarget() const { return residual().target_; }
+  /// Read the target from stage parameter slot @p name, see
+  /// StageParametersTpl.
+  void setTargetParameter(const std::string &name) {
+    residual().target_parameter_ = name;
+  }
 
 protected:
   ControlError &residual() {
@@ -81,6 +103,8 @@ protected:
 
 } // namespace aligator
 
+#include "./quad-state-cost.hxx"
+
 #ifdef ALIGATOR_ENABLE_TEMPLATE_INSTANTIATION
 #include "./quad-state-cost.txx"
 #endif
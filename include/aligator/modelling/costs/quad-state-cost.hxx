@@ -0,0 +1,53 @@
+/// @file
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "./quad-state-cost.hpp"
+
+namespace aligator {
+
+template <typename Scalar>
+void QuadraticStateCostTpl<Scalar>::computeGradients(const ConstVectorRef &x,
+                                                     const ConstVectorRef &u,
+                                                     CostData &data_) const {
+  const int ndx = this->ndx();
+  const int k = residual().space_->nonEuclideanDim();
+  if (k == ndx) {
+    Base::computeGradients(x, u, data_);
+    return;
+  }
+  Data &data = static_cast<Data &>(data_);
+  StageFunctionDataTpl<Scalar> &under_data = *data.residual_data;
+  residual().computeJacobians(x, u, under_data);
+  ALIGATOR_NOMALLOC_SCOPED;
+  data.Wv_buf.noalias() = this->getWeights(data) * under_data.value_;
+  // J = diag(J_k, I), the control gradient is zero since construction
+  data.Lx_.head(k).noalias() =
+      under_data.Jx_.topLeftCorner(k, k).transpose() * data.Wv_buf.head(k);
+  data.Lx_.tail(ndx - k) = data.Wv_buf.tail(ndx - k);
+}
+
+template <typename Scalar>
+void QuadraticStateCostTpl<Scalar>::computeHessians(const ConstVectorRef &x,
+                                                    const ConstVectorRef &u,
+                                                    CostData &data_) const {
+  const int ndx = this->ndx();
+  const int k = residual().space_->nonEuclideanDim();
+  if (!this->gauss_newton || k == ndx) {
+    Base::computeHessians(x, u, data_);
+    return;
+  }
+  ALIGATOR_NOMALLOC_SCOPED;
+  Data &data = static_cast<Data &>(data_);
+  const StageFunctionDataTpl<Scalar> &under_data = *data.residual_data;
+  const ConstMatrixRef W = this->getWeights(data);
+  const auto Jk = under_data.Jx_.topLeftCorner(k, k);
+  // J^T W J with J = diag(J_k, I)
+  auto JtW = data.JtW_buf.topRows(ndx);
+  JtW.topRows(k).noalias() = Jk.transpose() * W.topRows(k);
+  JtW.bottomRows(ndx - k) = W.bottomRows(ndx - k);
+  data.Lxx_.leftCols(k).noalias() = JtW.leftCols(k) * Jk;
+  data.Lxx_.rightCols(ndx - k) = JtW.rightCols(ndx - k);
+}
+
+} // namespace aligator
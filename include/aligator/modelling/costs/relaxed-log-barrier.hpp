@@ -43,6 +43,10 @@ struct RelaxedLogBarrierCostTpl : CostAbstractTpl<Scalar> {
                                   residual_->createData());
   }
 
+  void registerParameters(StageParametersTpl<Scalar> &params) const {
+    residual_->registerParameters(params);
+  }
+
   /// @brief Get a pointer to the underlying type of the residual, by attempting
   /// to cast.
   template <typename Derived> Derived *getResidual() {
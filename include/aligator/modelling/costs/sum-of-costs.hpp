@@ -1,9 +1,11 @@
 #pragma once
 
 #include "aligator/core/cost-abstract.hpp"
-// Faster than std::unordered_map with Bost 1.80
-// https://martin.ankerl.com/2022/08/27/hashmap-bench-01/#boost__unordered_map
-#include <boost/unordered_map.hpp>
+// Sorted by key: a data iterates in the same order as its model (or a copy of
+// it), and references to the components stay valid when others are added.
+#include <map>
+#include <string>
+#include <variant>
 
 namespace aligator {
 
@@ -15,6 +17,11 @@ template <typename Scalar> struct CostStackDataTpl;
  * \f[
  *    \ell(x, u) = \sum_{k=1}^{K} \ell^{(k)}(x, u).
  * \f]
+ *
+ * With stacked_gauss_newton, the Gauss-Newton Hessians of the
+ * QuadraticResidualCostTpl components are formed at once: their residual
+ * Jacobians are stacked into a single matrix \f$J\f$ and the Hessian is
+ * \f$J^\top WJ\f$, with \f$W\f$ block-diagonal.
  */
 template <typename _Scalar> struct CostStackTpl : CostAbstractTpl<_Scalar> {
   using Scalar = _Scalar;
@@ -26,10 +33,15 @@ template <typename _Scalar> struct CostStackTpl : CostAbstractTpl<_Scalar> {
   using Manifold = ManifoldAbstractTpl<Scalar>;
   using CostItem = std::pair<PolyCost, Scalar>;
   using CostKey = std::variant<std::size_t, std::string>;
-  using CostMap = boost::unordered::unordered_map<CostKey, CostItem>;
+  using CostMap = std::map<CostKey, CostItem>;
   using CostIterator = typename CostMap::iterator;
 
   CostMap components_;
+  /// @brief Form the Gauss-Newton Hessians of the QuadraticResidualCostTpl
+  /// components with a single product, see the class description.
+  /// @details Must be set before creating the data. The Hessians of the
+  /// stacked components' own datas are then left untouched.
+  bool stacked_gauss_newton = false;
 
   /// @brief    Check the dimension of a component.
   /// @returns  A bool value indicating whether the component is OK to be added
@@ -114,6 +126,19 @@ template <typename _Scalar> struct CostStackTpl : CostAbstractTpl<_Scalar> {
                        CostData &data) const;
 
   shared_ptr<CostData> createData() const;
+
+  void registerParameters(StageParametersTpl<Scalar> &params) const {
+    for (const auto &[key, item] : components_)
+      item.first->registerParameters(params);
+  }
+
+  bool hasConstantHessians() const {
+    for (const auto &[key, item] : components_) {
+      if (!item.first->hasConstantHessians())
+        return false;
+    }
+    return true;
+  }
 };
 
 namespace {
@@ -162,12 +187,20 @@ operator*(T u, xyz::polymorphic<CostStackTpl<T>> &&c1) {
 template <typename _Scalar>
 struct CostStackDataTpl : CostDataAbstractTpl<_Scalar> {
   using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
   using CostData = CostDataAbstractTpl<Scalar>;
   using CostStack = CostStackTpl<Scalar>;
   using CostKey = typename CostStack::CostKey;
-  using DataMap =
-      boost::unordered::unordered_map<CostKey, shared_ptr<CostData>>;
+  using DataMap = std::map<CostKey, shared_ptr<CostData>>;
   DataMap sub_cost_data;
+  /// Stacked residual Jacobians of the components, for
+  /// CostStackTpl::stacked_gauss_newton.
+  MatrixXs stacked_jac;
+  /// Rows of stacked_jac, multiplied by the weights of their components.
+  MatrixXs stacked_wjac;
+  /// The rows of the k-th component in stacked_jac are
+  /// `[stacked_offsets[k], stacked_offsets[k+1])`, empty if not stacked.
+  std::vector<Eigen::Index> stacked_offsets;
   CostStackDataTpl(const CostStackTpl<Scalar> &obj);
 };
 } // namespace aligator
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "aligator/modelling/costs/sum-of-costs.hpp"
+#include "aligator/modelling/costs/quad-residual-cost.hpp"
 
 namespace aligator {
 template <typename Scalar>
@@ -59,10 +60,13 @@ void CostStackTpl<Scalar>::evaluate(const ConstVectorRef &x,
                                     const ConstVectorRef &u,
                                     CostData &data) const {
   SumCostData &d = static_cast<SumCostData &>(data);
+  assert(d.sub_cost_data.size() == components_.size());
   d.value_ = 0.;
+  auto dit = d.sub_cost_data.begin();
   for (const auto &[key, item] : components_) {
-    item.first->evaluate(x, u, *d.sub_cost_data[key]);
-    d.value_ += item.second * d.sub_cost_data[key]->value_;
+    CostData &cd = *(dit++)->second;
+    item.first->evaluate(x, u, cd);
+    d.value_ += item.second * cd.value_;
   }
 }
 
@@ -72,9 +76,11 @@ void CostStackTpl<Scalar>::computeGradients(const ConstVectorRef &x,
                                             CostData &data) const {
   SumCostData &d = static_cast<SumCostData &>(data);
   d.grad_.setZero();
+  auto dit = d.sub_cost_data.begin();
   for (const auto &[key, item] : components_) {
-    item.first->computeGradients(x, u, *d.sub_cost_data[key]);
-    d.grad_.noalias() += item.second * d.sub_cost_data[key]->grad_;
+    CostData &cd = *(dit++)->second;
+    item.first->computeGradients(x, u, cd);
+    d.grad_.noalias() += item.second * cd.grad_;
   }
 }
 
@@ -82,12 +88,36 @@ template <typename Scalar>
 void CostStackTpl<Scalar>::computeHessians(const ConstVectorRef &x,
                                            const ConstVectorRef &u,
                                            CostData &data) const {
+  using QuadResCost = QuadraticResidualCostTpl<Scalar>;
+  using QuadResData = typename QuadResCost::Data;
   SumCostData &d = static_cast<SumCostData &>(data);
   d.hess_.setZero();
+  bool any_stacked = false;
+  auto dit = d.sub_cost_data.begin();
+  std::size_t k = 0;
   for (const auto &[key, item] : components_) {
-    item.first->computeHessians(x, u, *d.sub_cost_data[key]);
-    d.hess_.noalias() += item.second * d.sub_cost_data[key]->hess_;
+    CostData &cd = *(dit++)->second;
+    const Eigen::Index row = d.stacked_offsets[k];
+    const Eigen::Index nrows = d.stacked_offsets[++k] - row;
+    if (nrows > 0) {
+      const auto &qres = static_cast<const QuadResCost &>(*item.first);
+      auto wjac = d.stacked_wjac.middleRows(row, nrows);
+      if (qres.gauss_newton) {
+        // the residual Jacobians were computed with the gradients
+        const QuadResData &qd = static_cast<const QuadResData &>(cd);
+        auto jac = d.stacked_jac.middleRows(row, nrows);
+        jac = qd.residual_data->jac_buffer_.leftCols(jac.cols());
+        wjac.noalias() = item.second * qres.getWeights(qd) * jac;
+        any_stacked = true;
+        continue;
+      }
+      wjac.setZero();
+    }
+    item.first->computeHessians(x, u, cd);
+    d.hess_.noalias() += item.second * cd.hess_;
   }
+  if (any_stacked)
+    d.hess_.noalias() += d.stacked_jac.transpose() * d.stacked_wjac;
 }
 
 template <typename Scalar>
@@ -101,9 +131,20 @@ CostStackTpl<Scalar>::createData() const {
 template <typename Scalar>
 CostStackDataTpl<Scalar>::CostStackDataTpl(const CostStackTpl<Scalar> &obj)
     : CostData(obj.ndx(), obj.nu) {
+  using QuadResCost = QuadraticResidualCostTpl<Scalar>;
+  stacked_offsets.reserve(obj.components_.size() + 1);
+  stacked_offsets.push_back(0);
+  Eigen::Index nrows = 0;
   for (const auto &[key, item] : obj.components_) {
-    sub_cost_data[key] = item.first->createData();
+    sub_cost_data.emplace_hint(sub_cost_data.end(), key,
+                               item.first->createData());
+    const auto *qres = dynamic_cast<const QuadResCost *>(&*item.first);
+    if (obj.stacked_gauss_newton && qres != nullptr)
+      nrows += qres->residual_->nr;
+    stacked_offsets.push_back(nrows);
   }
+  stacked_jac.setZero(nrows, obj.ndx() + obj.nu);
+  stacked_wjac.setZero(nrows, obj.ndx() + obj.nu);
 }
 
 } // namespace aligator
@@ -54,6 +54,12 @@ template <typename Scalar> struct IntegratorSemiImplDataTpl;
 // fwd IntegratorRK2Tpl;
 template <typename Scalar> struct IntegratorRK2Tpl;
 
+// fwd IntegratorRK4Tpl;
+template <typename Scalar> struct IntegratorRK4Tpl;
+
+// fwd IntegratorRK23Tpl;
+template <typename Scalar> struct IntegratorRK23Tpl;
+
 } // namespace dynamics
 
 namespace context {
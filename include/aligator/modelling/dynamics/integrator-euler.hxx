@@ -34,10 +34,7 @@ void IntegratorEulerTpl<Scalar>::dForward(
   this->ode_->dForward(x, u, cdata);
   d.Jx() = timestep_ * cdata.Jx(); // ddx_dx
   d.Ju() = timestep_ * cdata.Ju(); // ddx_du
-  this->space_next().JintegrateTransport(x, d.dx_, d.Jx(), 1);
-  this->space_next().Jintegrate(x, d.dx_, d.Jtmp_xnext, 0);
-  d.Jx() += d.Jtmp_xnext;
-  this->space_next().JintegrateTransport(x, d.dx_, d.Ju(), 1);
+  this->JintegrateStep(x, d.dx_, d.Jx(), d.Ju(), d.Jtmp_xnext);
 }
 } // namespace dynamics
 } // namespace aligator
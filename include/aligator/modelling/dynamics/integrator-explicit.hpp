@@ -18,6 +18,7 @@ namespace dynamics {
 template <typename _Scalar>
 struct ExplicitIntegratorAbstractTpl : ExplicitDynamicsModelTpl<_Scalar> {
   using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
   using ODEType = ODEAbstractTpl<Scalar>;
   using Base = ExplicitDynamicsModelTpl<Scalar>;
   using typename Base::Data;
@@ -48,6 +49,26 @@ struct ExplicitIntegratorAbstractTpl : ExplicitDynamicsModelTpl<_Scalar> {
   shared_ptr<Data> createData() const {
     return std::make_shared<DerivedData>(*this);
   }
+
+  /// @brief Derivatives of the step \f$x \oplus dx\f$, from those of the
+  /// increment \f$dx\f$ held in @p Jx and @p Ju (overwritten).
+  ///
+  /// Only the non-Euclidean block of the state space (see
+  /// ManifoldAbstractTpl::nonEuclideanDim()) goes through the transports and
+  /// the Jacobian of the integration, which are identities on the other
+  /// coordinates. @p Jtmp is a `ndx x ndx` workspace.
+  void JintegrateStep(const ConstVectorRef &x, const ConstVectorRef &dx,
+                      MatrixRef Jx, MatrixRef Ju, MatrixRef Jtmp) const {
+    const Manifold &space = this->space_next();
+    const int k = space.nonEuclideanDim();
+    if (k > 0) {
+      space.JintegrateTransport(x, dx, Jx, 1);
+      space.JintegrateTransport(x, dx, Ju, 1);
+      space.Jintegrate(x, dx, Jtmp, 0);
+      Jx.topLeftCorner(k, k) += Jtmp.topLeftCorner(k, k);
+    }
+    Jx.diagonal().tail(space.ndx() - k).array() += Scalar(1);
+  }
 };
 
 template <typename _Scalar>
@@ -47,6 +47,16 @@ void IntegratorMidpointTpl<Scalar>::computeJacobians(
   const Manifold &space = contdyn.space();
   auto &contdata = d.continuous_data;
 
+  if (space.isEuclidean()) {
+    // x1 = (x + y) / 2 and xdot = (y - x) / timestep
+    contdyn.computeJacobians(d.x1_, u, d.xdot_, *contdata);
+    const Scalar dt_2 = 0.5 * timestep_;
+    data.Jx_ = dt_2 * contdata->Jx_ - contdata->Jxdot_;
+    data.Ju_ = contdata->Ju_ * timestep_;
+    data.Jy_ = dt_2 * contdata->Jx_ + contdata->Jxdot_;
+    return;
+  }
+
   auto dx = d.dx1_ * 2;
   // jacobians of xdot estimate
   space.Jdifference(x, y, d.J_v_0, 0);
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "aligator/modelling/dynamics/integrator-explicit.hpp"
+#include "aligator/core/shared-data-scope.hpp"
 
 namespace aligator {
 namespace dynamics {
@@ -52,7 +53,12 @@ struct IntegratorRK2DataTpl : ExplicitIntegratorDataTpl<Scalar> {
       : Base(integrator)
       , x1_(integrator.space_next().neutral())
       , dx1_(this->ndx1) {
-    continuous_data2 = integrator.ode_->createData();
+    {
+      // the ODE is evaluated at x1 != x: keep the objects its data shares
+      // (e.g. kinematics caches) apart from the ones of the stage at x
+      SharedDataScope scope;
+      continuous_data2 = integrator.ode_->createData();
+    }
     dx1_.setZero();
   }
 
@@ -45,21 +45,14 @@ void IntegratorRK2Tpl<Scalar>::dForward(const ConstVectorRef &x,
   Scalar dt_2_ = 0.5 * timestep_;
   d.Jx() = dt_2_ * cd1.Jx();
   d.Ju() = dt_2_ * cd1.Ju();
-  this->space_next_->JintegrateTransport(x, d.dx1_, d.Jx(), 1);
-  this->space_next_->JintegrateTransport(x, d.dx1_, d.Ju(), 1);
-  this->space_next_->Jintegrate(x, d.dx1_, d.Jtmp_xnext, 0);
-  d.Jx() += d.Jtmp_xnext;
+  this->JintegrateStep(x, d.dx1_, d.Jx(), d.Ju(), d.Jtmp_xnext);
 
   // J = d(x+dx)_dz = d(x+dx)_dx1 * dx1_dz
   // then transport J to xnext = exp(dx) * x1
   this->ode_->dForward(d.x1_, u, cd2);
   d.Jx() = (timestep_ * cd2.Jx()) * d.Jx();
   d.Ju() = (timestep_ * cd2.Jx()) * d.Ju() + timestep_ * cd2.Ju();
-  this->space_next_->JintegrateTransport(d.x1_, d.dx_, d.Jx(), 1);
-  this->space_next_->JintegrateTransport(d.x1_, d.dx_, d.Ju(), 1);
-
-  this->space_next_->Jintegrate(d.x1_, d.dx_, d.Jtmp_xnext, 0);
-  d.Jx() += d.Jtmp_xnext;
+  this->JintegrateStep(d.x1_, d.dx_, d.Jx(), d.Ju(), d.Jtmp_xnext);
 }
 
 } // namespace dynamics
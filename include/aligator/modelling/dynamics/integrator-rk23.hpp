@@ -0,0 +1,91 @@
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/modelling/dynamics/integrator-explicit.hpp"
+
+#include <array>
+
+namespace aligator {
+namespace dynamics {
+template <typename Scalar> struct IntegratorRK23DataTpl;
+
+/** @brief  Embedded Runge-Kutta pair of orders 3 and 2 (Bogacki-Shampine),
+ * which reports an estimate of its local error.
+ *
+ * \f{eqnarray*}{
+ *    x_{k+1} = x_k \oplus \frac h9 (2k_1 + 3k_2 + 4k_3), \\
+ *    k_1 = f(x_k, u_k),\quad
+ *    k_2 = f(x_k \oplus \frac h2 k_1, u_k),\quad
+ *    k_3 = f(x_k \oplus \frac{3h}{4} k_2, u_k).
+ * \f}
+ *
+ * The step is taken with the third-order solution. The forward pass also
+ * evaluates \f$k_4 = f(x_{k+1}, u_k)\f$ to form the difference with the
+ * embedded second-order solution, \f[
+ *    e_k = h \left(-\frac{5}{72} k_1 + \frac{1}{12} k_2 + \frac19 k_3 -
+ *    \frac18 k_4 \right),
+ * \f] an \f$O(h^3)\f$ estimate of the local error of the step, stored in the
+ * data (e.g. to choose the time steps of a problem). The derivatives are
+ * those of \f$x_{k+1}\f$, which do not involve \f$k_4\f$; they are propagated
+ * through the stages by the chain rule, reusing the ODE datas of the forward
+ * pass as in IntegratorRK2Tpl.
+ */
+template <typename _Scalar>
+struct IntegratorRK23Tpl : ExplicitIntegratorAbstractTpl<_Scalar> {
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = ExplicitIntegratorAbstractTpl<Scalar>;
+  using BaseData = ExplicitDynamicsDataTpl<Scalar>;
+  using Data = IntegratorRK23DataTpl<Scalar>;
+  using ODEType = typename Base::ODEType;
+
+  Scalar timestep_;
+
+  IntegratorRK23Tpl(const xyz::polymorphic<ODEType> &cont_dynamics,
+                    const Scalar timestep);
+  void forward(const ConstVectorRef &x, const ConstVectorRef &u,
+               BaseData &data) const;
+  void dForward(const ConstVectorRef &x, const ConstVectorRef &u,
+                BaseData &data) const;
+
+  shared_ptr<BaseData> createData() const {
+    return std::make_shared<Data>(*this);
+  }
+};
+
+template <typename Scalar>
+struct IntegratorRK23DataTpl : ExplicitIntegratorDataTpl<Scalar> {
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = ExplicitIntegratorDataTpl<Scalar>;
+  using ODEData = ContinuousDynamicsDataTpl<Scalar>;
+  /// ODE datas of the stages 2 and 3 (the first one is `continuous_data`).
+  std::array<shared_ptr<ODEData>, 2> stage_datas_;
+  /// ODE data at the next state, for the error estimate.
+  shared_ptr<ODEData> continuous_data_next;
+  /// Points \f$x_k \oplus dx_i\f$ of the stages 2 and 3.
+  std::array<VectorXs, 2> stage_xs_;
+  /// Increments \f$dx_i\f$ of the stages 2 and 3.
+  std::array<VectorXs, 2> stage_dxs_;
+  /// Local error estimate \f$e_k\f$, in the tangent space at \f$x_k\f$.
+  VectorXs error_;
+
+  /// Derivatives of the slope of the current stage.
+  MatrixXs Kx_, Ku_;
+  /// Derivatives of the point of the current stage.
+  MatrixXs Jx_stage_, Ju_stage_;
+
+  explicit IntegratorRK23DataTpl(const IntegratorRK23Tpl<Scalar> &integrator);
+
+  using Base::dx_;
+  using Base::Jtmp_xnext;
+  using Base::Ju;
+  using Base::Jx;
+  using Base::xnext_;
+};
+
+#ifdef ALIGATOR_ENABLE_TEMPLATE_INSTANTIATION
+extern template struct IntegratorRK23Tpl<context::Scalar>;
+extern template struct IntegratorRK23DataTpl<context::Scalar>;
+#endif
+} // namespace dynamics
+} // namespace aligator
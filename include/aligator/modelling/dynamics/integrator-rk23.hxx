@@ -0,0 +1,116 @@
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/modelling/dynamics/integrator-rk23.hpp"
+#include "aligator/core/shared-data-scope.hpp"
+
+namespace aligator {
+namespace dynamics {
+namespace detail {
+// nodes of the stages 2 and 3, weights of the stages, and weights of the
+// error estimate (including k_4 = f(x_{k+1}, u))
+inline constexpr double rk23_nodes[2] = {0.5, 0.75};
+inline constexpr double rk23_weights[3] = {2. / 9., 1. / 3., 4. / 9.};
+inline constexpr double rk23_error_weights[4] = {-5. / 72., 1. / 12., 1. / 9.,
+                                                 -1. / 8.};
+} // namespace detail
+
+template <typename Scalar>
+IntegratorRK23Tpl<Scalar>::IntegratorRK23Tpl(
+    const xyz::polymorphic<ODEType> &cont_dynamics, const Scalar timestep)
+    : Base(cont_dynamics)
+    , timestep_(timestep) {}
+
+template <typename Scalar>
+void IntegratorRK23Tpl<Scalar>::forward(const ConstVectorRef &x,
+                                        const ConstVectorRef &u,
+                                        BaseData &data) const {
+  Data &d = static_cast<Data &>(data);
+  using ODEData = ContinuousDynamicsDataTpl<Scalar>;
+  const auto &space = this->space_next();
+  const ODEData *prev = d.continuous_data.get();
+
+  this->ode_->forward(x, u, *d.continuous_data);
+  d.dx_ = (detail::rk23_weights[0] * timestep_) * prev->xdot_;
+  d.error_ = (detail::rk23_error_weights[0] * timestep_) * prev->xdot_;
+  for (std::size_t i = 0; i < 2; i++) {
+    ODEData &cd = *d.stage_datas_[i];
+    d.stage_dxs_[i] = (detail::rk23_nodes[i] * timestep_) * prev->xdot_;
+    space.integrate(x, d.stage_dxs_[i], d.stage_xs_[i]);
+    this->ode_->forward(d.stage_xs_[i], u, cd);
+    d.dx_ += (detail::rk23_weights[i + 1] * timestep_) * cd.xdot_;
+    d.error_ += (detail::rk23_error_weights[i + 1] * timestep_) * cd.xdot_;
+    prev = &cd;
+  }
+  space.integrate(x, d.dx_, d.xnext_);
+
+  ODEData &cd4 = *d.continuous_data_next;
+  this->ode_->forward(d.xnext_, u, cd4);
+  d.error_ += (detail::rk23_error_weights[3] * timestep_) * cd4.xdot_;
+}
+
+template <typename Scalar>
+void IntegratorRK23Tpl<Scalar>::dForward(const ConstVectorRef &x,
+                                         const ConstVectorRef &u,
+                                         BaseData &data) const {
+  Data &d = static_cast<Data &>(data);
+  using ODEData = ContinuousDynamicsDataTpl<Scalar>;
+  ODEData &cd1 = *d.continuous_data;
+
+  this->ode_->dForward(x, u, cd1);
+  for (std::size_t i = 0; i < 2; i++)
+    this->ode_->dForward(d.stage_xs_[i], u, *d.stage_datas_[i]);
+
+  // Jx, Ju accumulate the derivatives of dx = h sum_i b_i k_i
+  d.Kx_ = cd1.Jx();
+  d.Ku_ = cd1.Ju();
+  d.Jx() = (detail::rk23_weights[0] * timestep_) * d.Kx_;
+  d.Ju() = (detail::rk23_weights[0] * timestep_) * d.Ku_;
+  for (std::size_t i = 0; i < 2; i++) {
+    const ODEData &cd = *d.stage_datas_[i];
+    // x_i = x + dx_i, with dx_i = c_i h k_{i-1}
+    d.Jx_stage_ = (detail::rk23_nodes[i] * timestep_) * d.Kx_;
+    d.Ju_stage_ = (detail::rk23_nodes[i] * timestep_) * d.Ku_;
+    this->JintegrateStep(x, d.stage_dxs_[i], d.Jx_stage_, d.Ju_stage_,
+                         d.Jtmp_xnext);
+
+    // k_i = f(x_i, u)
+    d.Kx_.noalias() = cd.Jx() * d.Jx_stage_;
+    d.Ku_ = cd.Ju();
+    d.Ku_.noalias() += cd.Jx() * d.Ju_stage_;
+    d.Jx() += (detail::rk23_weights[i + 1] * timestep_) * d.Kx_;
+    d.Ju() += (detail::rk23_weights[i + 1] * timestep_) * d.Ku_;
+  }
+
+  // xnext = x + dx
+  this->JintegrateStep(x, d.dx_, d.Jx(), d.Ju(), d.Jtmp_xnext);
+}
+
+template <typename Scalar>
+IntegratorRK23DataTpl<Scalar>::IntegratorRK23DataTpl(
+    const IntegratorRK23Tpl<Scalar> &integrator)
+    : Base(integrator)
+    , error_(this->ndx1)
+    , Kx_(this->ndx1, this->ndx1)
+    , Ku_(this->ndx1, this->nu)
+    , Jx_stage_(this->ndx1, this->ndx1)
+    , Ju_stage_(this->ndx1, this->nu) {
+  // the stages 2, 3 and the error estimate are evaluated away from x: keep the
+  // objects their datas share (e.g. kinematics caches) apart from the ones of
+  // the stage at x
+  SharedDataScope scope;
+  continuous_data_next = integrator.ode_->createData();
+  for (std::size_t i = 0; i < 2; i++) {
+    stage_datas_[i] = integrator.ode_->createData();
+    stage_xs_[i] = integrator.space_next().neutral();
+    stage_dxs_[i].setZero(this->ndx1);
+  }
+  error_.setZero();
+  Kx_.setZero();
+  Ku_.setZero();
+  Jx_stage_.setZero();
+  Ju_stage_.setZero();
+}
+
+} // namespace dynamics
+} // namespace aligator
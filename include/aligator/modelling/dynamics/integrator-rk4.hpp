@@ -0,0 +1,80 @@
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/modelling/dynamics/integrator-explicit.hpp"
+
+#include <array>
+
+namespace aligator {
+namespace dynamics {
+template <typename Scalar> struct IntegratorRK4DataTpl;
+
+/** @brief  Classical fourth-order Runge-Kutta integrator.
+ *
+ * \f{eqnarray*}{
+ *    x_{k+1} = x_k \oplus \frac h6 (k_1 + 2k_2 + 2k_3 + k_4), \\
+ *    k_1 = f(x_k, u_k),\quad
+ *    k_2 = f(x_k \oplus \frac h2 k_1, u_k),\quad
+ *    k_3 = f(x_k \oplus \frac h2 k_2, u_k),\quad
+ *    k_4 = f(x_k \oplus h k_3, u_k).
+ * \f}
+ *
+ * The derivatives are propagated through the stages by the chain rule, reusing
+ * the ODE datas of the forward pass as in IntegratorRK2Tpl. The local error is
+ * \f$O(h^5)\f$, for four evaluations of the ODE (and of its derivatives).
+ */
+template <typename _Scalar>
+struct IntegratorRK4Tpl : ExplicitIntegratorAbstractTpl<_Scalar> {
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = ExplicitIntegratorAbstractTpl<Scalar>;
+  using BaseData = ExplicitDynamicsDataTpl<Scalar>;
+  using Data = IntegratorRK4DataTpl<Scalar>;
+  using ODEType = typename Base::ODEType;
+
+  Scalar timestep_;
+
+  IntegratorRK4Tpl(const xyz::polymorphic<ODEType> &cont_dynamics,
+                   const Scalar timestep);
+  void forward(const ConstVectorRef &x, const ConstVectorRef &u,
+               BaseData &data) const;
+  void dForward(const ConstVectorRef &x, const ConstVectorRef &u,
+                BaseData &data) const;
+
+  shared_ptr<BaseData> createData() const {
+    return std::make_shared<Data>(*this);
+  }
+};
+
+template <typename Scalar>
+struct IntegratorRK4DataTpl : ExplicitIntegratorDataTpl<Scalar> {
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = ExplicitIntegratorDataTpl<Scalar>;
+  using ODEData = ContinuousDynamicsDataTpl<Scalar>;
+  /// ODE datas of the stages 2 to 4 (the first one is `continuous_data`).
+  std::array<shared_ptr<ODEData>, 3> stage_datas_;
+  /// Points \f$x_k \oplus dx_i\f$ of the stages 2 to 4.
+  std::array<VectorXs, 3> stage_xs_;
+  /// Increments \f$dx_i\f$ of the stages 2 to 4.
+  std::array<VectorXs, 3> stage_dxs_;
+
+  /// Derivatives of the slope of the current stage.
+  MatrixXs Kx_, Ku_;
+  /// Derivatives of the point of the current stage.
+  MatrixXs Jx_stage_, Ju_stage_;
+
+  explicit IntegratorRK4DataTpl(const IntegratorRK4Tpl<Scalar> &integrator);
+
+  using Base::dx_;
+  using Base::Jtmp_xnext;
+  using Base::Ju;
+  using Base::Jx;
+  using Base::xnext_;
+};
+
+#ifdef ALIGATOR_ENABLE_TEMPLATE_INSTANTIATION
+extern template struct IntegratorRK4Tpl<context::Scalar>;
+extern template struct IntegratorRK4DataTpl<context::Scalar>;
+#endif
+} // namespace dynamics
+} // namespace aligator
@@ -0,0 +1,103 @@
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/modelling/dynamics/integrator-rk4.hpp"
+#include "aligator/core/shared-data-scope.hpp"
+
+namespace aligator {
+namespace dynamics {
+namespace detail {
+// nodes of the stages 2 to 4 and weights of the stages
+inline constexpr double rk4_nodes[3] = {0.5, 0.5, 1.};
+inline constexpr double rk4_weights[4] = {1. / 6., 1. / 3., 1. / 3., 1. / 6.};
+} // namespace detail
+
+template <typename Scalar>
+IntegratorRK4Tpl<Scalar>::IntegratorRK4Tpl(
+    const xyz::polymorphic<ODEType> &cont_dynamics, const Scalar timestep)
+    : Base(cont_dynamics)
+    , timestep_(timestep) {}
+
+template <typename Scalar>
+void IntegratorRK4Tpl<Scalar>::forward(const ConstVectorRef &x,
+                                       const ConstVectorRef &u,
+                                       BaseData &data) const {
+  Data &d = static_cast<Data &>(data);
+  using ODEData = ContinuousDynamicsDataTpl<Scalar>;
+  const auto &space = this->space_next();
+  const ODEData *prev = d.continuous_data.get();
+
+  this->ode_->forward(x, u, *d.continuous_data);
+  d.dx_ = (detail::rk4_weights[0] * timestep_) * prev->xdot_;
+  for (std::size_t i = 0; i < 3; i++) {
+    ODEData &cd = *d.stage_datas_[i];
+    d.stage_dxs_[i] = (detail::rk4_nodes[i] * timestep_) * prev->xdot_;
+    space.integrate(x, d.stage_dxs_[i], d.stage_xs_[i]);
+    this->ode_->forward(d.stage_xs_[i], u, cd);
+    d.dx_ += (detail::rk4_weights[i + 1] * timestep_) * cd.xdot_;
+    prev = &cd;
+  }
+  space.integrate(x, d.dx_, d.xnext_);
+}
+
+template <typename Scalar>
+void IntegratorRK4Tpl<Scalar>::dForward(const ConstVectorRef &x,
+                                        const ConstVectorRef &u,
+                                        BaseData &data) const {
+  Data &d = static_cast<Data &>(data);
+  using ODEData = ContinuousDynamicsDataTpl<Scalar>;
+  ODEData &cd1 = *d.continuous_data;
+
+  this->ode_->dForward(x, u, cd1);
+  for (std::size_t i = 0; i < 3; i++)
+    this->ode_->dForward(d.stage_xs_[i], u, *d.stage_datas_[i]);
+
+  // Jx, Ju accumulate the derivatives of dx = h sum_i b_i k_i
+  d.Kx_ = cd1.Jx();
+  d.Ku_ = cd1.Ju();
+  d.Jx() = (detail::rk4_weights[0] * timestep_) * d.Kx_;
+  d.Ju() = (detail::rk4_weights[0] * timestep_) * d.Ku_;
+  for (std::size_t i = 0; i < 3; i++) {
+    const ODEData &cd = *d.stage_datas_[i];
+    // x_i = x + dx_i, with dx_i = c_i h k_{i-1}
+    d.Jx_stage_ = (detail::rk4_nodes[i] * timestep_) * d.Kx_;
+    d.Ju_stage_ = (detail::rk4_nodes[i] * timestep_) * d.Ku_;
+    this->JintegrateStep(x, d.stage_dxs_[i], d.Jx_stage_, d.Ju_stage_,
+                         d.Jtmp_xnext);
+
+    // k_i = f(x_i, u)
+    d.Kx_.noalias() = cd.Jx() * d.Jx_stage_;
+    d.Ku_ = cd.Ju();
+    d.Ku_.noalias() += cd.Jx() * d.Ju_stage_;
+    d.Jx() += (detail::rk4_weights[i + 1] * timestep_) * d.Kx_;
+    d.Ju() += (detail::rk4_weights[i + 1] * timestep_) * d.Ku_;
+  }
+
+  // xnext = x + dx
+  this->JintegrateStep(x, d.dx_, d.Jx(), d.Ju(), d.Jtmp_xnext);
+}
+
+template <typename Scalar>
+IntegratorRK4DataTpl<Scalar>::IntegratorRK4DataTpl(
+    const IntegratorRK4Tpl<Scalar> &integrator)
+    : Base(integrator)
+    , Kx_(this->ndx1, this->ndx1)
+    , Ku_(this->ndx1, this->nu)
+    , Jx_stage_(this->ndx1, this->ndx1)
+    , Ju_stage_(this->ndx1, this->nu) {
+  // the stages 2 to 4 are evaluated away from x: keep the objects their datas
+  // share (e.g. kinematics caches) apart from the ones of the stage at x
+  SharedDataScope scope;
+  for (std::size_t i = 0; i < 3; i++) {
+    stage_datas_[i] = integrator.ode_->createData();
+    stage_xs_[i] = integrator.space_next().neutral();
+    stage_dxs_[i].setZero(this->ndx1);
+  }
+  Kx_.setZero();
+  Ku_.setZero();
+  Jx_stage_.setZero();
+  Ju_stage_.setZero();
+}
+
+} // namespace dynamics
+} // namespace aligator
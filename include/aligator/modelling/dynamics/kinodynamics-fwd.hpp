@@ -5,8 +5,9 @@
 
 #ifdef ALIGATOR_WITH_PINOCCHIO
 
-#include <Eigen/LU>
+#include <Eigen/Cholesky>
 #include "aligator/modelling/spaces/multibody.hpp"
+#include "aligator/modelling/multibody/kinematics-cache.hpp"
 #include <pinocchio/multibody/model.hpp>
 #include <pinocchio/multibody/data.hpp>
 
@@ -27,6 +28,20 @@ template <typename Scalar> struct KinodynamicsFwdDataTpl;
  * f_i + mg \\ \sum_i=1^{n_k} (p_i - c) \times f_i \end{bmatrix} \f$ ) and
  * \f$a_j\f$ commanded joints acceleration.
  *
+ * The base acceleration solves a system with the base block
+ * \f$A_b = \begin{bmatrix} mR & A_{12} \\ 0 & I_c R \end{bmatrix}\f$ of
+ * \f$A_g\f$, where \f$R\f$ is the orientation of the free-flyer base and
+ * \f$I_c\f$ the centroidal rotational inertia. It is solved by blocks, with
+ * a 3x3 Cholesky factorization of \f$I_c\f$.
+ *
+ * The joint placements, placements of the active contact frames, center of
+ * mass, centroidal momentum matrix and its derivatives computed along the way
+ * are published to the stage's KinematicsCacheTpl.
+ *
+ * @pre The root joint of the model is a free-flyer (the base is the first six
+ * tangent coordinates, and its block of \f$A_g\f$ has the form above). The
+ * constructor throws otherwise; models with another root joint (planar,
+ * spherical...) are not supported by this formulation.
  */
 template <typename _Scalar>
 struct KinodynamicsFwdDynamicsTpl : ODEAbstractTpl<_Scalar> {
@@ -44,7 +59,9 @@ struct KinodynamicsFwdDynamicsTpl : ODEAbstractTpl<_Scalar> {
   using Base::nu_;
 
   Manifold space_;
-  Model pin_model_;
+  /// Model of the robot, shared with @ref space_ when the constructor is given
+  /// the model of the state space.
+  shared_ptr<const Model> pin_model_handle_;
   double mass_;
   Vector3s gravity_;
   int force_size_;
@@ -60,6 +77,8 @@ struct KinodynamicsFwdDynamicsTpl : ODEAbstractTpl<_Scalar> {
       const std::vector<pinocchio::FrameIndex> &contact_ids,
       const int force_size);
 
+  const Model &getModel() const { return *pin_model_handle_; }
+
   void forward(const ConstVectorRef &x, const ConstVectorRef &u,
                BaseData &data) const;
   void dForward(const ConstVectorRef &x, const ConstVectorRef &u,
@@ -76,26 +95,40 @@ struct KinodynamicsFwdDataTpl : ContinuousDynamicsDataTpl<Scalar> {
   using Matrix6Xs = typename math_types<Scalar>::Matrix6Xs;
   using Matrix3Xs = typename math_types<Scalar>::Matrix3Xs;
   using Matrix3s = Eigen::Matrix<Scalar, 3, 3>;
-  using Matrix6s = Eigen::Matrix<Scalar, 6, 6>;
   using Vector6s = Eigen::Matrix<Scalar, 6, 1>;
 
   PinData pin_data_;
+  /// Kinematics cache of the stage, which the dynamics publish to.
+  shared_ptr<KinematicsCacheTpl<Scalar>> kinematics_;
   Matrix6Xs dh_dq_;
   Matrix6Xs dhdot_dq_;
   Matrix6Xs dhdot_dv_;
   Matrix6Xs dhdot_da_;
-  Matrix6Xs temp1_;
   Matrix3Xs temp2_;
   Matrix6Xs fJf_;
-  VectorXs v0_;
-  VectorXs a0_;
 
   Vector6s cforces_;
   Matrix3s Jtemp_;
-  Matrix6s Agu_inv_;
-  Eigen::PartialPivLU<Eigen::Matrix<Scalar, 6, 6>> PivLU_;
+  /// Transpose \f$R^T\f$ of the base orientation.
+  Matrix3s Rt_;
+  Scalar inv_mass_;
+  /// Upper-right block \f$A_{12}\f$ of the base block of \f$A_g\f$.
+  Matrix3s A12_;
+  /// Factorization of the centroidal rotational inertia \f$I_c\f$.
+  Eigen::LLT<Matrix3s> Ic_llt_;
+  /// Workspace of solveBaseBlock().
+  Matrix3Xs solve_tmp_;
 
   KinodynamicsFwdDataTpl(const KinodynamicsFwdDynamicsTpl<Scalar> *model);
+
+  /// @brief Factorize the base block of the centroidal momentum matrix @p Ag,
+  /// for a robot of mass @p mass.
+  void factorizeBaseBlock(const Matrix6Xs &Ag, const Scalar mass);
+
+  /// @brief Overwrite @p rhs with \f$A_b^{-1}\f$ rhs, using the factors of
+  /// factorizeBaseBlock().
+  template <typename MatrixType>
+  void solveBaseBlock(const Eigen::MatrixBase<MatrixType> &rhs);
 };
 
 #ifdef ALIGATOR_ENABLE_TEMPLATE_INSTANTIATION
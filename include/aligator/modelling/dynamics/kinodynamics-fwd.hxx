@@ -22,12 +22,19 @@ KinodynamicsFwdDynamicsTpl<Scalar>::KinodynamicsFwdDynamicsTpl(
     const std::vector<pinocchio::FrameIndex> &contact_ids, const int force_size)
     : Base(state, model.nv - 6 + int(contact_states.size()) * force_size)
     , space_(state)
-    , pin_model_(model)
+    , pin_model_handle_(&model == &state.getModel()
+                            ? state.getModelHandle()
+                            : std::make_shared<const Model>(model))
     , gravity_(gravity)
     , force_size_(force_size)
     , contact_states_(contact_states)
     , contact_ids_(contact_ids) {
-  mass_ = pinocchio::computeTotalMass(pin_model_);
+  mass_ = pinocchio::computeTotalMass(getModel());
+  if (getModel().njoints < 2 ||
+      getModel().joints[1].shortname() != "JointModelFreeFlyer") {
+    ALIGATOR_DOMAIN_ERROR(
+        "The root joint of the model should be a free-flyer.");
+  }
   if (contact_ids_.size() != contact_states_.size()) {
     ALIGATOR_DOMAIN_ERROR(
         "contact_ids and contact_states should have same size: "
@@ -42,18 +49,23 @@ void KinodynamicsFwdDynamicsTpl<Scalar>::forward(const ConstVectorRef &x,
                                                  BaseData &data) const {
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
-  const ConstVectorRef q = x.head(pin_model_.nq);
-  const ConstVectorRef v = x.tail(pin_model_.nv);
-  const ConstVectorRef a = u.tail(pin_model_.nv - 6);
+  const ConstVectorRef q = x.head(getModel().nq);
+  const ConstVectorRef v = x.tail(getModel().nv);
+  const ConstVectorRef a = u.tail(getModel().nv - 6);
 
-  pinocchio::ccrba(pin_model_, pdata, q, v);  // Compute Ag
-  pinocchio::dccrba(pin_model_, pdata, q, v); // Compute Ag_dot
+  // Computes Ag_dot, and the joint placements and Ag along the way. Only
+  // these are relied upon: the center of mass and the centroidal momentum are
+  // formed below, and the local joint velocities are not published.
+  pinocchio::dccrba(getModel(), pdata, q, v);
+  // from the placements of dccrba, without running the kinematics again
+  pinocchio::centerOfMass(getModel(), pdata, pinocchio::POSITION);
+  pdata.hg.toVector().noalias() = pdata.Ag * v;
+  using KinematicsCache = KinematicsCacheTpl<Scalar>;
+  d.kinematics_->publish(pdata, q, v,
+                         KinematicsCache::PLACEMENTS | KinematicsCache::COM |
+                             KinematicsCache::CENTROIDAL_MAP);
 
-  pinocchio::forwardKinematics(pin_model_, pdata, q);
-  pinocchio::centerOfMass(pin_model_, pdata, q, v);
-
-  d.PivLU_.compute(pdata.Ag.leftCols(6));
-  d.Agu_inv_ = d.PivLU_.inverse();
+  d.factorizeBaseBlock(pdata.Ag, mass_);
 
   // Compute external forces component
   d.cforces_.setZero();
@@ -61,7 +73,8 @@ void KinodynamicsFwdDynamicsTpl<Scalar>::forward(const ConstVectorRef &x,
   for (std::size_t i = 0; i < contact_states_.size(); i++) {
     if (contact_states_[i]) {
       long i_ = static_cast<long>(i);
-      pinocchio::updateFramePlacement(pin_model_, pdata, contact_ids_[i]);
+      pinocchio::updateFramePlacement(getModel(), pdata, contact_ids_[i]);
+      d.kinematics_->publishFramePlacement(pdata, q, contact_ids_[i]);
       d.cforces_.template head<3>() += u.template segment<3>(i_ * force_size_);
       d.cforces_[3] +=
           (pdata.oMf[contact_ids_[i]].translation()[1] - pdata.com[0][1]) *
@@ -87,13 +100,15 @@ void KinodynamicsFwdDynamicsTpl<Scalar>::forward(const ConstVectorRef &x,
 
   // Compute base acceleration with respect to whole-body motion and centroidal
   // dynamics
-  d.xdot_.segment(pin_model_.nv, 6) =
-      d.Agu_inv_ *
-      (d.cforces_ - pdata.dAg * v - pdata.Ag.rightCols(pin_model_.nv - 6) * a);
+  auto a_base = d.xdot_.segment(getModel().nv, 6);
+  a_base = d.cforces_;
+  a_base.noalias() -= pdata.dAg * v;
+  a_base.noalias() -= pdata.Ag.rightCols(getModel().nv - 6) * a;
+  d.solveBaseBlock(a_base);
 
   // Simple kinematics integration
-  d.xdot_.head(pin_model_.nv) = v;
-  d.xdot_.tail(pin_model_.nv - 6) = a;
+  d.xdot_.head(getModel().nv) = v;
+  d.xdot_.tail(getModel().nv - 6) = a;
 }
 
 template <typename Scalar>
@@ -102,71 +117,50 @@ void KinodynamicsFwdDynamicsTpl<Scalar>::dForward(const ConstVectorRef &x,
                                                   BaseData &data) const {
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
-  const ConstVectorRef q = x.head(pin_model_.nq);
-  const ConstVectorRef v = x.tail(pin_model_.nv);
-  const ConstVectorRef a = u.tail(pin_model_.nv - 6);
-
-  pinocchio::centerOfMass(pin_model_, pdata, q, v);
-  pinocchio::jacobianCenterOfMass(pin_model_, pdata, q);
+  const long nv = getModel().nv;
+  const ConstVectorRef q = x.head(getModel().nq);
+  const ConstVectorRef v = x.tail(nv);
 
-  pinocchio::computeJointJacobians(pin_model_, pdata);
+  // The centroidal momentum rate is linear in the acceleration, so that its
+  // derivatives at the full acceleration (a_u, a) from the forward pass hold
+  // the terms in Ag_dot * v, Ag_j * a and Ag_u * a_u at once. This also
+  // computes the joint Jacobians, at the placements of the forward pass.
+  pinocchio::computeCentroidalDynamicsDerivatives(
+      getModel(), pdata, q, v, d.xdot_.tail(nv), d.dh_dq_, d.dhdot_dq_,
+      d.dhdot_dv_, d.dhdot_da_);
+  // the linear rows of Ag are m * Jcom
+  pdata.Jcom = pdata.Ag.template topRows<3>() / mass_;
+  using KinematicsCache = KinematicsCacheTpl<Scalar>;
+  d.kinematics_->publish(pdata, q, v,
+                         KinematicsCache::JOINT_JACOBIANS |
+                             KinematicsCache::COM_JACOBIAN);
+  d.kinematics_->publishCentroidalMomentumDerivatives(d.dh_dq_, q, v);
 
   ////// Jx computation //////
-  d.Jtemp_.setZero();
-  d.Jx_.block(pin_model_.nv, 0, 6, pin_model_.nv).setZero();
+  // Right-hand side of the base acceleration derivatives, solved at the end
+  auto Jx_base = d.Jx_.block(nv, 0, 6, 2 * nv);
+  Jx_base.leftCols(nv) = -d.dhdot_dq_;
+  Jx_base.rightCols(nv) = -d.dhdot_dv_;
   // Compute kinematics terms in centroidal dynamics
   for (std::size_t i = 0; i < contact_states_.size(); i++) {
     long i_ = static_cast<long>(i);
     if (contact_states_[i]) {
       d.fJf_.setZero();
-      pinocchio::getFrameJacobian(pin_model_, pdata, contact_ids_[i],
+      pinocchio::getFrameJacobian(getModel(), pdata, contact_ids_[i],
                                   pinocchio::LOCAL_WORLD_ALIGNED, d.fJf_);
       d.Jtemp_ << 0, -u[i_ * force_size_ + 2], u[i_ * force_size_ + 1],
           u[i_ * force_size_ + 2], 0, -u[i_ * force_size_],
           -u[i_ * force_size_ + 1], u[i_ * force_size_], 0;
-      d.temp1_.noalias() = d.Agu_inv_.template rightCols<3>() * d.Jtemp_;
       d.temp2_.noalias() = pdata.Jcom - d.fJf_.template topRows<3>();
-      d.Jx_.block(pin_model_.nv, 0, 6, pin_model_.nv).noalias() +=
-          d.temp1_ * d.temp2_;
+      Jx_base.block(3, 0, 3, nv).noalias() += d.Jtemp_ * d.temp2_;
     }
   }
-  // Compute d(Ag * q_ddot)/ dq
-  d.a0_.template head<6>().setZero();
-  d.a0_.tail(pin_model_.nv - 6) = a;
-  pinocchio::computeCentroidalDynamicsDerivatives(pin_model_, pdata, q, d.v0_,
-                                                  d.a0_, d.dh_dq_, d.dhdot_dq_,
-                                                  d.dhdot_dv_, d.dhdot_da_);
-  d.Jx_.block(pin_model_.nv, 0, 6, pin_model_.nv).noalias() -=
-      d.Agu_inv_ * d.dhdot_dq_;
-
-  // Compute d(Ag_dot * q_dot)/ dq
-  d.a0_.setZero();
-  pinocchio::computeCentroidalDynamicsDerivatives(pin_model_, pdata, q, v,
-                                                  d.a0_, d.dh_dq_, d.dhdot_dq_,
-                                                  d.dhdot_dv_, d.dhdot_da_);
-
-  d.Jx_.block(pin_model_.nv, 0, 6, pin_model_.nv).noalias() -=
-      d.Agu_inv_ * d.dhdot_dq_;
-
-  // Compute d(Ag_dot * q_dot)/ dq_dot
-  d.Jx_.block(pin_model_.nv, pin_model_.nv, 6, pin_model_.nv).noalias() =
-      -d.Agu_inv_ * d.dhdot_dv_;
-
-  // Compute dAgu_inv / dq
-  d.a0_.setZero();
-  d.a0_.template head<6>() = d.xdot_.segment(pin_model_.nv, 6);
-
-  pinocchio::computeCentroidalDynamicsDerivatives(
-      pin_model_, pdata, q, VectorXs::Zero(pin_model_.nv), d.a0_, d.dh_dq_,
-      d.dhdot_dq_, d.dhdot_dv_, d.dhdot_da_);
-
-  d.Jx_.block(pin_model_.nv, 0, 6, pin_model_.nv).noalias() -=
-      d.Agu_inv_ * d.dhdot_dq_;
+  d.solveBaseBlock(Jx_base);
 
   ////// Ju computation //////
-
+  auto Ju_base = d.Ju_.block(nv, 0, 6, nu_);
   // Compute derivatives with respect to forces
-  d.Ju_.block(pin_model_.nv, 0, 6, nu_).setZero();
+  Ju_base.setZero();
   for (std::size_t i = 0; i < contact_states_.size(); i++) {
     long i_ = static_cast<long>(i);
     if (contact_states_[i]) {
@@ -178,22 +172,17 @@ void KinodynamicsFwdDynamicsTpl<Scalar>::dForward(const ConstVectorRef &x,
           -(pdata.oMf[contact_ids_[i]].translation()[1] - pdata.com[0][1]),
           (pdata.oMf[contact_ids_[i]].translation()[0] - pdata.com[0][0]), 0.0;
 
-      d.Ju_.block(pin_model_.nv, force_size_ * i_, 6, 3).noalias() =
-          d.Agu_inv_.template leftCols<3>();
-      d.Ju_.block(pin_model_.nv, force_size_ * i_, 6, 3).noalias() +=
-          d.Agu_inv_.template rightCols<3>() * d.Jtemp_;
+      Ju_base.block(0, force_size_ * i_, 3, 3).setIdentity();
+      Ju_base.block(3, force_size_ * i_, 3, 3) = d.Jtemp_;
       if (force_size_ == 6) {
-        d.Ju_.block(pin_model_.nv, force_size_ * i_ + 3, 6, 3).noalias() +=
-            d.Agu_inv_.template rightCols<3>();
+        Ju_base.block(3, force_size_ * i_ + 3, 3, 3).setIdentity();
       }
     }
   }
 
   // Compute derivatives with respect to joint acceleration
-  d.Ju_
-      .block(pin_model_.nv, (long)contact_states_.size() * force_size_, 6,
-             pin_model_.nv - 6)
-      .noalias() = -d.Agu_inv_ * pdata.Ag.rightCols(pin_model_.nv - 6);
+  Ju_base.rightCols(nv - 6) = -pdata.Ag.rightCols(nv - 6);
+  d.solveBaseBlock(Ju_base);
 }
 
 template <typename Scalar>
@@ -206,35 +195,63 @@ template <typename Scalar>
 KinodynamicsFwdDataTpl<Scalar>::KinodynamicsFwdDataTpl(
     const KinodynamicsFwdDynamicsTpl<Scalar> *model)
     : Base(model->ndx(), model->nu())
-    , pin_data_(model->pin_model_)
-    , dh_dq_(6, model->pin_model_.nv)
-    , dhdot_dq_(6, model->pin_model_.nv)
-    , dhdot_dv_(6, model->pin_model_.nv)
-    , dhdot_da_(6, model->pin_model_.nv)
-    , temp1_(6, 3)
-    , temp2_(3, model->pin_model_.nv)
-    , fJf_(6, model->pin_model_.nv)
-    , v0_(model->pin_model_.nv)
-    , a0_(model->pin_model_.nv)
-    , PivLU_(6) {
-  this->Jx_.topRightCorner(model->pin_model_.nv, model->pin_model_.nv)
+    , pin_data_(model->getModel())
+    , kinematics_(KinematicsCacheTpl<Scalar>::get(model->getModel()))
+    , dh_dq_(6, model->getModel().nv)
+    , dhdot_dq_(6, model->getModel().nv)
+    , dhdot_dv_(6, model->getModel().nv)
+    , dhdot_da_(6, model->getModel().nv)
+    , temp2_(3, model->getModel().nv)
+    , fJf_(6, model->getModel().nv)
+    , solve_tmp_(3, std::max(2 * model->getModel().nv, model->nu())) {
+  this->Jx_.topRightCorner(model->getModel().nv, model->getModel().nv)
       .setIdentity();
   this->Ju_
-      .bottomRightCorner(model->pin_model_.nv - 6, model->pin_model_.nv - 6)
+      .bottomRightCorner(model->getModel().nv - 6, model->getModel().nv - 6)
       .setIdentity();
 
   dh_dq_.setZero();
   dhdot_dq_.setZero();
   dhdot_dv_.setZero();
   dhdot_da_.setZero();
-  temp1_.setZero();
   temp2_.setZero();
   fJf_.setZero();
-  v0_.setZero();
-  a0_.setZero();
   cforces_.setZero();
   Jtemp_.setZero();
-  Agu_inv_.setZero();
+  Rt_.setIdentity();
+  inv_mass_ = 1.;
+  A12_.setZero();
+  solve_tmp_.setZero();
+}
+
+template <typename Scalar>
+void KinodynamicsFwdDataTpl<Scalar>::factorizeBaseBlock(const Matrix6Xs &Ag,
+                                                        const Scalar mass) {
+  // Ag_b = [m R, A12; 0, I_c R] for a free-flyer base with velocity in the
+  // base frame, as the centroidal frame is at the center of mass
+  inv_mass_ = Scalar(1) / mass;
+  Rt_ = inv_mass_ * Ag.template topLeftCorner<3, 3>().transpose();
+  A12_ = Ag.template block<3, 3>(0, 3);
+  Ic_llt_.compute(Ag.template block<3, 3>(3, 3) * Rt_);
+}
+
+template <typename Scalar>
+template <typename MatrixType>
+void KinodynamicsFwdDataTpl<Scalar>::solveBaseBlock(
+    const Eigen::MatrixBase<MatrixType> &rhs_) {
+  MatrixType &rhs = rhs_.const_cast_derived();
+  const long k = rhs.cols();
+  auto lin = rhs.template topRows<3>();
+  auto ang = rhs.template bottomRows<3>();
+  auto tmp = solve_tmp_.leftCols(k);
+  // ang <- (I_c R)^{-1} ang = R^T I_c^{-1} ang
+  Ic_llt_.solveInPlace(ang);
+  tmp.noalias() = Rt_ * ang;
+  ang = tmp;
+  // lin <- (m R)^{-1} (lin - A12 ang)
+  lin.noalias() -= A12_ * ang;
+  tmp.noalias() = inv_mass_ * Rt_ * lin;
+  lin = tmp;
 }
 } // namespace dynamics
 } // namespace aligator
@@ -4,6 +4,7 @@
 #include "aligator/modelling/dynamics/ode-abstract.hpp"
 
 #include "aligator/modelling/spaces/multibody.hpp"
+#include "aligator/modelling/multibody/kinematics-cache.hpp"
 #include <pinocchio/multibody/data.hpp>
 
 #include <pinocchio/algorithm/proximal.hpp>
@@ -14,6 +15,9 @@ namespace dynamics {
 template <typename Scalar> struct MultibodyConstraintFwdDataTpl;
 
 /// @brief   Constraint multibody forward dynamics, using Pinocchio.
+///
+/// @details The joint placements and Jacobians computed by the constraint
+/// dynamics are published to the stage's KinematicsCacheTpl.
 template <typename _Scalar>
 struct MultibodyConstraintFwdDynamicsTpl : ODEAbstractTpl<_Scalar> {
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -79,6 +83,8 @@ struct MultibodyConstraintFwdDataTpl : ContinuousDynamicsDataTpl<Scalar> {
   RigidConstraintDataVector constraint_datas_;
   pinocchio::ProximalSettings settings;
   PinDataType pin_data_;
+  /// Kinematics cache of the stage, which the dynamics publish to.
+  shared_ptr<KinematicsCacheTpl<Scalar>> kinematics_;
   explicit MultibodyConstraintFwdDataTpl(
       const MultibodyConstraintFwdDynamicsTpl<Scalar> &cont_dyn);
 };
@@ -46,6 +46,10 @@ void MultibodyConstraintFwdDynamicsTpl<Scalar>::forward(const ConstVectorRef &x,
       model, d.pin_data_, q, v, tau, constraint_models_, d.constraint_datas_,
       d.settings);
 #pragma GCC diagnostic pop
+  using KinematicsCache = KinematicsCacheTpl<Scalar>;
+  d.kinematics_->publish(d.pin_data_, q, v,
+                         KinematicsCache::PLACEMENTS |
+                             KinematicsCache::JOINT_JACOBIANS);
 }
 
 template <typename Scalar>
@@ -79,7 +83,8 @@ MultibodyConstraintFwdDataTpl<Scalar>::MultibodyConstraintFwdDataTpl(
     , dtau_dx_(cont_dyn.ntau(), cont_dyn.ndx())
     , dtau_du_(cont_dyn.actuation_matrix_)
     , settings(cont_dyn.prox_settings_)
-    , pin_data_(cont_dyn.pinModel()) {
+    , pin_data_(cont_dyn.pinModel())
+    , kinematics_(KinematicsCacheTpl<Scalar>::get(cont_dyn.pinModel())) {
   tau_.setZero();
 
   const pinocchio::ModelTpl<Scalar> &model = cont_dyn.pinModel();
@@ -5,6 +5,7 @@
 
 #ifdef ALIGATOR_WITH_PINOCCHIO
 #include "aligator/modelling/spaces/multibody.hpp"
+#include "aligator/modelling/multibody/kinematics-cache.hpp"
 #include <pinocchio/multibody/data.hpp>
 
 namespace aligator {
@@ -19,6 +20,9 @@ template <typename Scalar> struct MultibodyFreeFwdDataTpl;
 /// where
 /// \f$\tau(u) = Bu\f$, \f$B\f$ is a given actuation matrix, and
 /// \f$a(q,v,\tau)\f$ is the acceleration computed from the ABA algorithm.
+///
+/// The joint placements, velocities and Jacobians computed by the ABA
+/// derivatives are published to the stage's KinematicsCacheTpl.
 template <typename _Scalar>
 struct MultibodyFreeFwdDynamicsTpl : ODEAbstractTpl<_Scalar> {
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -76,6 +80,8 @@ struct MultibodyFreeFwdDataTpl : ContinuousDynamicsDataTpl<Scalar> {
   MatrixXs dtau_dx_;
   MatrixXs dtau_du_;
   PinDataType pin_data_;
+  /// Kinematics cache of the stage, which the dynamics publish to.
+  shared_ptr<KinematicsCacheTpl<Scalar>> kinematics_;
   MultibodyFreeFwdDataTpl(const MultibodyFreeFwdDynamicsTpl<Scalar> *cont_dyn);
 };
 
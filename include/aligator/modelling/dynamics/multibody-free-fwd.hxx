@@ -67,6 +67,11 @@ void MultibodyFreeFwdDynamicsTpl<Scalar>::dForward(const ConstVectorRef &x,
                                    pinocchio::make_ref(da_dx.leftCols(nv)),
                                    pinocchio::make_ref(da_dx.rightCols(nv)),
                                    pinocchio::make_ref(d.pin_data_.Minv));
+  using KinematicsCache = KinematicsCacheTpl<Scalar>;
+  d.kinematics_->publish(d.pin_data_, q, v,
+                         KinematicsCache::PLACEMENTS |
+                             KinematicsCache::VELOCITIES |
+                             KinematicsCache::JOINT_JACOBIANS);
   d.Ju_.bottomRows(nv) = d.pin_data_.Minv * d.dtau_du_;
 }
 
@@ -83,7 +88,9 @@ MultibodyFreeFwdDataTpl<Scalar>::MultibodyFreeFwdDataTpl(
     , tau_(cont_dyn->space_.getModel().nv)
     , dtau_dx_(cont_dyn->ntau(), cont_dyn->ndx())
     , dtau_du_(cont_dyn->actuation_matrix_)
-    , pin_data_() {
+    , pin_data_()
+    , kinematics_(
+          KinematicsCacheTpl<Scalar>::get(cont_dyn->space_.getModel())) {
   tau_.setZero();
   const pinocchio::ModelTpl<Scalar> &model = cont_dyn->space_.getModel();
   pin_data_ = PinDataType(model);
@@ -33,7 +33,9 @@ struct FunctionSliceXprTpl<Scalar, StageFunctionTpl<Scalar>>
   FunctionSliceXprTpl(xyz::polymorphic<Base> func,
                       std::vector<int> const &indices)
       : Base(func->ndx1, func->nu, (int)indices.size())
-      , SliceImpl(func, indices) {}
+      , SliceImpl(func, indices) {
+    this->jac_pattern = func->jac_pattern;
+  }
 
   FunctionSliceXprTpl(xyz::polymorphic<Base> func, const int idx)
       : FunctionSliceXprTpl(func, std::vector<int>{idx}) {}
@@ -59,6 +61,10 @@ struct FunctionSliceXprTpl<Scalar, StageFunctionTpl<Scalar>>
   shared_ptr<BaseData> createData() const override {
     return std::make_shared<Data>(*this);
   }
+
+  bool hasConstantJacobians() const override {
+    return this->func->hasConstantJacobians();
+  }
 };
 
 template <typename Scalar>
@@ -74,7 +80,9 @@ struct FunctionSliceXprTpl<Scalar, UnaryFunctionTpl<Scalar>>
   FunctionSliceXprTpl(xyz::polymorphic<Base> func,
                       std::vector<int> const &indices)
       : Base(func->ndx1, func->nu, (int)indices.size())
-      , SliceImpl(func, indices) {}
+      , SliceImpl(func, indices) {
+    this->jac_pattern = func->jac_pattern;
+  }
 
   FunctionSliceXprTpl(xyz::polymorphic<Base> func, const int idx)
       : FunctionSliceXprTpl(func, std::vector<int>{idx}) {}
@@ -98,6 +106,10 @@ struct FunctionSliceXprTpl<Scalar, UnaryFunctionTpl<Scalar>>
   shared_ptr<BaseData> createData() const override {
     return std::make_shared<Data>(*this);
   }
+
+  bool hasConstantJacobians() const override {
+    return this->func->hasConstantJacobians();
+  }
 };
 
 template <typename Scalar>
@@ -43,6 +43,8 @@ struct LinearDiscreteDynamicsTpl : ExplicitDynamicsModelTpl<_Scalar> {
     data->Ju() = B_;
     return data;
   }
+
+  bool hasConstantJacobians() const { return true; }
 };
 
 } // namespace dynamics
@@ -40,6 +40,7 @@ template <typename _FunType> struct linear_func_composition_impl : _FunType {
     if (A.cols() != func->nr) {
       ALIGATOR_RUNTIME_ERROR("Incompatible dimensions: A.cols() != func.nr");
     }
+    this->jac_pattern = func->jac_pattern;
   }
 
   linear_func_composition_impl(xyz::polymorphic<FunType> func,
@@ -49,6 +50,8 @@ template <typename _FunType> struct linear_func_composition_impl : _FunType {
   shared_ptr<BaseData> createData() const {
     return std::make_shared<Data>(*this);
   }
+
+  bool hasConstantJacobians() const { return func->hasConstantJacobians(); }
 };
 } // namespace detail
 
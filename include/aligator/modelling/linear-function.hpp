@@ -47,6 +47,8 @@ template <typename Scalar> struct LinearFunctionTpl : StageFunctionTpl<Scalar> {
     data->Ju_ = B_;
     return data;
   }
+
+  bool hasConstantJacobians() const override { return true; }
 };
 
 template <typename Scalar>
@@ -2,6 +2,7 @@
 
 #include "aligator/core/unary-function.hpp"
 #include "./fwd.hpp"
+#include "./kinematics-cache.hpp"
 
 #include <pinocchio/multibody/model.hpp>
 
@@ -29,15 +30,30 @@ public:
   using Model = pinocchio::ModelTpl<Scalar>;
   using SE3 = pinocchio::SE3Tpl<Scalar>;
   using Data = CenterOfMassTranslationDataTpl<Scalar>;
+  using ModelHandle = shared_ptr<const Model>;
 
-  Model pin_model_;
+  /// Model of the robot whose center of mass is tracked, shared by the copies
+  /// of the residual.
+  ModelHandle pin_model_handle_;
 
   CenterOfMassTranslationResidualTpl(const int ndx, const int nu,
                                      const Model &model,
                                      const Vector3s &frame_trans)
+      : CenterOfMassTranslationResidualTpl(
+            ndx, nu, std::make_shared<const Model>(model), frame_trans) {}
+
+  /// Constructor sharing the model @p model with other functions.
+  CenterOfMassTranslationResidualTpl(const int ndx, const int nu,
+                                     ModelHandle model,
+                                     const Vector3s &frame_trans)
       : Base(ndx, nu, 3)
-      , pin_model_(model)
-      , p_ref_(frame_trans) {}
+      , pin_model_handle_(std::move(model))
+      , p_ref_(frame_trans) {
+    // depends on the configuration only
+    this->jac_pattern.x_size = getModel().nv;
+  }
+
+  const Model &getModel() const { return *pin_model_handle_; }
 
   const Vector3s &getReference() const { return p_ref_; }
   void setReference(const Eigen::Ref<const Vector3s> &p_new) { p_ref_ = p_new; }
@@ -60,8 +76,10 @@ struct CenterOfMassTranslationDataTpl : StageFunctionDataTpl<Scalar> {
   using Base = StageFunctionDataTpl<Scalar>;
   using PinData = pinocchio::DataTpl<Scalar>;
 
+  /// Kinematics cache, shared with the other multibody functions of the stage.
+  shared_ptr<KinematicsCacheTpl<Scalar>> kinematics_;
   /// Pinocchio data object.
-  PinData pin_data_;
+  PinData &pin_data_;
 
   CenterOfMassTranslationDataTpl(
       const CenterOfMassTranslationResidualTpl<Scalar> *model);
@@ -1,7 +1,6 @@
 #pragma once
 
 #include "aligator/modelling/multibody/center-of-mass-translation.hpp"
-#include <pinocchio/algorithm/center-of-mass.hpp>
 
 namespace aligator {
 
@@ -10,7 +9,7 @@ void CenterOfMassTranslationResidualTpl<Scalar>::evaluate(
     const ConstVectorRef &x, BaseData &data) const {
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
-  pinocchio::centerOfMass(pin_model_, pdata, x.head(pin_model_.nq));
+  d.kinematics_->centerOfMass(getModel(), x.head(getModel().nq));
 
   d.value_ = pdata.com[0] - p_ref_;
 }
@@ -20,15 +19,16 @@ void CenterOfMassTranslationResidualTpl<Scalar>::computeJacobians(
     const ConstVectorRef &x, BaseData &data) const {
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
-  pinocchio::jacobianCenterOfMass(pin_model_, pdata, x.head(pin_model_.nq));
+  d.kinematics_->jacobianCenterOfMass(getModel(), x.head(getModel().nq));
 
-  d.Jx_.leftCols(pin_model_.nv) = pdata.Jcom;
+  d.Jx_.leftCols(getModel().nv) = pdata.Jcom;
 }
 
 template <typename Scalar>
 CenterOfMassTranslationDataTpl<Scalar>::CenterOfMassTranslationDataTpl(
     const CenterOfMassTranslationResidualTpl<Scalar> *model)
     : Base(model->ndx1, model->nu, 3)
-    , pin_data_(model->pin_model_) {}
+    , kinematics_(KinematicsCacheTpl<Scalar>::get(model->getModel()))
+    , pin_data_(kinematics_->data) {}
 
 } // namespace aligator
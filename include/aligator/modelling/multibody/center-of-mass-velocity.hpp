@@ -19,16 +19,27 @@ public:
   using Model = pinocchio::ModelTpl<Scalar>;
   using SE3 = pinocchio::SE3Tpl<Scalar>;
   using Data = CenterOfMassVelocityDataTpl<Scalar>;
+  using ModelHandle = shared_ptr<const Model>;
 
-  Model pin_model_;
+  /// Model of the robot whose center of mass velocity is tracked, shared by
+  /// the copies of the residual.
+  ModelHandle pin_model_handle_;
   Vector3s v_ref_;
 
   CenterOfMassVelocityResidualTpl(const int ndx, const int nu,
                                   const Model &model, const Vector3s &frame_vel)
+      : CenterOfMassVelocityResidualTpl(
+            ndx, nu, std::make_shared<const Model>(model), frame_vel) {}
+
+  /// Constructor sharing the model @p model with other functions.
+  CenterOfMassVelocityResidualTpl(const int ndx, const int nu,
+                                  ModelHandle model, const Vector3s &frame_vel)
       : Base(ndx, nu, 3)
-      , pin_model_(model)
+      , pin_model_handle_(std::move(model))
       , v_ref_(frame_vel) {}
 
+  const Model &getModel() const { return *pin_model_handle_; }
+
   ALIGATOR_DEPRECATED const Vector3s &getReference() const { return v_ref_; }
   ALIGATOR_DEPRECATED void
   setReference(const Eigen::Ref<const Vector3s> &v_new) {
@@ -23,8 +23,11 @@ public:
   using Model = pinocchio::ModelTpl<Scalar>;
   using SE3 = pinocchio::SE3Tpl<Scalar>;
   using Data = CentroidalMomentumDerivativeDataTpl<Scalar>;
+  using ModelHandle = shared_ptr<const Model>;
 
-  Model pin_model_;
+  /// Model of the robot whose momentum rate is constrained, shared by the
+  /// copies of the residual.
+  ModelHandle pin_model_handle_;
   double mass_;
   Vector3s gravity_;
   std::vector<bool> contact_states_;
@@ -37,6 +40,15 @@ public:
       const std::vector<pinocchio::FrameIndex> &contact_ids,
       const int force_size);
 
+  /// Constructor sharing the model @p model with other functions.
+  CentroidalMomentumDerivativeResidualTpl(
+      const int ndx, ModelHandle model, const Vector3s &gravity,
+      const std::vector<bool> &contact_states,
+      const std::vector<pinocchio::FrameIndex> &contact_ids,
+      const int force_size);
+
+  const Model &getModel() const { return *pin_model_handle_; }
+
   void evaluate(const ConstVectorRef &x, const ConstVectorRef &u,
                 BaseData &data) const;
 
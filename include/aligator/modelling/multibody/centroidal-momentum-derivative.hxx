@@ -16,13 +16,24 @@ CentroidalMomentumDerivativeResidualTpl<Scalar>::
         const std::vector<bool> &contact_states,
         const std::vector<pinocchio::FrameIndex> &contact_ids,
         const int force_size)
-    : Base(ndx, (int)contact_states.size() * force_size + model.nv - 6, 6)
-    , pin_model_(model)
+    : CentroidalMomentumDerivativeResidualTpl(
+          ndx, std::make_shared<const Model>(model), gravity, contact_states,
+          contact_ids, force_size) {}
+
+template <typename Scalar>
+CentroidalMomentumDerivativeResidualTpl<Scalar>::
+    CentroidalMomentumDerivativeResidualTpl(
+        const int ndx, ModelHandle model, const Vector3s &gravity,
+        const std::vector<bool> &contact_states,
+        const std::vector<pinocchio::FrameIndex> &contact_ids,
+        const int force_size)
+    : Base(ndx, (int)contact_states.size() * force_size + model->nv - 6, 6)
+    , pin_model_handle_(std::move(model))
     , gravity_(gravity)
     , contact_states_(contact_states)
     , contact_ids_(contact_ids)
     , force_size_(force_size) {
-  mass_ = pinocchio::computeTotalMass(model);
+  mass_ = pinocchio::computeTotalMass(getModel());
   if (contact_ids_.size() != contact_states_.size()) {
     ALIGATOR_DOMAIN_ERROR(
         "contact_ids and contact_states should have same size ({:d} and {:d}).",
@@ -36,11 +47,11 @@ void CentroidalMomentumDerivativeResidualTpl<Scalar>::evaluate(
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
 
-  const ConstVectorRef q = x.head(pin_model_.nq);
-  const ConstVectorRef v = x.tail(pin_model_.nv);
+  const ConstVectorRef q = x.head(getModel().nq);
+  const ConstVectorRef v = x.tail(getModel().nv);
 
-  pinocchio::forwardKinematics(pin_model_, pdata, q);
-  pinocchio::centerOfMass(pin_model_, pdata, q, v);
+  pinocchio::forwardKinematics(getModel(), pdata, q);
+  pinocchio::centerOfMass(getModel(), pdata, q, v);
 
   d.value_.template head<3>() = mass_ * gravity_;
   d.value_.template tail<3>().setZero();
@@ -48,7 +59,7 @@ void CentroidalMomentumDerivativeResidualTpl<Scalar>::evaluate(
     if (contact_states_[i]) {
       long i_ = static_cast<long>(i);
       d.value_.template head<3>() += u.template segment<3>(i_ * force_size_);
-      pinocchio::updateFramePlacement(pin_model_, pdata, contact_ids_[i]);
+      pinocchio::updateFramePlacement(getModel(), pdata, contact_ids_[i]);
       d.value_[3] +=
           (pdata.oMf[contact_ids_[i]].translation()[1] - pdata.com[0][1]) *
               u[i_ * force_size_ + 2] -
@@ -78,23 +89,23 @@ void CentroidalMomentumDerivativeResidualTpl<Scalar>::computeJacobians(
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
 
-  const auto q = x.head(pin_model_.nq);
+  const auto q = x.head(getModel().nq);
 
-  pinocchio::jacobianCenterOfMass(pin_model_, pdata, q);
-  pinocchio::computeJointJacobians(pin_model_, pdata);
+  pinocchio::jacobianCenterOfMass(getModel(), pdata, q);
+  pinocchio::computeJointJacobians(getModel(), pdata);
 
   d.Jx_.setZero();
   for (std::size_t i = 0; i < contact_states_.size(); i++) {
     long i_ = static_cast<long>(i);
     if (contact_states_[i]) {
       d.fJf_.setZero();
-      pinocchio::getFrameJacobian(pin_model_, pdata, contact_ids_[i],
+      pinocchio::getFrameJacobian(getModel(), pdata, contact_ids_[i],
                                   pinocchio::LOCAL_WORLD_ALIGNED, d.fJf_);
       d.Jtemp_ << 0, -u[i_ * force_size_ + 2], u[i_ * force_size_ + 1],
           u[i_ * force_size_ + 2], 0, -u[i_ * force_size_],
           -u[i_ * force_size_ + 1], u[i_ * force_size_], 0;
       d.temp_.noalias() = pdata.Jcom - d.fJf_.template topRows<3>();
-      d.Jx_.bottomLeftCorner(3, pin_model_.nv).noalias() += d.Jtemp_ * d.temp_;
+      d.Jx_.bottomLeftCorner(3, getModel().nv).noalias() += d.Jtemp_ * d.temp_;
     }
   }
 
@@ -124,9 +135,9 @@ CentroidalMomentumDerivativeDataTpl<Scalar>::
     CentroidalMomentumDerivativeDataTpl(
         const CentroidalMomentumDerivativeResidualTpl<Scalar> *model)
     : Base(model->ndx1, model->nu, 6)
-    , pin_data_(model->pin_model_)
-    , temp_(3, model->pin_model_.nv)
-    , fJf_(6, model->pin_model_.nv) {
+    , pin_data_(model->getModel())
+    , temp_(3, model->getModel().nv)
+    , fJf_(6, model->getModel().nv) {
   fJf_.setZero();
   temp_.setZero();
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "./fwd.hpp"
+#include "./kinematics-cache.hpp"
 #include "aligator/core/unary-function.hpp"
 
 #include <pinocchio/multibody/model.hpp>
@@ -24,16 +25,27 @@ public:
   using Model = pinocchio::ModelTpl<Scalar>;
   using SE3 = pinocchio::SE3Tpl<Scalar>;
   using Data = CentroidalMomentumDataTpl<Scalar>;
+  using ModelHandle = shared_ptr<const Model>;
 
-  Model pin_model_;
+  /// Model of the robot whose centroidal momentum is tracked, shared by the
+  /// copies of the residual.
+  ModelHandle pin_model_handle_;
   Vector6s h_ref_;
 
   CentroidalMomentumResidualTpl(const int ndx, const int nu, const Model &model,
                                 const Vector6s &h_ref)
+      : CentroidalMomentumResidualTpl(
+            ndx, nu, std::make_shared<const Model>(model), h_ref) {}
+
+  /// Constructor sharing the model @p model with other functions.
+  CentroidalMomentumResidualTpl(const int ndx, const int nu, ModelHandle model,
+                                const Vector6s &h_ref)
       : Base(ndx, nu, 6)
-      , pin_model_(model)
+      , pin_model_handle_(std::move(model))
       , h_ref_(h_ref) {}
 
+  const Model &getModel() const { return *pin_model_handle_; }
+
   void evaluate(const ConstVectorRef &x, BaseData &data) const;
 
   void computeJacobians(const ConstVectorRef &x, BaseData &data) const;
@@ -51,14 +63,11 @@ struct CentroidalMomentumDataTpl : StageFunctionDataTpl<Scalar> {
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   using Base = StageFunctionDataTpl<Scalar>;
   using PinData = pinocchio::DataTpl<Scalar>;
-  using Matrix6Xs = typename math_types<Scalar>::Matrix6Xs;
-
-  /// Pinocchio data object.
-  PinData pin_data_;
-  Matrix6Xs dh_dq_;
-  Matrix6Xs dhdot_dq_;
-  Matrix6Xs dhdot_dv_;
-  Matrix6Xs dhdot_da_;
+
+  /// Kinematics cache, shared with the other multibody functions of the stage.
+  shared_ptr<KinematicsCacheTpl<Scalar>> kinematics_;
+  /// Pinocchio data of the kinematics cache.
+  PinData &pin_data_;
 
   CentroidalMomentumDataTpl(const CentroidalMomentumResidualTpl<Scalar> *model);
 };
@@ -32,7 +32,10 @@ public:
   using ProxSettings = pinocchio::ProximalSettingsTpl<Scalar>;
   using Vector3or6 = Eigen::Matrix<Scalar, -1, 1, Eigen::ColMajor, 6, 1>;
 
-  Model pin_model_;
+  using ModelHandle = shared_ptr<const Model>;
+
+  /// Model of the robot in contact, shared by the copies of the residual.
+  ModelHandle pin_model_handle_;
   MatrixXs actuation_matrix_;
   RigidConstraintModelVector constraint_models_;
   ProxSettings prox_settings_;
@@ -45,17 +48,27 @@ public:
                           const RigidConstraintModelVector &constraint_models,
                           const ProxSettings &prox_settings,
                           const Vector3or6 &fref, std::string_view contact_name)
+      : ContactForceResidualTpl(ndx, std::make_shared<const Model>(model),
+                                actuation, constraint_models, prox_settings,
+                                fref, contact_name) {}
+
+  /// Constructor sharing the model @p model with other functions.
+  ContactForceResidualTpl(const int ndx, ModelHandle model,
+                          const MatrixXs &actuation,
+                          const RigidConstraintModelVector &constraint_models,
+                          const ProxSettings &prox_settings,
+                          const Vector3or6 &fref, std::string_view contact_name)
       : Base(ndx, (int)actuation.cols(), (int)fref.size())
-      , pin_model_(model)
+      , pin_model_handle_(std::move(model))
       , actuation_matrix_(actuation)
       , constraint_models_(constraint_models)
       , prox_settings_(prox_settings)
       , fref_(fref)
       , force_size_(fref.size()) {
-    if (model.nv != actuation.rows()) {
+    if (getModel().nv != actuation.rows()) {
       ALIGATOR_DOMAIN_ERROR("Actuation matrix should have number of rows = "
                             "model.nv ({:d} and {:d}).",
-                            actuation.rows(), model.nv);
+                            actuation.rows(), getModel().nv);
     }
     contact_id_ = -1;
     for (std::size_t i = 0; i < constraint_models.size(); i++) {
@@ -69,6 +82,8 @@ public:
     }
   }
 
+  const Model &getModel() const { return *pin_model_handle_; }
+
   const Vector3or6 &getReference() const { return fref_; }
   void setReference(const Eigen::Ref<const Vector3or6> &fnew) { fref_ = fnew; }
 
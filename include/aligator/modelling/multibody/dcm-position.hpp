@@ -19,16 +19,27 @@ public:
   using Model = pinocchio::ModelTpl<Scalar>;
   using SE3 = pinocchio::SE3Tpl<Scalar>;
   using Data = DCMPositionDataTpl<Scalar>;
+  using ModelHandle = shared_ptr<const Model>;
 
-  Model pin_model_;
+  /// Model of the robot whose divergent component of motion is tracked,
+  /// shared by the copies of the residual.
+  ModelHandle pin_model_handle_;
 
   DCMPositionResidualTpl(const int ndx, const int nu, const Model &model,
                          const Vector3s &dcm_ref, const double alpha)
+      : DCMPositionResidualTpl(ndx, nu, std::make_shared<const Model>(model),
+                               dcm_ref, alpha) {}
+
+  /// Constructor sharing the model @p model with other functions.
+  DCMPositionResidualTpl(const int ndx, const int nu, ModelHandle model,
+                         const Vector3s &dcm_ref, const double alpha)
       : Base(ndx, nu, 3)
-      , pin_model_(model)
+      , pin_model_handle_(std::move(model))
       , dcm_ref_(dcm_ref)
       , alpha_(alpha) {}
 
+  const Model &getModel() const { return *pin_model_handle_; }
+
   const Vector3s &getReference() const { return dcm_ref_; }
   void setReference(const Eigen::Ref<const Vector3s> &new_ref) {
     dcm_ref_ = new_ref;
@@ -11,8 +11,8 @@ void DCMPositionResidualTpl<Scalar>::evaluate(const ConstVectorRef &x,
                                               BaseData &data) const {
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
-  pinocchio::centerOfMass(pin_model_, pdata, x.head(pin_model_.nq),
-                          x.segment(pin_model_.nq, pin_model_.nv));
+  pinocchio::centerOfMass(getModel(), pdata, x.head(getModel().nq),
+                          x.segment(getModel().nq, getModel().nv));
 
   d.value_ = pdata.com[0] + alpha_ * pdata.vcom[0] - dcm_ref_;
 }
@@ -23,19 +23,19 @@ void DCMPositionResidualTpl<Scalar>::computeJacobians(const ConstVectorRef &x,
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
 
-  pinocchio::getCenterOfMassVelocityDerivatives(pin_model_, pdata, d.fJf_);
-  pinocchio::jacobianCenterOfMass(pin_model_, pdata, x.head(pin_model_.nq));
+  pinocchio::getCenterOfMassVelocityDerivatives(getModel(), pdata, d.fJf_);
+  pinocchio::jacobianCenterOfMass(getModel(), pdata, x.head(getModel().nq));
 
-  d.Jx_.leftCols(pin_model_.nv) = pdata.Jcom + alpha_ * d.fJf_;
-  d.Jx_.rightCols(pin_model_.nv) = alpha_ * pdata.Jcom;
+  d.Jx_.leftCols(getModel().nv) = pdata.Jcom + alpha_ * d.fJf_;
+  d.Jx_.rightCols(getModel().nv) = alpha_ * pdata.Jcom;
 }
 
 template <typename Scalar>
 DCMPositionDataTpl<Scalar>::DCMPositionDataTpl(
     const DCMPositionResidualTpl<Scalar> &model)
     : Base(model.ndx1, model.nu, 3)
-    , pin_data_(model.pin_model_)
-    , fJf_(3, model.pin_model_.nv) {
+    , pin_data_(model.getModel())
+    , fJf_(3, model.getModel().nv) {
   fJf_.setZero();
 }
 
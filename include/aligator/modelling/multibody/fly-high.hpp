@@ -3,6 +3,7 @@
 #ifdef ALIGATOR_WITH_PINOCCHIO
 #include "aligator/core/unary-function.hpp"
 #include "./fwd.hpp"
+#include "./kinematics-cache.hpp"
 #include "aligator/modelling/spaces/multibody.hpp"
 
 namespace aligator {
@@ -17,6 +18,7 @@ struct FlyHighResidualTpl : UnaryFunctionTpl<_Scalar>, frame_api {
   using Base = UnaryFunctionTpl<Scalar>;
   using BaseData = StageFunctionDataTpl<Scalar>;
   using Model = pinocchio::ModelTpl<Scalar>;
+  using ModelHandle = shared_ptr<const Model>;
 
   struct Data;
 
@@ -24,6 +26,11 @@ struct FlyHighResidualTpl : UnaryFunctionTpl<_Scalar>, frame_api {
                      const pinocchio::FrameIndex frame_id, Scalar slope,
                      int nu);
 
+  /// Constructor sharing the model @p model with other functions.
+  FlyHighResidualTpl(const int ndx, ModelHandle model,
+                     const pinocchio::FrameIndex frame_id, Scalar slope,
+                     int nu);
+
   void evaluate(const ConstVectorRef &x, BaseData &data) const;
   void computeJacobians(const ConstVectorRef &x, BaseData &data) const;
 
@@ -31,12 +38,14 @@ struct FlyHighResidualTpl : UnaryFunctionTpl<_Scalar>, frame_api {
     return std::make_shared<Data>(*this);
   }
 
-  const auto &getModel() const { return pin_model_; }
+  const Model &getModel() const { return *pin_model_handle_; }
 
   Scalar slope_;
 
 private:
-  Model pin_model_;
+  /// Model of the robot owning the foot frame, shared by the copies of the
+  /// residual.
+  ModelHandle pin_model_handle_;
 };
 
 template <typename Scalar>
@@ -51,14 +60,15 @@ struct FlyHighResidualTpl<Scalar>::Data : StageFunctionDataTpl<Scalar> {
 
   Data(FlyHighResidualTpl const &model)
       : BaseData(model.ndx1, model.nu, model.nr)
-      , pdata_(model.pin_model_)
-      , d_dq(6, model.pin_model_.nv)
-      , d_dv(6, model.pin_model_.nv)
-      , l_dnu_dq(6, model.pin_model_.nv)
-      , l_dnu_dv(6, model.pin_model_.nv)
-      , o_dv_dq(3, model.pin_model_.nv)
-      , o_dv_dv(3, model.pin_model_.nv)
-      , vxJ(3, model.pin_model_.nv) {
+      , kinematics_(KinematicsCacheTpl<Scalar>::get(model.getModel()))
+      , pdata_(kinematics_->data)
+      , d_dq(6, model.getModel().nv)
+      , d_dv(6, model.getModel().nv)
+      , l_dnu_dq(6, model.getModel().nv)
+      , l_dnu_dv(6, model.getModel().nv)
+      , o_dv_dq(3, model.getModel().nv)
+      , o_dv_dv(3, model.getModel().nv)
+      , vxJ(3, model.getModel().nv) {
     d_dq.setZero();
     d_dv.setZero();
     l_dnu_dq.setZero();
@@ -68,7 +78,9 @@ struct FlyHighResidualTpl<Scalar>::Data : StageFunctionDataTpl<Scalar> {
     vxJ.setZero();
   }
 
-  pinocchio::DataTpl<Scalar> pdata_;
+  /// Kinematics cache, shared with the other multibody functions of the stage.
+  shared_ptr<KinematicsCacheTpl<Scalar>> kinematics_;
+  pinocchio::DataTpl<Scalar> &pdata_;
   Matrix6Xs d_dq, d_dv;
   Matrix6Xs l_dnu_dq, l_dnu_dv;
   Matrix3Xs o_dv_dq, o_dv_dv, vxJ;
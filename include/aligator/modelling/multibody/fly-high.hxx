@@ -11,9 +11,16 @@ template <typename Scalar>
 FlyHighResidualTpl<Scalar>::FlyHighResidualTpl(
     const int ndx, const Model &model, const pinocchio::FrameIndex frame_id,
     Scalar slope, int nu)
+    : FlyHighResidualTpl(ndx, std::make_shared<const Model>(model), frame_id,
+                         slope, nu) {}
+
+template <typename Scalar>
+FlyHighResidualTpl<Scalar>::FlyHighResidualTpl(
+    const int ndx, ModelHandle model, const pinocchio::FrameIndex frame_id,
+    Scalar slope, int nu)
     : Base(ndx, nu, NR)
     , slope_(slope)
-    , pin_model_(model) {
+    , pin_model_handle_(std::move(model)) {
   pin_frame_id_ = frame_id;
 }
 
@@ -21,12 +28,12 @@ template <typename Scalar>
 void FlyHighResidualTpl<Scalar>::evaluate(const ConstVectorRef &x,
                                           BaseData &data) const {
   Data &d = static_cast<Data &>(data);
-  const ConstVectorRef q = x.head(pin_model_.nq);
-  const ConstVectorRef v = x.segment(pin_model_.nq, pin_model_.nv);
-  pinocchio::forwardKinematics(pin_model_, d.pdata_, q, v);
-  pinocchio::updateFramePlacement(pin_model_, d.pdata_, pin_frame_id_);
+  const ConstVectorRef q = x.head(getModel().nq);
+  const ConstVectorRef v = x.segment(getModel().nq, getModel().nv);
+  d.kinematics_->forwardKinematics(getModel(), q, v);
+  d.kinematics_->updateFramePlacement(getModel(), q, pin_frame_id_);
 
-  d.value_ = pinocchio::getFrameVelocity(pin_model_, d.pdata_, pin_frame_id_,
+  d.value_ = pinocchio::getFrameVelocity(getModel(), d.pdata_, pin_frame_id_,
                                          pinocchio::LOCAL_WORLD_ALIGNED)
                  .linear()
                  .template head<2>();
@@ -40,18 +47,16 @@ template <typename Scalar>
 void FlyHighResidualTpl<Scalar>::computeJacobians(const ConstVectorRef &x,
                                                   BaseData &data) const {
   Data &d = static_cast<Data &>(data);
-  const int nv = pin_model_.nv;
-  const ConstVectorRef q = x.head(pin_model_.nq);
-  const ConstVectorRef v = x.segment(pin_model_.nq, nv);
-  VectorXs a = VectorXs::Zero(nv);
+  const int nv = getModel().nv;
+  const ConstVectorRef q = x.head(getModel().nq);
+  const ConstVectorRef v = x.segment(getModel().nq, nv);
 
-  pinocchio::computeForwardKinematicsDerivatives(pin_model_, d.pdata_, q, v,
-                                                 pinocchio::make_const_ref(a));
-  pinocchio::getFrameVelocityDerivatives(pin_model_, d.pdata_, pin_frame_id_,
+  d.kinematics_->computeForwardKinematicsDerivatives(getModel(), q, v);
+  pinocchio::getFrameVelocityDerivatives(getModel(), d.pdata_, pin_frame_id_,
                                          pinocchio::LOCAL, d.l_dnu_dq,
                                          d.l_dnu_dv);
-  const Vector3s &vf =
-      pinocchio::getFrameVelocity(pin_model_, d.pdata_, pin_frame_id_,
+  const Vector3s vf =
+      pinocchio::getFrameVelocity(getModel(), d.pdata_, pin_frame_id_,
                                   pinocchio::LOCAL)
           .linear();
   using Matrix3s = Eigen::Matrix<Scalar, 3, 3>;
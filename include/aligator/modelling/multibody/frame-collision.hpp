@@ -2,6 +2,7 @@
 
 #include "aligator/core/unary-function.hpp"
 #include "./fwd.hpp"
+#include "./kinematics-cache.hpp"
 
 #include <pinocchio/multibody/geometry.hpp>
 #include <pinocchio/multibody/model.hpp>
@@ -27,14 +28,25 @@ public:
   using Data = FrameCollisionDataTpl<Scalar>;
   using GeometryModel = pinocchio::GeometryModel;
 
-  Model pin_model_;
+  using ModelHandle = shared_ptr<const Model>;
+
+  /// Model of the robot carrying the colliding frames, shared by the copies of
+  /// the residual.
+  ModelHandle pin_model_handle_;
   GeometryModel geom_model_;
 
   FrameCollisionResidualTpl(const int ndx, const int nu, const Model &model,
                             const GeometryModel &geom_model,
                             const pinocchio::PairIndex frame_pair_id)
+      : FrameCollisionResidualTpl(ndx, nu, std::make_shared<const Model>(model),
+                                  geom_model, frame_pair_id) {}
+
+  /// Constructor sharing the model @p model with other functions.
+  FrameCollisionResidualTpl(const int ndx, const int nu, ModelHandle model,
+                            const GeometryModel &geom_model,
+                            const pinocchio::PairIndex frame_pair_id)
       : Base(ndx, nu, 1)
-      , pin_model_(model)
+      , pin_model_handle_(std::move(model))
       , geom_model_(geom_model)
       , frame_pair_id_(frame_pair_id) {
     if (frame_pair_id >= geom_model_.collisionPairs.size()) {
@@ -53,6 +65,8 @@ public:
             .parentFrame;
   }
 
+  const Model &getModel() const { return *pin_model_handle_; }
+
   void evaluate(const ConstVectorRef &x, BaseData &data) const;
 
   void computeJacobians(const ConstVectorRef &x, BaseData &data) const;
@@ -74,15 +88,16 @@ struct FrameCollisionDataTpl : StageFunctionDataTpl<Scalar> {
   using typename Base::Matrix6Xs;
   using typename Base::Vector3s;
   using SE3 = pinocchio::SE3Tpl<Scalar>;
+  using PinData = pinocchio::DataTpl<Scalar>;
 
-  pinocchio::DataTpl<Scalar> pin_data_;
+  /// Kinematics cache, shared with the other multibody functions of the stage.
+  shared_ptr<KinematicsCacheTpl<Scalar>> kinematics_;
+  /// Pinocchio data object.
+  PinData &pin_data_;
   pinocchio::GeometryData geom_data;
   /// Jacobian of the collision point
   Matrix6Xs Jcol_;
   Matrix6Xs Jcol2_;
-  /// Placement of collision point to joint
-  SE3 jointToP1_;
-  SE3 jointToP2_;
   /// Distance from nearest point to joint for each collision frame
   Vector3s distance_;
   Vector3s distance2_;
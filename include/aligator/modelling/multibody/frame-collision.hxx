@@ -13,12 +13,11 @@ void FrameCollisionResidualTpl<Scalar>::evaluate(const ConstVectorRef &x,
                                                  BaseData &data) const {
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
-  pinocchio::forwardKinematics(pin_model_, pdata, x.head(pin_model_.nq));
-  pinocchio::updateFramePlacements(pin_model_, pdata);
+  d.kinematics_->updateFramePlacements(getModel(), x.head(getModel().nq));
 
   // computes the collision distance between pair of frames
-  pinocchio::updateGeometryPlacements(pin_model_, pdata, geom_model_,
-                                      d.geom_data, x.head(pin_model_.nq));
+  pinocchio::updateGeometryPlacements(getModel(), pdata, geom_model_,
+                                      d.geom_data);
   pinocchio::computeDistance(geom_model_, d.geom_data, frame_pair_id_);
 
   // calculate residual
@@ -26,8 +25,8 @@ void FrameCollisionResidualTpl<Scalar>::evaluate(const ConstVectorRef &x,
 }
 
 template <typename Scalar>
-void FrameCollisionResidualTpl<Scalar>::computeJacobians(const ConstVectorRef &,
-                                                         BaseData &data) const {
+void FrameCollisionResidualTpl<Scalar>::computeJacobians(
+    const ConstVectorRef &x, BaseData &data) const {
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
 
@@ -38,41 +37,38 @@ void FrameCollisionResidualTpl<Scalar>::computeJacobians(const ConstVectorRef &,
   d.distance2_ = d.geom_data.distanceResults[frame_pair_id_].nearest_points[1] -
                  pdata.oMf[frame_id2_].translation();
 
-  d.jointToP1_.setIdentity();
-  d.jointToP1_.translation(d.distance_);
-
-  d.jointToP2_.setIdentity();
-  d.jointToP2_.translation(d.distance2_);
-
   // Get frame Jacobians
-  pinocchio::computeJointJacobians(pin_model_, pdata);
-  pinocchio::getFrameJacobian(pin_model_, pdata, frame_id1_,
+  d.kinematics_->computeJointJacobians(getModel(), x.head(getModel().nq));
+  pinocchio::getFrameJacobian(getModel(), pdata, frame_id1_,
                               pinocchio::LOCAL_WORLD_ALIGNED, d.Jcol_);
 
-  pinocchio::getFrameJacobian(pin_model_, pdata, frame_id2_,
+  pinocchio::getFrameJacobian(getModel(), pdata, frame_id2_,
                               pinocchio::LOCAL_WORLD_ALIGNED, d.Jcol2_);
 
-  // compute Jacobian at p1
-  d.Jcol_ = d.jointToP1_.toActionMatrixInverse() * d.Jcol_;
-
-  // compute Jacobian at p2
-  d.Jcol2_ = d.jointToP2_.toActionMatrixInverse() * d.Jcol2_;
+  // compute the linear velocity Jacobians at p1 and p2, v + w x p
+  d.Jcol_.template topRows<3>().noalias() -=
+      pinocchio::skew(d.distance_) * d.Jcol_.template bottomRows<3>();
+  d.Jcol2_.template topRows<3>().noalias() -=
+      pinocchio::skew(d.distance2_) * d.Jcol2_.template bottomRows<3>();
 
   // compute the residual derivatives
+  const auto &normal = d.geom_data.distanceResults[frame_pair_id_].normal;
   d.Jx_.setZero();
-  d.Jx_.leftCols(pin_model_.nv) =
-      d.geom_data.distanceResults[frame_pair_id_].normal.transpose() *
-      (d.Jcol2_.template topRows<3>() - d.Jcol_.template topRows<3>());
+  d.Jx_.leftCols(getModel().nv).noalias() =
+      normal.transpose() * d.Jcol2_.template topRows<3>();
+  d.Jx_.leftCols(getModel().nv).noalias() -=
+      normal.transpose() * d.Jcol_.template topRows<3>();
 }
 
 template <typename Scalar>
 FrameCollisionDataTpl<Scalar>::FrameCollisionDataTpl(
     const FrameCollisionResidualTpl<Scalar> &model)
     : Base(model.ndx1, model.nu, 1)
-    , pin_data_(model.pin_model_)
+    , kinematics_(KinematicsCacheTpl<Scalar>::get(model.getModel()))
+    , pin_data_(kinematics_->data)
     , geom_data(pinocchio::GeometryData(model.geom_model_))
-    , Jcol_(6, model.pin_model_.nv)
-    , Jcol2_(6, model.pin_model_.nv) {
+    , Jcol_(6, model.getModel().nv)
+    , Jcol2_(6, model.getModel().nv) {
   Jcol_.setZero();
   Jcol2_.setZero();
 }
@@ -40,17 +40,34 @@ public:
   using SE3 = pinocchio::SE3Tpl<Scalar>;
   using Data = FrameEqualityDataTpl<Scalar>;
 
-  Model pin_model_;
+  using ModelHandle = shared_ptr<const Model>;
+
+  /// Model of the robot owning both frames, shared by the copies of the
+  /// residual.
+  ModelHandle pin_model_handle_;
 
   FrameEqualityResidualTpl(const int ndx, const int nu, const Model &model,
                            const pinocchio::FrameIndex frame_id1,
                            const pinocchio::FrameIndex frame_id2,
                            const SE3 &f1Mf2_ref = SE3::Identity())
+      : FrameEqualityResidualTpl(ndx, nu, std::make_shared<const Model>(model),
+                                 frame_id1, frame_id2, f1Mf2_ref) {}
+
+  /// Constructor sharing the model @p model with other functions.
+  FrameEqualityResidualTpl(const int ndx, const int nu, ModelHandle model,
+                           const pinocchio::FrameIndex frame_id1,
+                           const pinocchio::FrameIndex frame_id2,
+                           const SE3 &f1Mf2_ref = SE3::Identity())
       : Base(ndx, nu, 6)
-      , pin_model_(model)
+      , pin_model_handle_(std::move(model))
       , pin_frame_id1_(frame_id1)
       , pin_frame_id2_(frame_id2)
-      , f1MR_ref_(f1Mf2_ref) {}
+      , f1MR_ref_(f1Mf2_ref) {
+    // depends on the configuration only
+    this->jac_pattern.x_size = getModel().nv;
+  }
+
+  const Model &getModel() const { return *pin_model_handle_; }
 
   // Getters and setters
   pinocchio::FrameIndex getFrame1Id() const { return pin_frame_id1_; }
@@ -92,6 +109,8 @@ struct FrameEqualityDataTpl : StageFunctionDataTpl<Scalar> {
   typename math_types<Scalar>::Matrix6Xs wJf1_;
   /// Jacobian of frame 2 expressed in WORLD
   typename math_types<Scalar>::Matrix6Xs wJf2_;
+  /// Workspace for the Jacobian of the error
+  typename math_types<Scalar>::Matrix6Xs Jtmp_;
 
   FrameEqualityDataTpl(const FrameEqualityResidualTpl<Scalar> &model);
 };
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "aligator/modelling/multibody/fwd.hpp"
+#include "aligator/modelling/multibody/kinematics-cache.hpp"
 #include "aligator/core/unary-function.hpp"
+#include "aligator/core/stage-parameters.hpp"
 
 #include <pinocchio/multibody/model.hpp>
 #include <pinocchio/multibody/frame.hpp>
@@ -25,18 +27,37 @@ public:
   using SE3 = pinocchio::SE3Tpl<Scalar>;
   using Data = FramePlacementDataTpl<Scalar>;
 
-  Model pin_model_;
+  using ModelHandle = shared_ptr<const Model>;
+
+  /// Model of the robot owning the frame, shared by the copies of the residual
+  /// and possibly by other functions.
+  ModelHandle pin_model_handle_;
+  /// Name of the stage parameter slot to read the reference placement from, as
+  /// \f$(x, y, z, q_x, q_y, q_z, q_w)\f$, if not empty.
+  std::string reference_parameter_;
 
   FramePlacementResidualTpl(const int ndx, const int nu, const Model &model,
                             const SE3 &frame,
                             const pinocchio::FrameIndex frame_id)
+      : FramePlacementResidualTpl(ndx, nu, std::make_shared<const Model>(model),
+                                  frame, frame_id) {}
+
+  /// Constructor sharing the model @p model with other functions, e.g. the
+  /// handle held by MultibodyPhaseSpace.
+  FramePlacementResidualTpl(const int ndx, const int nu, ModelHandle model,
+                            const SE3 &frame,
+                            const pinocchio::FrameIndex frame_id)
       : Base(ndx, nu, 6)
-      , pin_model_(model)
+      , pin_model_handle_(std::move(model))
       , p_ref_(frame)
       , p_ref_inverse_(frame.inverse()) {
     pin_frame_id_ = frame_id;
+    // depends on the configuration only
+    this->jac_pattern.x_size = getModel().nv;
   }
 
+  const Model &getModel() const { return *pin_model_handle_; }
+
   const SE3 &getReference() const { return p_ref_; }
   void setReference(const SE3 &p_new) {
     p_ref_ = p_new;
@@ -51,6 +72,8 @@ public:
     return std::make_shared<Data>(*this);
   }
 
+  void registerParameters(StageParametersTpl<Scalar> &params) const;
+
 protected:
   SE3 p_ref_;
   SE3 p_ref_inverse_;
@@ -63,8 +86,12 @@ struct FramePlacementDataTpl : StageFunctionDataTpl<Scalar> {
   using PinData = pinocchio::DataTpl<Scalar>;
   using SE3 = pinocchio::SE3Tpl<Scalar>;
 
+  /// Kinematics cache, shared with the other multibody functions of the stage.
+  shared_ptr<KinematicsCacheTpl<Scalar>> kinematics_;
   /// Pinocchio data object.
-  PinData pin_data_;
+  PinData &pin_data_;
+  /// Reference placement, if read from the stage parameters.
+  StageParameterViewTpl<Scalar> reference_;
   /// Placement error of the frame.
   SE3 rMf_;
   /// Jacobian of the error
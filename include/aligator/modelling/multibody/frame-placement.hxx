@@ -11,33 +11,52 @@ void FramePlacementResidualTpl<Scalar>::evaluate(const ConstVectorRef &x,
                                                  BaseData &data) const {
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
-  const ConstVectorRef q = x.head(pin_model_.nq);
-  pinocchio::forwardKinematics(pin_model_, pdata, q);
-  pinocchio::updateFramePlacement(pin_model_, pdata, pin_frame_id_);
+  d.kinematics_->updateFramePlacement(getModel(), x.head(getModel().nq),
+                                      pin_frame_id_);
 
-  d.rMf_ = p_ref_inverse_ * pdata.oMf[pin_frame_id_];
+  if (d.reference_.isBound()) {
+    const ConstVectorRef p = d.reference_.value();
+    const Eigen::Quaternion<Scalar> quat(p[6], p[3], p[4], p[5]);
+    const SE3 p_ref(quat.normalized().toRotationMatrix(), p.template head<3>());
+    d.rMf_ = p_ref.actInv(pdata.oMf[pin_frame_id_]);
+  } else {
+    d.rMf_ = p_ref_inverse_ * pdata.oMf[pin_frame_id_];
+  }
   d.value_ = pinocchio::log6(d.rMf_).toVector();
 }
 
 template <typename Scalar>
-void FramePlacementResidualTpl<Scalar>::computeJacobians(const ConstVectorRef &,
-                                                         BaseData &data) const {
+void FramePlacementResidualTpl<Scalar>::computeJacobians(
+    const ConstVectorRef &x, BaseData &data) const {
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
   pinocchio::Jlog6(d.rMf_, d.rJf_);
-  pinocchio::computeJointJacobians(pin_model_, pdata);
-  pinocchio::getFrameJacobian(pin_model_, pdata, pin_frame_id_,
+  d.kinematics_->computeJointJacobians(getModel(), x.head(getModel().nq));
+  pinocchio::getFrameJacobian(getModel(), pdata, pin_frame_id_,
                               pinocchio::LOCAL, d.fJf_);
-  d.Jx_.leftCols(pin_model_.nv) = d.rJf_ * d.fJf_;
+  d.Jx_.leftCols(getModel().nv).noalias() = d.rJf_ * d.fJf_;
+}
+
+template <typename Scalar>
+void FramePlacementResidualTpl<Scalar>::registerParameters(
+    StageParametersTpl<Scalar> &params) const {
+  if (reference_parameter_.empty())
+    return;
+  Eigen::Matrix<Scalar, 7, 1> p;
+  p.template head<3>() = p_ref_.translation();
+  p.template tail<4>() = Eigen::Quaternion<Scalar>(p_ref_.rotation()).coeffs();
+  params.declareSlot(reference_parameter_, p);
 }
 
 template <typename Scalar>
 FramePlacementDataTpl<Scalar>::FramePlacementDataTpl(
     const FramePlacementResidualTpl<Scalar> &model)
     : Base(model.ndx1, model.nu, 6)
-    , pin_data_(model.pin_model_)
+    , kinematics_(KinematicsCacheTpl<Scalar>::get(model.getModel()))
+    , pin_data_(kinematics_->data)
+    , reference_(model.reference_parameter_, 7)
     , rJf_(6, 6)
-    , fJf_(6, model.pin_model_.nv) {
+    , fJf_(6, model.getModel().nv) {
   rJf_.setZero();
   fJf_.setZero();
 }
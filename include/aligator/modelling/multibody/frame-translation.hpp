@@ -1,7 +1,9 @@
 #pragma once
 
 #include "aligator/core/unary-function.hpp"
+#include "aligator/core/stage-parameters.hpp"
 #include "aligator/modelling/multibody/fwd.hpp"
+#include "aligator/modelling/multibody/kinematics-cache.hpp"
 
 #include <pinocchio/multibody/model.hpp>
 #include <pinocchio/multibody/frame.hpp>
@@ -23,13 +25,27 @@ struct FrameTranslationResidualTpl : UnaryFunctionTpl<_Scalar>, frame_api {
   using SE3 = pinocchio::SE3Tpl<Scalar>;
   using Data = FrameTranslationDataTpl<Scalar>;
 
-  Model pin_model_;
+  using ModelHandle = shared_ptr<const Model>;
+
+  /// Model of the robot owning the frame, shared by the copies of the residual
+  /// and possibly by other functions.
+  ModelHandle pin_model_handle_;
   Vector3s p_ref_;
+  /// Name of the stage parameter slot to read the reference from, if not
+  /// empty.
+  std::string reference_parameter_;
 
   FrameTranslationResidualTpl(const int ndx, const int nu, const Model &model,
                               const Vector3s &frame_trans,
                               const pinocchio::FrameIndex frame_id);
 
+  /// Constructor sharing the model @p model with other functions.
+  FrameTranslationResidualTpl(const int ndx, const int nu, ModelHandle model,
+                              const Vector3s &frame_trans,
+                              const pinocchio::FrameIndex frame_id);
+
+  const Model &getModel() const { return *pin_model_handle_; }
+
   ALIGATOR_DEPRECATED const Vector3s &getReference() const { return p_ref_; }
   ALIGATOR_DEPRECATED void
   setReference(const Eigen::Ref<const Vector3s> &p_new) {
@@ -43,6 +59,11 @@ struct FrameTranslationResidualTpl : UnaryFunctionTpl<_Scalar>, frame_api {
   shared_ptr<BaseData> createData() const {
     return std::make_shared<Data>(*this);
   }
+
+  void registerParameters(StageParametersTpl<Scalar> &params) const {
+    if (!reference_parameter_.empty())
+      params.declareSlot(reference_parameter_, p_ref_);
+  }
 };
 
 template <typename Scalar>
@@ -51,8 +72,12 @@ struct FrameTranslationDataTpl : StageFunctionDataTpl<Scalar> {
   using Base = StageFunctionDataTpl<Scalar>;
   using PinData = pinocchio::DataTpl<Scalar>;
 
+  /// Kinematics cache, shared with the other multibody functions of the stage.
+  shared_ptr<KinematicsCacheTpl<Scalar>> kinematics_;
   /// Pinocchio data object.
-  PinData pin_data_;
+  PinData &pin_data_;
+  /// Reference, if read from the stage parameters.
+  StageParameterViewTpl<Scalar> reference_;
 
   /// Jacobian of the error, local frame
   typename math_types<Scalar>::Matrix6Xs fJf_;
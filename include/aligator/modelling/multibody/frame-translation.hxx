@@ -9,10 +9,19 @@ template <typename Scalar>
 FrameTranslationResidualTpl<Scalar>::FrameTranslationResidualTpl(
     const int ndx, const int nu, const Model &model,
     const Vector3s &frame_trans, const pinocchio::FrameIndex frame_id)
+    : FrameTranslationResidualTpl(ndx, nu, std::make_shared<const Model>(model),
+                                  frame_trans, frame_id) {}
+
+template <typename Scalar>
+FrameTranslationResidualTpl<Scalar>::FrameTranslationResidualTpl(
+    const int ndx, const int nu, ModelHandle model,
+    const Vector3s &frame_trans, const pinocchio::FrameIndex frame_id)
     : Base(ndx, nu, 3)
-    , pin_model_(model)
+    , pin_model_handle_(std::move(model))
     , p_ref_(frame_trans) {
   pin_frame_id_ = frame_id;
+  // depends on the configuration only
+  this->jac_pattern.x_size = getModel().nv;
 }
 
 template <typename Scalar>
@@ -20,30 +29,32 @@ void FrameTranslationResidualTpl<Scalar>::evaluate(const ConstVectorRef &x,
                                                    BaseData &data) const {
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
-  const ConstVectorRef q = x.head(pin_model_.nq);
-  pinocchio::forwardKinematics(pin_model_, pdata, q);
-  pinocchio::updateFramePlacement(pin_model_, pdata, pin_frame_id_);
+  d.kinematics_->updateFramePlacement(getModel(), x.head(getModel().nq),
+                                      pin_frame_id_);
 
-  d.value_ = pdata.oMf[pin_frame_id_].translation() - p_ref_;
+  d.value_ =
+      pdata.oMf[pin_frame_id_].translation() - d.reference_.valueOr(p_ref_);
 }
 
 template <typename Scalar>
 void FrameTranslationResidualTpl<Scalar>::computeJacobians(
-    const ConstVectorRef &, BaseData &data) const {
+    const ConstVectorRef &x, BaseData &data) const {
   Data &d = static_cast<Data &>(data);
   pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
-  pinocchio::computeJointJacobians(pin_model_, pdata);
-  pinocchio::getFrameJacobian(pin_model_, pdata, pin_frame_id_,
+  d.kinematics_->computeJointJacobians(getModel(), x.head(getModel().nq));
+  pinocchio::getFrameJacobian(getModel(), pdata, pin_frame_id_,
                               pinocchio::LOCAL_WORLD_ALIGNED, d.fJf_);
-  d.Jx_.leftCols(pin_model_.nv) = d.fJf_.template topRows<3>();
+  d.Jx_.leftCols(getModel().nv) = d.fJf_.template topRows<3>();
 }
 
 template <typename Scalar>
 FrameTranslationDataTpl<Scalar>::FrameTranslationDataTpl(
     const FrameTranslationResidualTpl<Scalar> &model)
     : Base(model.ndx1, model.nu, 3)
-    , pin_data_(model.pin_model_)
-    , fJf_(6, model.pin_model_.nv) {
+    , kinematics_(KinematicsCacheTpl<Scalar>::get(model.getModel()))
+    , pin_data_(kinematics_->data)
+    , reference_(model.reference_parameter_, 3)
+    , fJf_(6, model.getModel().nv) {
   fJf_.setZero();
 }
 
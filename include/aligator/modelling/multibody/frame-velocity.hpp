@@ -2,6 +2,7 @@
 
 #include "aligator/core/unary-function.hpp"
 #include "./fwd.hpp"
+#include "./kinematics-cache.hpp"
 
 #include <pinocchio/multibody/model.hpp>
 #include <pinocchio/multibody/data.hpp>
@@ -26,7 +27,11 @@ public:
   using Motion = pinocchio::MotionTpl<Scalar>;
   using Data = FrameVelocityDataTpl<Scalar>;
 
-  Model pin_model_;
+  using ModelHandle = shared_ptr<const Model>;
+
+  /// Model of the robot owning the frame, shared by the copies of the residual
+  /// and possibly by other functions.
+  ModelHandle pin_model_handle_;
   Motion vref_;
   pinocchio::ReferenceFrame type_;
 
@@ -35,6 +40,14 @@ public:
                            const pinocchio::FrameIndex id,
                            const pinocchio::ReferenceFrame type);
 
+  /// Constructor sharing the model @p model with other functions.
+  FrameVelocityResidualTpl(const int ndx, const int nu, ModelHandle model,
+                           const Motion &velocity,
+                           const pinocchio::FrameIndex id,
+                           const pinocchio::ReferenceFrame type);
+
+  const Model &getModel() const { return *pin_model_handle_; }
+
   ALIGATOR_DEPRECATED const Motion &getReference() const { return vref_; }
   ALIGATOR_DEPRECATED void setReference(const Motion &v_new) { vref_ = v_new; }
 
@@ -51,9 +64,12 @@ struct FrameVelocityDataTpl : StageFunctionDataTpl<Scalar> {
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   using Base = StageFunctionDataTpl<Scalar>;
   using Motion = pinocchio::MotionTpl<Scalar>;
+  using PinData = pinocchio::DataTpl<Scalar>;
 
+  /// Kinematics cache, shared with the other multibody functions of the stage.
+  shared_ptr<KinematicsCacheTpl<Scalar>> kinematics_;
   /// Pinocchio data object.
-  pinocchio::DataTpl<Scalar> pin_data_;
+  PinData &pin_data_;
 
   FrameVelocityDataTpl(const FrameVelocityResidualTpl<Scalar> &model);
 };
@@ -11,12 +11,19 @@ template <typename Scalar>
 FrameVelocityResidualTpl<Scalar>::FrameVelocityResidualTpl(
     const int ndx, const int nu, const Model &model, const Motion &velocity,
     const pinocchio::FrameIndex frame_id, const pinocchio::ReferenceFrame type)
+    : FrameVelocityResidualTpl(ndx, nu, std::make_shared<const Model>(model),
+                               velocity, frame_id, type) {}
+
+template <typename Scalar>
+FrameVelocityResidualTpl<Scalar>::FrameVelocityResidualTpl(
+    const int ndx, const int nu, ModelHandle model, const Motion &velocity,
+    const pinocchio::FrameIndex frame_id, const pinocchio::ReferenceFrame type)
     : Base(ndx, nu, 6)
-    , pin_model_(model)
+    , pin_model_handle_(std::move(model))
     , vref_(velocity)
     , type_(type) {
   pin_frame_id_ = frame_id;
-  if (ndx < model.nv * 2) {
+  if (ndx < getModel().nv * 2) {
     ALIGATOR_RUNTIME_ERROR("Specified manifold dimension is incompatible. It "
                            "needs to be at least 2 * nv.");
   }
@@ -26,11 +33,11 @@ template <typename Scalar>
 void FrameVelocityResidualTpl<Scalar>::evaluate(const ConstVectorRef &x,
                                                 BaseData &data) const {
   Data &d = static_cast<Data &>(data);
-  const ConstVectorRef q = x.head(pin_model_.nq);
-  const ConstVectorRef v = x.segment(pin_model_.nq, pin_model_.nv);
-  pinocchio::forwardKinematics(pin_model_, d.pin_data_, q, v);
-  pinocchio::updateFramePlacement(pin_model_, d.pin_data_, pin_frame_id_);
-  d.value_ = (pinocchio::getFrameVelocity(pin_model_, d.pin_data_,
+  const ConstVectorRef q = x.head(getModel().nq);
+  const ConstVectorRef v = x.segment(getModel().nq, getModel().nv);
+  d.kinematics_->forwardKinematics(getModel(), q, v);
+  d.kinematics_->updateFramePlacement(getModel(), q, pin_frame_id_);
+  d.value_ = (pinocchio::getFrameVelocity(getModel(), d.pin_data_,
                                           pin_frame_id_, type_) -
               vref_)
                  .toVector();
@@ -40,14 +47,12 @@ template <typename Scalar>
 void FrameVelocityResidualTpl<Scalar>::computeJacobians(const ConstVectorRef &x,
                                                         BaseData &data) const {
   Data &d = static_cast<Data &>(data);
-  const ConstVectorRef q = x.head(pin_model_.nq);
-  const ConstVectorRef v = x.segment(pin_model_.nq, pin_model_.nv);
-  VectorXs a = VectorXs::Zero(pin_model_.nv);
-  pinocchio::computeForwardKinematicsDerivatives(pin_model_, d.pin_data_, q, v,
-                                                 pinocchio::make_const_ref(a));
-  Eigen::Ref<Matrix6Xs> Jq = d.Jx_.leftCols(pin_model_.nv);
-  Eigen::Ref<Matrix6Xs> Jv = d.Jx_.rightCols(pin_model_.nv);
-  pinocchio::getFrameVelocityDerivatives(pin_model_, d.pin_data_, pin_frame_id_,
+  const ConstVectorRef q = x.head(getModel().nq);
+  const ConstVectorRef v = x.segment(getModel().nq, getModel().nv);
+  d.kinematics_->computeForwardKinematicsDerivatives(getModel(), q, v);
+  Eigen::Ref<Matrix6Xs> Jq = d.Jx_.leftCols(getModel().nv);
+  Eigen::Ref<Matrix6Xs> Jv = d.Jx_.rightCols(getModel().nv);
+  pinocchio::getFrameVelocityDerivatives(getModel(), d.pin_data_, pin_frame_id_,
                                          type_, Jq, Jv);
 }
 
@@ -55,6 +60,7 @@ template <typename Scalar>
 FrameVelocityDataTpl<Scalar>::FrameVelocityDataTpl(
     const FrameVelocityResidualTpl<Scalar> &model)
     : Base(model.ndx1, model.nu, 6)
-    , pin_data_(model.pin_model_) {}
+    , kinematics_(KinematicsCacheTpl<Scalar>::get(model.getModel()))
+    , pin_data_(kinematics_->data) {}
 
 } // namespace aligator
@@ -15,7 +15,10 @@ struct GravityCompensationResidualTpl : StageFunctionTpl<_Scalar> {
   using BaseData = StageFunctionDataTpl<Scalar>;
   using Model = pinocchio::ModelTpl<Scalar>;
 
-  Model pin_model_;
+  using ModelHandle = shared_ptr<const Model>;
+
+  /// Model used for the gravity torque, shared by the copies of the residual.
+  ModelHandle pin_model_handle_;
   MatrixXs actuation_matrix_;
   bool use_actuation_matrix;
 
@@ -24,6 +27,15 @@ struct GravityCompensationResidualTpl : StageFunctionTpl<_Scalar> {
                                  const Model &model);
   /// Full actuation constructor
   GravityCompensationResidualTpl(int ndx, const Model &model);
+  /// Constructor with an actuation matrix, sharing the model @p model with
+  /// other functions.
+  GravityCompensationResidualTpl(int ndx, const MatrixXs &actuation_matrix,
+                                 ModelHandle model);
+  /// Full actuation constructor sharing the model @p model with other
+  /// functions.
+  GravityCompensationResidualTpl(int ndx, ModelHandle model);
+
+  const Model &getModel() const { return *pin_model_handle_; }
 
   void evaluate(const ConstVectorRef &x, const ConstVectorRef &u,
                 BaseData &data) const;
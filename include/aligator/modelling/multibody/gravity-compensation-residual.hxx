@@ -7,16 +7,28 @@ namespace aligator {
 template <typename Scalar>
 GravityCompensationResidualTpl<Scalar>::GravityCompensationResidualTpl(
     int ndx, const MatrixXs &actuation_matrix, const Model &model)
-    : Base(ndx, (int)actuation_matrix.cols(), model.nv)
-    , pin_model_(model)
+    : GravityCompensationResidualTpl(ndx, actuation_matrix,
+                                     std::make_shared<const Model>(model)) {}
+
+template <typename Scalar>
+GravityCompensationResidualTpl<Scalar>::GravityCompensationResidualTpl(
+    int ndx, const Model &model)
+    : GravityCompensationResidualTpl(ndx,
+                                     std::make_shared<const Model>(model)) {}
+
+template <typename Scalar>
+GravityCompensationResidualTpl<Scalar>::GravityCompensationResidualTpl(
+    int ndx, const MatrixXs &actuation_matrix, ModelHandle model)
+    : Base(ndx, (int)actuation_matrix.cols(), model->nv)
+    , pin_model_handle_(std::move(model))
     , actuation_matrix_(actuation_matrix)
     , use_actuation_matrix(true) {}
 
 template <typename Scalar>
 GravityCompensationResidualTpl<Scalar>::GravityCompensationResidualTpl(
-    int ndx, const Model &model)
-    : Base(ndx, model.nv, model.nv)
-    , pin_model_(model)
+    int ndx, ModelHandle model)
+    : Base(ndx, model->nv, model->nv)
+    , pin_model_handle_(std::move(model))
     , actuation_matrix_()
     , use_actuation_matrix(false) {}
 
@@ -25,11 +37,11 @@ void GravityCompensationResidualTpl<Scalar>::evaluate(const ConstVectorRef &x,
                                                       const ConstVectorRef &u,
                                                       BaseData &data_) const {
   Data &data = static_cast<Data &>(data_);
-  const ConstVectorRef q = x.head(pin_model_.nq);
+  const ConstVectorRef q = x.head(getModel().nq);
   data.value_ =
-      -pinocchio::computeGeneralizedGravity(pin_model_, data.pin_data_, q);
+      -pinocchio::computeGeneralizedGravity(getModel(), data.pin_data_, q);
   if (use_actuation_matrix) {
-    data.value_ += actuation_matrix_ * u;
+    data.value_.noalias() += actuation_matrix_ * u;
   } else {
     data.value_ += u;
   }
@@ -40,25 +52,25 @@ void GravityCompensationResidualTpl<Scalar>::computeJacobians(
     const ConstVectorRef &x, const ConstVectorRef & /*u*/,
     BaseData &data_) const {
   Data &data = static_cast<Data &>(data_);
-  ConstVectorRef q = x.head(pin_model_.nq);
+  ConstVectorRef q = x.head(getModel().nq);
   pinocchio::computeGeneralizedGravityDerivatives(
-      pin_model_, data.pin_data_, q,
+      getModel(), data.pin_data_, q,
       pinocchio::make_ref(data.gravity_partial_dq_));
   if (use_actuation_matrix) {
     data_.Ju_ = actuation_matrix_;
   } else {
     data_.Ju_.setIdentity();
   }
-  data.Jx_.leftCols(pin_model_.nv) = -data.gravity_partial_dq_;
+  data.Jx_.leftCols(getModel().nv) = -data.gravity_partial_dq_;
 }
 
 template <typename Scalar>
 GravityCompensationResidualTpl<Scalar>::Data::Data(
     const GravityCompensationResidualTpl &resdl)
     : BaseData(resdl)
-    , pin_data_(resdl.pin_model_)
-    , tmp_torque_(resdl.pin_model_.nv)
-    , gravity_partial_dq_(resdl.pin_model_.nv, resdl.pin_model_.nv) {}
+    , pin_data_(resdl.getModel())
+    , tmp_torque_(resdl.getModel().nv)
+    , gravity_partial_dq_(resdl.getModel().nv, resdl.getModel().nv) {}
 
 template <typename Scalar>
 auto GravityCompensationResidualTpl<Scalar>::createData() const
@@ -0,0 +1,158 @@
+/// @file
+/// @brief Pinocchio kinematics shared by the multibody functions of a stage.
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/modelling/multibody/fwd.hpp"
+#include <pinocchio/multibody/model.hpp>
+#include <pinocchio/multibody/data.hpp>
+
+#include <algorithm>
+
+namespace aligator {
+
+/// @brief Pinocchio data with the kinematic quantities it holds tracked
+/// against the configuration and velocity they were computed at.
+///
+/// @details Multibody functions request quantities from the cache instead of
+/// calling the Pinocchio algorithms on their own data; an algorithm only runs
+/// if the quantities it computes are not available for the requested \f$(q,
+/// v)\f$. Function datas created inside the same SharedDataScope (i.e. the
+/// same StageDataTpl) whose functions hold the same Pinocchio model object
+/// (e.g. built from MultibodyPhaseSpace::getModelHandle()) get the same
+/// cache, so that forward kinematics, joint Jacobians, etc. run once per stage
+/// evaluation. Functions holding distinct copies of a model get distinct
+/// caches.
+/// The multibody dynamics models publish() the quantities their own algorithms
+/// computed (e.g. ABA derivatives compute the joint Jacobians), so that the
+/// costs and constraints of the stage, evaluated after the dynamics, reuse
+/// them.
+///
+/// Functions which use the cache must not call Pinocchio algorithms directly
+/// on @ref data, as the cache would not know about it.
+template <typename _Scalar> struct KinematicsCacheTpl {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  using Model = pinocchio::ModelTpl<Scalar>;
+  using PinData = pinocchio::DataTpl<Scalar>;
+
+  /// Quantities tracked by the cache.
+  enum Quantity : unsigned {
+    /// Joint placements `oMi`, `liMi`.
+    PLACEMENTS = 1 << 0,
+    /// Placements `oMf` of all frames. The frames updated one at a time
+    /// are tracked by isFrameComputed().
+    FRAME_PLACEMENTS = 1 << 1,
+    /// Joint spatial velocities `v`.
+    VELOCITIES = 1 << 2,
+    /// Joint Jacobians `J`.
+    JOINT_JACOBIANS = 1 << 3,
+    /// Kinematics derivatives `dVdq`, `dAdq`, ... at zero acceleration.
+    KINEMATICS_DERIVATIVES = 1 << 4,
+    /// Center of mass `com[0]`.
+    COM = 1 << 5,
+    /// Center of mass Jacobian `Jcom`.
+    COM_JACOBIAN = 1 << 6,
+    /// Centroidal momentum matrix `Ag` and centroidal momentum `hg`.
+    CENTROIDAL_MAP = 1 << 7,
+    /// Derivative @ref dh_dq of the centroidal momentum.
+    CENTROIDAL_DERIVATIVES = 1 << 8,
+  };
+
+  /// Pinocchio data object.
+  PinData data;
+  /// Derivative of the centroidal momentum \f$h_g = A_g(q)v\f$ with respect
+  /// to the configuration.
+  Matrix6Xs dh_dq;
+
+  explicit KinematicsCacheTpl(const Model &model);
+
+  /// @brief Get the cache shared by the functions of the stage whose data is
+  /// being created, or a new cache outside of a SharedDataScope.
+  static shared_ptr<KinematicsCacheTpl> get(const Model &model);
+
+  /// Joint placements at @p q.
+  void forwardKinematics(const Model &model, const ConstVectorRef &q);
+  /// Joint placements and velocities at @p (q, v).
+  void forwardKinematics(const Model &model, const ConstVectorRef &q,
+                         const ConstVectorRef &v);
+  /// Placements of all the frames at @p q.
+  void updateFramePlacements(const Model &model, const ConstVectorRef &q);
+  /// Placement of the frame @p frame_id only, at @p q.
+  void updateFramePlacement(const Model &model, const ConstVectorRef &q,
+                            const pinocchio::FrameIndex frame_id);
+  /// Joint placements and Jacobians at @p q.
+  void computeJointJacobians(const Model &model, const ConstVectorRef &q);
+  /// @brief Joint placements, velocities, Jacobians and kinematics derivatives
+  /// at @p (q, v) and zero acceleration.
+  void computeForwardKinematicsDerivatives(const Model &model,
+                                           const ConstVectorRef &q,
+                                           const ConstVectorRef &v);
+  /// Center of mass at @p q.
+  void centerOfMass(const Model &model, const ConstVectorRef &q);
+  /// Center of mass and its Jacobian at @p q.
+  void jacobianCenterOfMass(const Model &model, const ConstVectorRef &q);
+  /// Centroidal momentum matrix and momentum at @p (q, v).
+  void ccrba(const Model &model, const ConstVectorRef &q,
+             const ConstVectorRef &v);
+  /// @brief Joint placements and Jacobians, centroidal momentum matrix and
+  /// derivative of the centroidal momentum at @p (q, v).
+  void computeCentroidalMomentumDerivatives(const Model &model,
+                                            const ConstVectorRef &q,
+                                            const ConstVectorRef &v);
+
+  /// @brief Copy the quantities @p flags computed at @p (q, v) on another
+  /// Pinocchio data, e.g. by a dynamics model.
+  /// @details Quantities already available at @p (q, v) are not copied. The
+  /// kinematics derivatives cannot be published.
+  void publish(const PinData &src, const ConstVectorRef &q,
+               const ConstVectorRef &v, const unsigned flags);
+
+  /// @brief Copy the placement of the frame @p frame_id computed at @p q on
+  /// another Pinocchio data, e.g. a contact frame of a dynamics model.
+  void publishFramePlacement(const PinData &src, const ConstVectorRef &q,
+                             const pinocchio::FrameIndex frame_id);
+
+  /// @brief Copy the derivative @p dh_dq of the centroidal momentum computed
+  /// at @p (q, v), which does not live in the Pinocchio data.
+  void publishCentroidalMomentumDerivatives(const ConstMatrixRef &dh_dq,
+                                            const ConstVectorRef &q,
+                                            const ConstVectorRef &v);
+
+  /// Whether all the quantities in @p flags are up to date.
+  bool isComputed(const unsigned flags) const noexcept {
+    return (flags_ & flags) == flags;
+  }
+
+  /// Whether the placement of the frame @p frame_id is up to date.
+  bool isFrameComputed(const pinocchio::FrameIndex frame_id) const noexcept {
+    return isComputed(FRAME_PLACEMENTS) || frame_placements_[frame_id];
+  }
+
+  /// Forget all the computed quantities.
+  void invalidate() noexcept {
+    flags_ = 0;
+    std::fill(frame_placements_.begin(), frame_placements_.end(), false);
+  }
+
+private:
+  /// Invalidate every quantity if @p q differs from the cached configuration.
+  void setConfiguration(const ConstVectorRef &q);
+  /// Invalidate velocity-dependent quantities if @p v differs.
+  void setVelocity(const ConstVectorRef &v);
+
+  VectorXs q_;
+  VectorXs v_;
+  VectorXs a_zero_;
+  /// Derivatives of the centroidal momentum rate, which are not kept.
+  Matrix6Xs dhdot_dq_, dhdot_dv_, dhdot_da_;
+  /// Frames whose placement was updated on its own.
+  std::vector<bool> frame_placements_;
+  unsigned flags_ = 0;
+};
+
+#ifdef ALIGATOR_ENABLE_TEMPLATE_INSTANTIATION
+extern template struct KinematicsCacheTpl<context::Scalar>;
+#endif
+} // namespace aligator
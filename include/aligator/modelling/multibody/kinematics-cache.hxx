@@ -0,0 +1,232 @@
+/// @file
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/modelling/multibody/kinematics-cache.hpp"
+#include "aligator/core/shared-data-scope.hpp"
+
+#include <pinocchio/algorithm/kinematics.hpp>
+#include <pinocchio/algorithm/kinematics-derivatives.hpp>
+#include <pinocchio/algorithm/jacobian.hpp>
+#include <pinocchio/algorithm/frames.hpp>
+#include <pinocchio/algorithm/center-of-mass.hpp>
+#include <pinocchio/algorithm/centroidal.hpp>
+#include <pinocchio/algorithm/centroidal-derivatives.hpp>
+
+namespace aligator {
+
+template <typename Scalar>
+KinematicsCacheTpl<Scalar>::KinematicsCacheTpl(const Model &model)
+    : data(model)
+    , dh_dq(Matrix6Xs::Zero(6, model.nv))
+    , q_(VectorXs::Zero(model.nq))
+    , v_(VectorXs::Zero(model.nv))
+    , a_zero_(VectorXs::Zero(model.nv))
+    , dhdot_dq_(Matrix6Xs::Zero(6, model.nv))
+    , dhdot_dv_(Matrix6Xs::Zero(6, model.nv))
+    , dhdot_da_(Matrix6Xs::Zero(6, model.nv))
+    , frame_placements_(model.frames.size(), false) {}
+
+template <typename Scalar>
+auto KinematicsCacheTpl<Scalar>::get(const Model &model)
+    -> shared_ptr<KinematicsCacheTpl> {
+  auto make = [&model] { return std::make_shared<KinematicsCacheTpl>(model); };
+  SharedDataScope *scope = SharedDataScope::current();
+  if (scope == nullptr)
+    return make();
+  // functions share a cache iff they share the model object (copies of a
+  // function, or functions built from the same model handle); comparing
+  // models by value would be O(model size) per lookup
+  auto match = [&model](const void *key) { return key == &model; };
+  return scope->template getOrCreate<KinematicsCacheTpl>(&model, match, make);
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::setConfiguration(const ConstVectorRef &q) {
+  if (q_ != q) {
+    q_ = q;
+    invalidate();
+  }
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::setVelocity(const ConstVectorRef &v) {
+  if (v_ != v) {
+    v_ = v;
+    flags_ &= ~unsigned(VELOCITIES | KINEMATICS_DERIVATIVES | CENTROIDAL_MAP |
+                        CENTROIDAL_DERIVATIVES);
+  }
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::forwardKinematics(const Model &model,
+                                                   const ConstVectorRef &q) {
+  setConfiguration(q);
+  if (isComputed(PLACEMENTS))
+    return;
+  pinocchio::forwardKinematics(model, data, q);
+  flags_ |= PLACEMENTS;
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::forwardKinematics(const Model &model,
+                                                   const ConstVectorRef &q,
+                                                   const ConstVectorRef &v) {
+  setConfiguration(q);
+  setVelocity(v);
+  if (isComputed(PLACEMENTS | VELOCITIES))
+    return;
+  pinocchio::forwardKinematics(model, data, q, v);
+  flags_ |= PLACEMENTS | VELOCITIES;
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::updateFramePlacements(
+    const Model &model, const ConstVectorRef &q) {
+  forwardKinematics(model, q);
+  if (isComputed(FRAME_PLACEMENTS))
+    return;
+  pinocchio::updateFramePlacements(model, data);
+  flags_ |= FRAME_PLACEMENTS;
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::updateFramePlacement(
+    const Model &model, const ConstVectorRef &q,
+    const pinocchio::FrameIndex frame_id) {
+  forwardKinematics(model, q);
+  if (isFrameComputed(frame_id))
+    return;
+  pinocchio::updateFramePlacement(model, data, frame_id);
+  frame_placements_[frame_id] = true;
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::computeJointJacobians(
+    const Model &model, const ConstVectorRef &q) {
+  setConfiguration(q);
+  if (isComputed(JOINT_JACOBIANS))
+    return;
+  if (isComputed(PLACEMENTS)) {
+    pinocchio::computeJointJacobians(model, data);
+  } else {
+    pinocchio::computeJointJacobians(model, data, q);
+  }
+  flags_ |= PLACEMENTS | JOINT_JACOBIANS;
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::computeForwardKinematicsDerivatives(
+    const Model &model, const ConstVectorRef &q, const ConstVectorRef &v) {
+  setConfiguration(q);
+  setVelocity(v);
+  if (isComputed(KINEMATICS_DERIVATIVES))
+    return;
+  pinocchio::computeForwardKinematicsDerivatives(
+      model, data, q, v, pinocchio::make_const_ref(a_zero_));
+  flags_ |= PLACEMENTS | VELOCITIES | JOINT_JACOBIANS | KINEMATICS_DERIVATIVES;
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::centerOfMass(const Model &model,
+                                              const ConstVectorRef &q) {
+  forwardKinematics(model, q);
+  if (isComputed(COM))
+    return;
+  pinocchio::centerOfMass(model, data, pinocchio::POSITION);
+  flags_ |= COM;
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::jacobianCenterOfMass(const Model &model,
+                                                      const ConstVectorRef &q) {
+  forwardKinematics(model, q);
+  if (isComputed(COM_JACOBIAN))
+    return;
+  // also computes the center of mass
+  pinocchio::jacobianCenterOfMass(model, data);
+  flags_ |= COM | COM_JACOBIAN;
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::ccrba(const Model &model,
+                                       const ConstVectorRef &q,
+                                       const ConstVectorRef &v) {
+  setConfiguration(q);
+  setVelocity(v);
+  if (isComputed(CENTROIDAL_MAP))
+    return;
+  pinocchio::ccrba(model, data, q, v);
+  flags_ |= CENTROIDAL_MAP;
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::computeCentroidalMomentumDerivatives(
+    const Model &model, const ConstVectorRef &q, const ConstVectorRef &v) {
+  setConfiguration(q);
+  setVelocity(v);
+  if (isComputed(CENTROIDAL_DERIVATIVES))
+    return;
+  // dh_dq does not depend on the acceleration
+  pinocchio::computeCentroidalDynamicsDerivatives(
+      model, data, q, v, pinocchio::make_const_ref(a_zero_), dh_dq, dhdot_dq_,
+      dhdot_dv_, dhdot_da_);
+  flags_ |=
+      PLACEMENTS | JOINT_JACOBIANS | CENTROIDAL_MAP | CENTROIDAL_DERIVATIVES;
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::publish(const PinData &src,
+                                         const ConstVectorRef &q,
+                                         const ConstVectorRef &v,
+                                         const unsigned flags) {
+  setConfiguration(q);
+  setVelocity(v);
+  const unsigned missing = flags & ~(flags_ | KINEMATICS_DERIVATIVES);
+  if (missing & PLACEMENTS) {
+    data.liMi = src.liMi;
+    data.oMi = src.oMi;
+  }
+  if (missing & FRAME_PLACEMENTS)
+    data.oMf = src.oMf;
+  if (missing & VELOCITIES)
+    data.v = src.v;
+  if (missing & JOINT_JACOBIANS)
+    data.J = src.J;
+  if (missing & COM) {
+    data.com = src.com;
+    data.mass = src.mass;
+  }
+  if (missing & COM_JACOBIAN)
+    data.Jcom = src.Jcom;
+  if (missing & CENTROIDAL_MAP) {
+    data.Ag = src.Ag;
+    data.hg = src.hg;
+  }
+  flags_ |= missing;
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::publishFramePlacement(
+    const PinData &src, const ConstVectorRef &q,
+    const pinocchio::FrameIndex frame_id) {
+  setConfiguration(q);
+  if (isFrameComputed(frame_id))
+    return;
+  data.oMf[frame_id] = src.oMf[frame_id];
+  frame_placements_[frame_id] = true;
+}
+
+template <typename Scalar>
+void KinematicsCacheTpl<Scalar>::publishCentroidalMomentumDerivatives(
+    const ConstMatrixRef &dh_dq, const ConstVectorRef &q,
+    const ConstVectorRef &v) {
+  setConfiguration(q);
+  setVelocity(v);
+  if (isComputed(CENTROIDAL_DERIVATIVES))
+    return;
+  this->dh_dq = dh_dq;
+  flags_ |= CENTROIDAL_DERIVATIVES;
+}
+
+} // namespace aligator
@@ -0,0 +1,132 @@
+/// @file
+/// @brief Distances of several collision pairs, with broadphase culling.
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/core/unary-function.hpp"
+#include "./fwd.hpp"
+#include "./kinematics-cache.hpp"
+
+#include <pinocchio/multibody/geometry.hpp>
+#include <pinocchio/multibody/model.hpp>
+
+#include <limits>
+
+namespace aligator {
+
+template <typename Scalar> struct MultiFrameCollisionDataTpl;
+
+/**
+ * @brief Distances between the geometries of several collision pairs, one
+ * per row.
+ *
+ * @details The placements of the geometries of the pairs are updated once per
+ * evaluation. A pair is first tested with the world-aligned bounding boxes of
+ * its geometries: when the distance between the boxes exceeds
+ * @ref broadphase_distance_, the narrowphase is skipped and the row holds the
+ * distance between the boxes, a lower bound of the distance between the
+ * geometries, with a zero Jacobian. Set @ref broadphase_distance_ above the
+ * smallest distance allowed by the constraint so that the culled rows stay
+ * inactive. The narrowphase (GJK/EPA) of each pair starts from the separating
+ * direction of its previous evaluation.
+ *
+ * Unlike FrameCollisionResidualTpl, the geometries are placed relative to
+ * their parent joint, and the Jacobian rows are computed from the joint
+ * Jacobians of the kinematics cache without copying them.
+ */
+template <typename _Scalar>
+struct MultiFrameCollisionResidualTpl : UnaryFunctionTpl<_Scalar> {
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  using Scalar = _Scalar;
+  ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
+  ALIGATOR_UNARY_FUNCTION_INTERFACE(Scalar);
+  using BaseData = typename Base::Data;
+  using Model = pinocchio::ModelTpl<Scalar>;
+  using Data = MultiFrameCollisionDataTpl<Scalar>;
+  using GeometryModel = pinocchio::GeometryModel;
+
+  using ModelHandle = shared_ptr<const Model>;
+
+  /// Model of the robot carrying the collision geometries, shared by the
+  /// copies of the residual.
+  ModelHandle pin_model_handle_;
+  GeometryModel geom_model_;
+
+  /// @brief Constructor.
+  /// @param pair_ids Indices of the collision pairs of @p geom_model, all the
+  /// pairs if empty.
+  /// @param broadphase_distance See @ref broadphase_distance_ (no culling by
+  /// default).
+  MultiFrameCollisionResidualTpl(
+      const int ndx, const int nu, const Model &model,
+      const GeometryModel &geom_model,
+      const std::vector<pinocchio::PairIndex> &pair_ids = {},
+      const Scalar broadphase_distance =
+          std::numeric_limits<Scalar>::infinity());
+
+  /// Constructor sharing the model @p model with other functions.
+  MultiFrameCollisionResidualTpl(
+      const int ndx, const int nu, ModelHandle model,
+      const GeometryModel &geom_model,
+      const std::vector<pinocchio::PairIndex> &pair_ids = {},
+      const Scalar broadphase_distance =
+          std::numeric_limits<Scalar>::infinity());
+
+  const Model &getModel() const { return *pin_model_handle_; }
+
+  void evaluate(const ConstVectorRef &x, BaseData &data) const;
+
+  void computeJacobians(const ConstVectorRef &x, BaseData &data) const;
+
+  shared_ptr<BaseData> createData() const {
+    return std::make_shared<Data>(*this);
+  }
+
+  int numPairs() const { return int(pair_ids_.size()); }
+  int numGeometries() const { return int(geom_ids_.size()); }
+
+  /// Indices of the collision pairs in @ref geom_model_.
+  std::vector<pinocchio::PairIndex> pair_ids_;
+  /// Distance between the bounding boxes of a pair above which its
+  /// narrowphase is skipped.
+  Scalar broadphase_distance_;
+
+protected:
+  /// Indices of the geometries involved in the pairs.
+  std::vector<pinocchio::GeomIndex> geom_ids_;
+  /// Positions of the geometries of each pair in @ref geom_ids_.
+  std::vector<std::size_t> first_, second_;
+  /// Centers and half extents of the local bounding boxes of the geometries.
+  Matrix3Xs aabb_centers_;
+  Matrix3Xs aabb_half_extents_;
+};
+
+template <typename Scalar>
+struct MultiFrameCollisionDataTpl : StageFunctionDataTpl<Scalar> {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  using Base = StageFunctionDataTpl<Scalar>;
+  using typename Base::Matrix3Xs;
+  using PinData = pinocchio::DataTpl<Scalar>;
+
+  /// Kinematics cache, shared with the other multibody functions of the stage.
+  shared_ptr<KinematicsCacheTpl<Scalar>> kinematics_;
+  /// Pinocchio data object.
+  PinData &pin_data_;
+  pinocchio::GeometryData geom_data;
+  /// Centers and half extents of the world-aligned bounding boxes of the
+  /// geometries.
+  Matrix3Xs aabb_centers_;
+  Matrix3Xs aabb_half_extents_;
+  /// Whether the narrowphase was run for each pair at the last evaluation.
+  std::vector<bool> active_pairs_;
+
+  MultiFrameCollisionDataTpl(
+      const MultiFrameCollisionResidualTpl<Scalar> &model);
+};
+
+#ifdef ALIGATOR_ENABLE_TEMPLATE_INSTANTIATION
+extern template struct MultiFrameCollisionResidualTpl<context::Scalar>;
+extern template struct MultiFrameCollisionDataTpl<context::Scalar>;
+#endif
+} // namespace aligator
@@ -0,0 +1,188 @@
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include "aligator/modelling/multibody/multi-frame-collision.hpp"
+#include <pinocchio/collision/distance.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace aligator {
+
+template <typename Scalar>
+MultiFrameCollisionResidualTpl<Scalar>::MultiFrameCollisionResidualTpl(
+    const int ndx, const int nu, const Model &model,
+    const GeometryModel &geom_model,
+    const std::vector<pinocchio::PairIndex> &pair_ids,
+    const Scalar broadphase_distance)
+    : MultiFrameCollisionResidualTpl(ndx, nu,
+                                     std::make_shared<const Model>(model),
+                                     geom_model, pair_ids,
+                                     broadphase_distance) {}
+
+template <typename Scalar>
+MultiFrameCollisionResidualTpl<Scalar>::MultiFrameCollisionResidualTpl(
+    const int ndx, const int nu, ModelHandle model,
+    const GeometryModel &geom_model,
+    const std::vector<pinocchio::PairIndex> &pair_ids,
+    const Scalar broadphase_distance)
+    : Base(ndx, nu,
+           pair_ids.empty() ? int(geom_model.collisionPairs.size())
+                            : int(pair_ids.size()))
+    , pin_model_handle_(std::move(model))
+    , geom_model_(geom_model)
+    , pair_ids_(pair_ids)
+    , broadphase_distance_(broadphase_distance) {
+  if (pair_ids_.empty()) {
+    for (pinocchio::PairIndex k = 0; k < geom_model_.collisionPairs.size(); k++)
+      pair_ids_.push_back(k);
+  }
+  if (pair_ids_.empty()) {
+    ALIGATOR_DOMAIN_ERROR("The geometry model has no collision pairs.");
+  }
+
+  const auto index_of = [this](const pinocchio::GeomIndex geom_id) {
+    const auto it = std::find(geom_ids_.begin(), geom_ids_.end(), geom_id);
+    if (it != geom_ids_.end())
+      return std::size_t(it - geom_ids_.begin());
+    geom_ids_.push_back(geom_id);
+    return geom_ids_.size() - 1;
+  };
+  for (const pinocchio::PairIndex pair_id : pair_ids_) {
+    if (pair_id >= geom_model_.collisionPairs.size()) {
+      ALIGATOR_OUT_OF_RANGE_ERROR(
+          "Provided collision pair index {:d} is not valid "
+          "(geom model has {:d} pairs).",
+          pair_id, geom_model_.collisionPairs.size());
+    }
+    const auto &pair = geom_model_.collisionPairs[pair_id];
+    first_.push_back(index_of(pair.first));
+    second_.push_back(index_of(pair.second));
+  }
+
+  aabb_centers_.resize(3, numGeometries());
+  aabb_half_extents_.resize(3, numGeometries());
+  for (std::size_t i = 0; i < geom_ids_.size(); i++) {
+    // The geometries are shared with the caller's model: the local box is
+    // computed on a copy, and only its bounds are kept.
+    const std::unique_ptr<coal::CollisionGeometry> geometry(
+        geom_model_.geometryObjects[geom_ids_[i]].geometry->clone());
+    geometry->computeLocalAABB();
+    const auto &aabb = geometry->aabb_local;
+    aabb_centers_.col(Eigen::Index(i)) = Scalar(0.5) * (aabb.min_ + aabb.max_);
+    aabb_half_extents_.col(Eigen::Index(i)) =
+        Scalar(0.5) * (aabb.max_ - aabb.min_);
+    if (!aabb_centers_.col(Eigen::Index(i)).allFinite() ||
+        !aabb_half_extents_.col(Eigen::Index(i)).allFinite()) {
+      // unbounded geometries (e.g. half-spaces) are never culled
+      aabb_centers_.col(Eigen::Index(i)).setZero();
+      aabb_half_extents_.col(Eigen::Index(i))
+          .setConstant(std::numeric_limits<Scalar>::max() / 8);
+    }
+  }
+}
+
+template <typename Scalar>
+void MultiFrameCollisionResidualTpl<Scalar>::evaluate(const ConstVectorRef &x,
+                                                      BaseData &data) const {
+  Data &d = static_cast<Data &>(data);
+  const pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
+  d.kinematics_->forwardKinematics(getModel(), x.head(getModel().nq));
+
+  // place the geometries of the pairs and their bounding boxes
+  for (std::size_t i = 0; i < geom_ids_.size(); i++) {
+    const Eigen::Index col = Eigen::Index(i);
+    const auto &geom_object = geom_model_.geometryObjects[geom_ids_[i]];
+    auto &oMg = d.geom_data.oMg[geom_ids_[i]];
+    oMg = pdata.oMi[geom_object.parentJoint] * geom_object.placement;
+    d.aabb_centers_.col(col).noalias() =
+        oMg.rotation() * aabb_centers_.col(col);
+    d.aabb_centers_.col(col) += oMg.translation();
+    d.aabb_half_extents_.col(col).noalias() =
+        oMg.rotation().cwiseAbs() * aabb_half_extents_.col(col);
+  }
+
+  for (std::size_t k = 0; k < pair_ids_.size(); k++) {
+    const Eigen::Index i1 = Eigen::Index(first_[k]);
+    const Eigen::Index i2 = Eigen::Index(second_[k]);
+    const Scalar bound =
+        ((d.aabb_centers_.col(i1) - d.aabb_centers_.col(i2)).cwiseAbs() -
+         d.aabb_half_extents_.col(i1) - d.aabb_half_extents_.col(i2))
+            .cwiseMax(Scalar(0))
+            .norm();
+    d.active_pairs_[k] = bound <= broadphase_distance_;
+    if (!d.active_pairs_[k]) {
+      d.value_[Eigen::Index(k)] = bound;
+      continue;
+    }
+
+    const pinocchio::PairIndex pair_id = pair_ids_[k];
+    pinocchio::computeDistance(geom_model_, d.geom_data, pair_id);
+    const auto &result = d.geom_data.distanceResults[pair_id];
+    // warm-start the next GJK run from this one
+    d.geom_data.distanceRequests[pair_id].updateGuess(result);
+    d.value_[Eigen::Index(k)] = result.min_distance;
+  }
+}
+
+template <typename Scalar>
+void MultiFrameCollisionResidualTpl<Scalar>::computeJacobians(
+    const ConstVectorRef &x, BaseData &data) const {
+  Data &d = static_cast<Data &>(data);
+  const pinocchio::DataTpl<Scalar> &pdata = d.pin_data_;
+  d.kinematics_->computeJointJacobians(getModel(), x.head(getModel().nq));
+
+  // The point p of a body whose spatial velocity (in WORLD) is (v, w) moves at
+  // v + w x p, so that the derivative of n^T p is n^T v + (p x n)^T w along
+  // the columns of the joint Jacobian of the body.
+  const auto add_point_jacobian = [&](const Eigen::Index row,
+                                      const pinocchio::GeomIndex geom_id,
+                                      const Vector3s &p, const Vector3s &n,
+                                      const Scalar sign) {
+    const pinocchio::JointIndex joint_id =
+        geom_model_.geometryObjects[geom_id].parentJoint;
+    if (joint_id == 0)
+      return;
+    const Vector3s pxn = p.cross(n);
+    const auto &jmodel = getModel().joints[joint_id];
+    for (int j = jmodel.idx_v() + jmodel.nv() - 1; j >= 0;
+         j = getModel().parents_fromRow[std::size_t(j)]) {
+      const auto Jcol = pdata.J.col(j);
+      d.Jx_(row, j) += sign * (n.dot(Jcol.template head<3>()) +
+                               pxn.dot(Jcol.template tail<3>()));
+    }
+  };
+
+  d.Jx_.setZero();
+  for (std::size_t k = 0; k < pair_ids_.size(); k++) {
+    if (!d.active_pairs_[k])
+      continue;
+    const auto &pair = geom_model_.collisionPairs[pair_ids_[k]];
+    const auto &result = d.geom_data.distanceResults[pair_ids_[k]];
+    const Vector3s n = result.normal;
+    add_point_jacobian(Eigen::Index(k), pair.second, result.nearest_points[1],
+                       n, Scalar(1));
+    add_point_jacobian(Eigen::Index(k), pair.first, result.nearest_points[0],
+                       n, Scalar(-1));
+  }
+}
+
+template <typename Scalar>
+MultiFrameCollisionDataTpl<Scalar>::MultiFrameCollisionDataTpl(
+    const MultiFrameCollisionResidualTpl<Scalar> &model)
+    : Base(model.ndx1, model.nu, model.numPairs())
+    , kinematics_(KinematicsCacheTpl<Scalar>::get(model.getModel()))
+    , pin_data_(kinematics_->data)
+    , geom_data(model.geom_model_)
+    , aabb_centers_(3, model.numGeometries())
+    , aabb_half_extents_(3, model.numGeometries())
+    , active_pairs_(model.pair_ids_.size(), true) {
+  aabb_centers_.setZero();
+  aabb_half_extents_.setZero();
+  for (const pinocchio::PairIndex pair_id : model.pair_ids_) {
+    geom_data.distanceRequests[pair_id].gjk_initial_guess =
+        coal::GJKInitialGuess::CachedGuess;
+  }
+}
+
+} // namespace aligator
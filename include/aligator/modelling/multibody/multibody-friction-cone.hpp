@@ -35,7 +35,10 @@ public:
       PINOCCHIO_ALIGNED_STD_VECTOR(RigidConstraintData);
   using ProxSettings = pinocchio::ProximalSettings;
 
-  PinModel pin_model_;
+  using ModelHandle = shared_ptr<const PinModel>;
+
+  /// Model of the robot in contact, shared by the copies of the residual.
+  ModelHandle pin_model_handle_;
   MatrixXs actuation_matrix_;
   RigidConstraintModelVector constraint_models_;
   ProxSettings prox_settings_;
@@ -47,16 +50,26 @@ public:
       const RigidConstraintModelVector &constraint_models,
       const ProxSettings &prox_settings, std::string_view contact_name,
       const double mu)
+      : MultibodyFrictionConeResidualTpl(
+            ndx, std::make_shared<const PinModel>(model), actuation,
+            constraint_models, prox_settings, contact_name, mu) {}
+
+  /// Constructor sharing the model @p model with other functions.
+  MultibodyFrictionConeResidualTpl(
+      const int ndx, ModelHandle model, const MatrixXs &actuation,
+      const RigidConstraintModelVector &constraint_models,
+      const ProxSettings &prox_settings, std::string_view contact_name,
+      const double mu)
       : Base(ndx, (int)actuation.cols(), 2)
-      , pin_model_(model)
+      , pin_model_handle_(std::move(model))
       , actuation_matrix_(actuation)
       , constraint_models_(constraint_models)
       , prox_settings_(prox_settings)
       , mu_(mu) {
-    if (model.nv != actuation.rows()) {
+    if (getModel().nv != actuation.rows()) {
       ALIGATOR_DOMAIN_ERROR("Actuation matrix should have number of rows = "
                             "model.nv ({:d} and {:d}).",
-                            actuation.rows(), model.nv);
+                            actuation.rows(), getModel().nv);
     }
     contact_id_ = -1;
     for (std::size_t i = 0; i < constraint_models.size(); i++) {
@@ -70,6 +83,8 @@ public:
     }
   }
 
+  const PinModel &getModel() const { return *pin_model_handle_; }
+
   void evaluate(const ConstVectorRef &x, const ConstVectorRef &u,
                 BaseData &data) const;
 
@@ -13,12 +13,12 @@ void MultibodyFrictionConeResidualTpl<Scalar>::evaluate(const ConstVectorRef &x,
                                                         BaseData &data) const {
   Data &d = static_cast<Data &>(data);
 
-  const ConstVectorRef q = x.head(pin_model_.nq);
-  const ConstVectorRef v = x.tail(pin_model_.nv);
+  const ConstVectorRef q = x.head(getModel().nq);
+  const ConstVectorRef v = x.tail(getModel().nv);
 
   d.tau_.noalias() = actuation_matrix_ * u;
   pinocchio::constraintDynamics(
-      pin_model_, d.pin_data_, q, v, pinocchio::make_const_ref(d.tau_),
+      getModel(), d.pin_data_, q, v, pinocchio::make_const_ref(d.tau_),
       constraint_models_, d.constraint_datas_, d.settings);
 
   // Unilateral contact
@@ -34,11 +34,11 @@ void MultibodyFrictionConeResidualTpl<Scalar>::computeJacobians(
   Data &d = static_cast<Data &>(data);
 
   pinocchio::computeConstraintDynamicsDerivatives(
-      pin_model_, d.pin_data_, constraint_models_, d.constraint_datas_,
+      getModel(), d.pin_data_, constraint_models_, d.constraint_datas_,
       d.settings);
 
   d.temp_.noalias() =
-      d.pin_data_.dlambda_dtau.block(contact_id_ * 3, 0, 3, pin_model_.nv) *
+      d.pin_data_.dlambda_dtau.block(contact_id_ * 3, 0, 3, getModel().nv) *
       actuation_matrix_;
   d.dcone_df_ << d.pin_data_.lambda_c[contact_id_ * 3] /
                      sqrt(pow(d.pin_data_.lambda_c[contact_id_ * 3], 2) +
@@ -48,19 +48,19 @@ void MultibodyFrictionConeResidualTpl<Scalar>::computeJacobians(
                pow(d.pin_data_.lambda_c[contact_id_ * 3 + 1], 2)),
       -mu_;
 
-  d.Jx_.block(0, 0, 1, pin_model_.nv).noalias() =
-      -d.pin_data_.dlambda_dq.block(contact_id_ * 3 + 2, 0, 1, pin_model_.nv);
-  d.Jx_.block(0, pin_model_.nv, 1, pin_model_.nv).noalias() =
-      -d.pin_data_.dlambda_dv.block(contact_id_ * 3 + 2, 0, 1, pin_model_.nv);
+  d.Jx_.block(0, 0, 1, getModel().nv).noalias() =
+      -d.pin_data_.dlambda_dq.block(contact_id_ * 3 + 2, 0, 1, getModel().nv);
+  d.Jx_.block(0, getModel().nv, 1, getModel().nv).noalias() =
+      -d.pin_data_.dlambda_dv.block(contact_id_ * 3 + 2, 0, 1, getModel().nv);
   d.Ju_.block(0, 0, 1, actuation_matrix_.cols()).noalias() =
       -d.temp_.block(2, 0, 1, actuation_matrix_.cols());
 
-  d.Jx_.block(1, 0, 1, pin_model_.nv).noalias() =
+  d.Jx_.block(1, 0, 1, getModel().nv).noalias() =
       d.dcone_df_ *
-      d.pin_data_.dlambda_dq.block(contact_id_ * 3, 0, 3, pin_model_.nv);
-  d.Jx_.block(1, pin_model_.nv, 1, pin_model_.nv).noalias() =
+      d.pin_data_.dlambda_dq.block(contact_id_ * 3, 0, 3, getModel().nv);
+  d.Jx_.block(1, getModel().nv, 1, getModel().nv).noalias() =
       d.dcone_df_ *
-      d.pin_data_.dlambda_dv.block(contact_id_ * 3, 0, 3, pin_model_.nv);
+      d.pin_data_.dlambda_dv.block(contact_id_ * 3, 0, 3, getModel().nv);
   d.Ju_.block(1, 0, 1, actuation_matrix_.cols()).noalias() =
       d.dcone_df_ * d.temp_;
 }
@@ -69,8 +69,8 @@ template <typename Scalar>
 MultibodyFrictionConeDataTpl<Scalar>::MultibodyFrictionConeDataTpl(
     const MultibodyFrictionConeResidualTpl<Scalar> *model)
     : Base(model->ndx1, model->nu, 2)
-    , pin_data_(model->pin_model_)
-    , tau_(model->pin_model_.nv)
+    , pin_data_(model->getModel())
+    , tau_(model->getModel().nv)
     , temp_(3, model->nu) {
   tau_.setZero();
   temp_.setZero();
@@ -82,11 +82,11 @@ MultibodyFrictionConeDataTpl<Scalar>::MultibodyFrictionConeDataTpl(
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #ifdef ALIGATOR_PINOCCHIO_V4
-  pinocchio::initConstraintDynamics(model->pin_model_, pin_data_,
+  pinocchio::initConstraintDynamics(model->getModel(), pin_data_,
                                     model->constraint_models_,
                                     constraint_datas_);
 #else
-  pinocchio::initConstraintDynamics(model->pin_model_, pin_data_,
+  pinocchio::initConstraintDynamics(model->getModel(), pin_data_,
                                     model->constraint_models_);
 #endif
 #pragma GCC diagnostic pop
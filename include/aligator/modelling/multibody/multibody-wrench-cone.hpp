@@ -35,7 +35,10 @@ public:
       PINOCCHIO_ALIGNED_STD_VECTOR(RigidConstraintData);
   using ProxSettings = pinocchio::ProximalSettingsTpl<Scalar>;
 
-  Model pin_model_;
+  using ModelHandle = shared_ptr<const Model>;
+
+  /// Model of the robot in contact, shared by the copies of the residual.
+  ModelHandle pin_model_handle_;
   MatrixXs actuation_matrix_;
   RigidConstraintModelVector constraint_models_;
   ProxSettings prox_settings_;
@@ -51,18 +54,29 @@ public:
       const RigidConstraintModelVector &constraint_models,
       const ProxSettings &prox_settings, std::string_view contact_name,
       const double mu, const double half_length, const double half_width)
+      : MultibodyWrenchConeResidualTpl(
+            ndx, std::make_shared<const Model>(model), actuation,
+            constraint_models, prox_settings, contact_name, mu, half_length,
+            half_width) {}
+
+  /// Constructor sharing the model @p model with other functions.
+  MultibodyWrenchConeResidualTpl(
+      const int ndx, ModelHandle model, const MatrixXs &actuation,
+      const RigidConstraintModelVector &constraint_models,
+      const ProxSettings &prox_settings, std::string_view contact_name,
+      const double mu, const double half_length, const double half_width)
       : Base(ndx, (int)actuation.cols(), 17)
-      , pin_model_(model)
+      , pin_model_handle_(std::move(model))
       , actuation_matrix_(actuation)
       , constraint_models_(constraint_models)
       , prox_settings_(prox_settings)
       , mu_(mu)
       , hL_(half_length)
       , hW_(half_width) {
-    if (model.nv != actuation.rows()) {
+    if (getModel().nv != actuation.rows()) {
       ALIGATOR_DOMAIN_ERROR("Actuation matrix should have number of rows = "
                             "model.nv ({:d} and {:d}).",
-                            actuation.rows(), model.nv);
+                            actuation.rows(), getModel().nv);
     }
     contact_id_ = -1;
     for (std::size_t i = 0; i < constraint_models.size(); i++) {
@@ -85,6 +99,8 @@ public:
         -mu_, 1;
   }
 
+  const Model &getModel() const { return *pin_model_handle_; }
+
   void evaluate(const ConstVectorRef &x, const ConstVectorRef &u,
                 BaseData &data) const;
 
@@ -29,8 +29,7 @@ public:
             std::is_same_v<Concrete, xyz::polymorphic<Base>>,
         "Input type should either be derived from ManifoldAbstractTpl or be "
         "polymorphic<ManifoldAbstractTpl>.");
-    this->nx_ += _get_nx(c);
-    this->ndx_ += _get_ndx(c);
+    this->_add_dims(_get_nx(c), _get_ndx(c), _get_non_euclidean_dim(c));
     m_components.emplace_back(c);
   }
 
@@ -40,8 +39,7 @@ public:
             std::is_same_v<Concrete, xyz::polymorphic<Base>>,
         "Input type should either be derived from ManifoldAbstractTpl or be "
         "polymorphic<ManifoldAbstractTpl>.");
-    this->nx_ += _get_nx(c);
-    this->ndx_ += _get_ndx(c);
+    this->_add_dims(_get_nx(c), _get_ndx(c), _get_non_euclidean_dim(c));
     m_components.emplace_back(std::move(c));
   }
 
@@ -53,7 +51,9 @@ public:
 
   explicit CartesianProductTpl()
       : Base(0, 0)
-      , m_components() {}
+      , m_components() {
+    this->non_euclidean_dim_ = 0;
+  }
   CartesianProductTpl(const CartesianProductTpl &) = default;
   CartesianProductTpl &operator=(const CartesianProductTpl &) = default;
   CartesianProductTpl(CartesianProductTpl &&) = default;
@@ -79,8 +79,10 @@ public:
 
   CartesianProductTpl(const xyz::polymorphic<Base> &left,
                       const xyz::polymorphic<Base> &right)
-      : Base(left->nx() + right->nx(), left->ndx() + right->ndx())
-      , m_components{left, right} {}
+      : Base(0, 0)
+      , m_components{left, right} {
+    this->_calc_dims();
+  }
 
   bool isNormalized(const ConstVectorRef &x) const;
 
@@ -118,12 +120,22 @@ protected:
   void _calc_dims() {
     this->nx_ = 0u;
     this->ndx_ = 0u;
+    this->non_euclidean_dim_ = 0;
     for (const auto &c : m_components) {
-      this->nx_ += c->nx();
-      this->ndx_ += c->ndx();
+      this->_add_dims(c->nx(), c->ndx(), c->nonEuclideanDim());
     }
   }
 
+  /// Append the dimensions of a component. The tangent coordinates of the
+  /// product are non-Euclidean up to the end of the non-Euclidean block of
+  /// its last non-Euclidean component.
+  void _add_dims(int nx, int ndx, int non_euclidean_dim) {
+    if (non_euclidean_dim > 0)
+      this->non_euclidean_dim_ = this->ndx_ + non_euclidean_dim;
+    this->nx_ += nx;
+    this->ndx_ += ndx;
+  }
+
   template <class Concrete> static int _get_nx(const Concrete &c) {
     return c.nx();
   }
@@ -132,6 +144,13 @@ protected:
   }
   static int _get_nx(const xyz::polymorphic<Base> &c) { return c->nx(); }
   static int _get_ndx(const xyz::polymorphic<Base> &c) { return c->ndx(); }
+  template <class Concrete>
+  static int _get_non_euclidean_dim(const Concrete &c) {
+    return c.nonEuclideanDim();
+  }
+  static int _get_non_euclidean_dim(const xyz::polymorphic<Base> &c) {
+    return c->nonEuclideanDim();
+  }
 
   void neutral_impl(VectorRef out) const;
 
@@ -152,6 +171,12 @@ protected:
 
   void Jdifference_impl(const ConstVectorRef &x0, const ConstVectorRef &x1,
                         MatrixRef Jout, int arg) const;
+
+  void integrateBatch_impl(const ConstMatrixRef &xs, const ConstMatrixRef &vs,
+                           const Scalar alpha, MatrixRef out) const;
+
+  void differenceBatch_impl(const ConstMatrixRef &x0s,
+                            const ConstMatrixRef &x1s, MatrixRef out) const;
 };
 
 template <typename T>
@@ -197,4 +197,37 @@ void CartesianProductTpl<Scalar>::Jdifference_impl(const ConstVectorRef &x0,
   }
 }
 
+template <typename Scalar>
+void CartesianProductTpl<Scalar>::integrateBatch_impl(const ConstMatrixRef &xs,
+                                                      const ConstMatrixRef &vs,
+                                                      const Scalar alpha,
+                                                      MatrixRef out) const {
+  // the knots of each component are the rows of its block
+  Eigen::Index cq = 0, cv = 0;
+  for (std::size_t i = 0; i < numComponents(); i++) {
+    const long nq = getComponent(i).nx();
+    const long nv = getComponent(i).ndx();
+    getComponent(i).integrateBatch(xs.middleRows(cq, nq),
+                                   vs.middleRows(cv, nv), alpha,
+                                   out.middleRows(cq, nq));
+    cq += nq;
+    cv += nv;
+  }
+}
+
+template <typename Scalar>
+void CartesianProductTpl<Scalar>::differenceBatch_impl(
+    const ConstMatrixRef &x0s, const ConstMatrixRef &x1s, MatrixRef out) const {
+  Eigen::Index cq = 0, cv = 0;
+  for (std::size_t i = 0; i < numComponents(); i++) {
+    const long nq = getComponent(i).nx();
+    const long nv = getComponent(i).ndx();
+    getComponent(i).differenceBatch(x0s.middleRows(cq, nq),
+                                    x1s.middleRows(cq, nq),
+                                    out.middleRows(cv, nv));
+    cq += nq;
+    cv += nv;
+  }
+}
+
 } // namespace aligator
@@ -20,43 +20,59 @@ public:
   ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
   using Self = MultibodyConfiguration<Scalar>;
   using ModelType = pinocchio::ModelTpl<Scalar>;
+  /// Shared, immutable handle to the Pinocchio model.
+  using ModelHandle = shared_ptr<const ModelType>;
   using Base = ManifoldAbstractTpl<Scalar>;
   using Base::ndx;
   using Base::nx;
 
   MultibodyConfiguration(const ModelType &model)
-      : Base(model.nq, model.nv)
-      , model_(model) {};
+      : MultibodyConfiguration(std::make_shared<const ModelType>(model)) {}
+  /// @brief Constructor sharing the model, e.g. with another space.
+  MultibodyConfiguration(ModelHandle model)
+      : Base(model->nq, model->nv)
+      , model_(std::move(model)) {
+    // joints with nq == nv (revolute, prismatic...) are Euclidean
+    this->non_euclidean_dim_ = 0;
+    for (std::size_t i = 1; i < model_->joints.size(); i++) {
+      const auto &jmodel = model_->joints[i];
+      if (jmodel.nq() != jmodel.nv())
+        this->non_euclidean_dim_ =
+            std::max(this->non_euclidean_dim_, jmodel.idx_v() + jmodel.nv());
+    }
+  }
   MultibodyConfiguration(const MultibodyConfiguration &) = default;
   MultibodyConfiguration &operator=(const MultibodyConfiguration &) = default;
   MultibodyConfiguration(MultibodyConfiguration &&) = default;
   MultibodyConfiguration &operator=(MultibodyConfiguration &&) = default;
 
-  const ModelType &getModel() const { return model_; }
+  const ModelType &getModel() const { return *model_; }
+  const ModelHandle &getModelHandle() const { return model_; }
 
   bool isNormalized(const ConstVectorRef &x) const {
-    return pinocchio::isNormalized(model_, x);
+    return pinocchio::isNormalized(*model_, x);
   }
 
 protected:
-  ModelType model_;
+  /// Copies of the space share the model.
+  ModelHandle model_;
 
   /// \name implementations
   /// \{
 
   void integrate_impl(const ConstVectorRef &x, const ConstVectorRef &v,
                       VectorRef xout) const {
-    pinocchio::integrate(model_, x, v, xout);
+    pinocchio::integrate(*model_, x, v, xout);
   }
 
   void Jintegrate_impl(const ConstVectorRef &x, const ConstVectorRef &v,
                        MatrixRef Jout, int arg) const {
     switch (arg) {
     case 0:
-      pinocchio::dIntegrate(model_, x, v, Jout, pinocchio::ARG0);
+      pinocchio::dIntegrate(*model_, x, v, Jout, pinocchio::ARG0);
       break;
     case 1:
-      pinocchio::dIntegrate(model_, x, v, Jout, pinocchio::ARG1);
+      pinocchio::dIntegrate(*model_, x, v, Jout, pinocchio::ARG1);
       break;
     }
   }
@@ -66,10 +82,10 @@ protected:
                                 int arg) const {
     switch (arg) {
     case 0:
-      pinocchio::dIntegrateTransport(model_, x, v, Jout, pinocchio::ARG0);
+      pinocchio::dIntegrateTransport(*model_, x, v, Jout, pinocchio::ARG0);
       break;
     case 1:
-      pinocchio::dIntegrateTransport(model_, x, v, Jout, pinocchio::ARG1);
+      pinocchio::dIntegrateTransport(*model_, x, v, Jout, pinocchio::ARG1);
       break;
     default:
       break;
@@ -78,31 +94,57 @@ protected:
 
   void difference_impl(const ConstVectorRef &x0, const ConstVectorRef &x1,
                        VectorRef vout) const {
-    pinocchio::difference(model_, x0, x1, vout);
+    pinocchio::difference(*model_, x0, x1, vout);
   }
 
   void Jdifference_impl(const ConstVectorRef &x0, const ConstVectorRef &x1,
                         MatrixRef Jout, int arg) const {
     switch (arg) {
     case 0:
-      pinocchio::dDifference(model_, x0, x1, Jout, pinocchio::ARG0);
+      pinocchio::dDifference(*model_, x0, x1, Jout, pinocchio::ARG0);
       break;
     case 1:
-      pinocchio::dDifference(model_, x0, x1, Jout, pinocchio::ARG1);
+      pinocchio::dDifference(*model_, x0, x1, Jout, pinocchio::ARG1);
       break;
     }
   }
 
   void interpolate_impl(const ConstVectorRef &x0, const ConstVectorRef &x1,
                         const Scalar &u, VectorRef out) const {
-    pinocchio::interpolate(model_, x0, x1, u, out);
+    pinocchio::interpolate(*model_, x0, x1, u, out);
+  }
+
+  /// Batched operations: the knots of a model without non-Euclidean joints
+  /// are integrated at once, otherwise Pinocchio is called on each knot
+  /// without going through the virtual single-knot operations.
+  void integrateBatch_impl(const ConstMatrixRef &xs, const ConstMatrixRef &vs,
+                           const Scalar alpha, MatrixRef out) const {
+    if (this->isEuclidean()) {
+      out = xs + alpha * vs;
+      return;
+    }
+    ALIGATOR_STACK_VECTOR(Scalar, v, ndx());
+    for (Eigen::Index i = 0; i < xs.cols(); i++) {
+      v = alpha * vs.col(i);
+      pinocchio::integrate(*model_, xs.col(i), v, out.col(i));
+    }
   }
 
-  void neutral_impl(VectorRef out) const { pinocchio::neutral(model_, out); }
+  void differenceBatch_impl(const ConstMatrixRef &x0s,
+                            const ConstMatrixRef &x1s, MatrixRef out) const {
+    if (this->isEuclidean()) {
+      out = x1s - x0s;
+      return;
+    }
+    for (Eigen::Index i = 0; i < x0s.cols(); i++)
+      pinocchio::difference(*model_, x0s.col(i), x1s.col(i), out.col(i));
+  }
+
+  void neutral_impl(VectorRef out) const { pinocchio::neutral(*model_, out); }
 
   void rand_impl(VectorRef out) const {
-    pinocchio::randomConfiguration(model_, model_.lowerPositionLimit,
-                                   model_.upperPositionLimit, out);
+    pinocchio::randomConfiguration(*model_, model_->lowerPositionLimit,
+                                   model_->upperPositionLimit, out);
   }
 
   /// \}
@@ -118,11 +160,18 @@ template <typename Scalar>
 struct MultibodyPhaseSpace : TangentBundleTpl<MultibodyConfiguration<Scalar>> {
   using ConfigSpace = MultibodyConfiguration<Scalar>;
   using ModelType = typename ConfigSpace::ModelType;
+  using ModelHandle = typename ConfigSpace::ModelHandle;
 
   const ModelType &getModel() const { return this->base_.getModel(); }
+  const ModelHandle &getModelHandle() const {
+    return this->base_.getModelHandle();
+  }
 
   MultibodyPhaseSpace(const ModelType &model)
       : TangentBundleTpl<ConfigSpace>(ConfigSpace(model)) {}
+  /// @brief Constructor sharing the model, e.g. with another space.
+  MultibodyPhaseSpace(ModelHandle model)
+      : TangentBundleTpl<ConfigSpace>(ConfigSpace(std::move(model))) {}
   MultibodyPhaseSpace(const MultibodyPhaseSpace &) = default;
   MultibodyPhaseSpace &operator=(const MultibodyPhaseSpace &) = default;
   MultibodyPhaseSpace(MultibodyPhaseSpace &&) = default;
@@ -109,6 +109,35 @@ protected:
     lg_.interpolate(x0, x1, u, out);
   }
 
+  /// The scaled increments are formed in fixed-size tangent vectors for
+  /// groups of fixed dimension, and on the stack otherwise.
+  void integrateBatch_impl(const ConstMatrixRef &xs, const ConstMatrixRef &vs,
+                           const Scalar alpha, MatrixRef out) const {
+    if constexpr (LieGroup::NV == Eigen::Dynamic) {
+      ALIGATOR_STACK_VECTOR(Scalar, v, lg_.nv());
+      integrateScaled(xs, vs, alpha, v, out);
+    } else {
+      typename LieGroup::TangentVector_t v;
+      integrateScaled(xs, vs, alpha, v, out);
+    }
+  }
+
+  template <typename TangentVector>
+  void integrateScaled(const ConstMatrixRef &xs, const ConstMatrixRef &vs,
+                       const Scalar alpha, TangentVector &v,
+                       MatrixRef out) const {
+    for (Eigen::Index i = 0; i < xs.cols(); i++) {
+      v = alpha * vs.col(i);
+      lg_.integrate(xs.col(i), v, out.col(i));
+    }
+  }
+
+  void differenceBatch_impl(const ConstMatrixRef &x0s,
+                            const ConstMatrixRef &x1s, MatrixRef out) const {
+    for (Eigen::Index i = 0; i < x0s.cols(); i++)
+      lg_.difference(x0s.col(i), x1s.col(i), out.col(i));
+  }
+
   virtual void neutral_impl(VectorRef out) const { out = lg_.neutral(); }
 
   virtual void rand_impl(VectorRef out) const { out = lg_.random(); }
@@ -22,7 +22,9 @@ public:
   /// Constructor using base space instance.
   TangentBundleTpl(const Base &base)
       : ManifoldBase(base.nx() + base.ndx(), 2 * base.ndx())
-      , base_(base) {}
+      , base_(base) {
+    this->non_euclidean_dim_ = base_.nonEuclideanDim();
+  }
 
   /// Constructor using base space constructor.
   template <typename... BaseCtorArgs>
@@ -31,6 +33,7 @@ public:
       , base_(args...) {
     this->nx_ = base_.nx() + base_.ndx();
     this->ndx_ = 2 * base_.ndx();
+    this->non_euclidean_dim_ = base_.nonEuclideanDim();
   }
 
   bool isNormalized(const ConstVectorRef &x) const {
@@ -96,6 +99,12 @@ protected:
 
   void interpolate_impl(const ConstVectorRef &x0, const ConstVectorRef &x1,
                         const Scalar &u, VectorRef out) const;
+
+  void integrateBatch_impl(const ConstMatrixRef &xs, const ConstMatrixRef &vs,
+                           const Scalar alpha, MatrixRef out) const;
+
+  void differenceBatch_impl(const ConstMatrixRef &x0s,
+                            const ConstMatrixRef &x1s, MatrixRef out) const;
 };
 
 } // namespace aligator
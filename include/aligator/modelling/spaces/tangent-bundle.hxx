@@ -85,4 +85,26 @@ void TangentBundleTpl<Base>::interpolate_impl(const ConstVectorRef &x0,
       (Scalar(1.) - u) * getBaseTangent(x0) + u * getBaseTangent(x1);
 }
 
+template <class Base>
+void TangentBundleTpl<Base>::integrateBatch_impl(const ConstMatrixRef &xs,
+                                                 const ConstMatrixRef &vs,
+                                                 const Scalar alpha,
+                                                 MatrixRef out) const {
+  const int nq_ = base_.nx();
+  const int nv_ = base_.ndx();
+  base_.integrateBatch(xs.topRows(nq_), vs.topRows(nv_), alpha,
+                       out.topRows(nq_));
+  out.bottomRows(nv_) = xs.bottomRows(nv_) + alpha * vs.bottomRows(nv_);
+}
+
+template <class Base>
+void TangentBundleTpl<Base>::differenceBatch_impl(const ConstMatrixRef &x0s,
+                                                  const ConstMatrixRef &x1s,
+                                                  MatrixRef out) const {
+  const int nq_ = base_.nx();
+  const int nv_ = base_.ndx();
+  base_.differenceBatch(x0s.topRows(nq_), x1s.topRows(nq_), out.topRows(nv_));
+  out.bottomRows(nv_) = x1s.bottomRows(nv_) - x0s.bottomRows(nv_);
+}
+
 } // namespace aligator
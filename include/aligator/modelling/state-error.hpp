@@ -3,6 +3,7 @@
 #include "aligator/core/function-abstract.hpp"
 #include "aligator/core/unary-function.hpp"
 #include "aligator/core/vector-space.hpp"
+#include "aligator/core/stage-parameters.hpp"
 #include "aligator/third-party/polymorphic_cxx14.h"
 
 namespace aligator {
@@ -16,19 +17,38 @@ namespace detail {
 template <typename _Scalar, unsigned int arg>
 struct StateOrControlErrorResidual;
 
+/// @brief Data for StateOrControlErrorResidual.
+template <typename _Scalar>
+struct StateOrControlErrorDataTpl : StageFunctionDataTpl<_Scalar> {
+  using Scalar = _Scalar;
+  using Base = StageFunctionDataTpl<Scalar>;
+
+  /// Target, read from the stage parameters if the residual has a
+  /// `target_parameter_`.
+  StageParameterViewTpl<Scalar> target_;
+
+  template <typename Residual>
+  explicit StateOrControlErrorDataTpl(const Residual &model)
+      : Base(model)
+      , target_(model.target_parameter_, model.target_.size()) {}
+};
+
 /// @brief Pure state residual.
 template <typename _Scalar>
 struct StateOrControlErrorResidual<_Scalar, 0> : UnaryFunctionTpl<_Scalar> {
   using Scalar = _Scalar;
   ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
   ALIGATOR_UNARY_FUNCTION_INTERFACE(Scalar);
-  using Data = StageFunctionDataTpl<Scalar>;
+  using BaseData = StageFunctionDataTpl<Scalar>;
+  using Data = StateOrControlErrorDataTpl<Scalar>;
   using Manifold = ManifoldAbstractTpl<Scalar>;
   using VectorSpace = VectorSpaceTpl<Scalar, Eigen::Dynamic>;
   using PolyManifold = xyz::polymorphic<Manifold>;
 
   PolyManifold space_;
   VectorXs target_;
+  /// Name of the stage parameter slot to read the target from, if not empty.
+  std::string target_parameter_;
 
   StateOrControlErrorResidual(const PolyManifold &xspace, const int nu,
                               const ConstVectorRef &target)
@@ -48,14 +68,31 @@ struct StateOrControlErrorResidual<_Scalar, 0> : UnaryFunctionTpl<_Scalar> {
     validate();
   }
 
-  void evaluate(const ConstVectorRef &x, Data &data) const override {
-    space_->difference(target_, x, data.value_);
+  void evaluate(const ConstVectorRef &x, BaseData &data) const override {
+    const ConstVectorRef target =
+        static_cast<Data &>(data).target_.valueOr(target_);
+    space_->difference(target, x, data.value_);
+  }
+
+  void computeJacobians(const ConstVectorRef &x,
+                        BaseData &data) const override {
+    const ConstVectorRef target =
+        static_cast<Data &>(data).target_.valueOr(target_);
+    space_->Jdifference(target, x, data.Jx_, 1);
   }
 
-  void computeJacobians(const ConstVectorRef &x, Data &data) const override {
-    space_->Jdifference(target_, x, data.Jx_, 1);
+  shared_ptr<BaseData> createData() const override {
+    return std::make_shared<Data>(*this);
   }
 
+  void registerParameters(StageParametersTpl<Scalar> &params) const override {
+    if (!target_parameter_.empty())
+      params.declareSlot(target_parameter_, target_);
+  }
+
+  /// The Jacobians are identities on Euclidean spaces.
+  bool hasConstantJacobians() const override { return space_->isEuclidean(); }
+
 protected:
   void validate() const {
     if (!space_->isNormalized(target_)) {
@@ -71,12 +108,15 @@ struct StateOrControlErrorResidual : StageFunctionTpl<_Scalar> {
   using Scalar = _Scalar;
   ALIGATOR_DYNAMIC_TYPEDEFS(Scalar);
   using Base = StageFunctionTpl<Scalar>;
-  using Data = StageFunctionDataTpl<Scalar>;
+  using BaseData = StageFunctionDataTpl<Scalar>;
+  using Data = StateOrControlErrorDataTpl<Scalar>;
   using Manifold = ManifoldAbstractTpl<Scalar>;
   using VectorSpace = VectorSpaceTpl<Scalar, Eigen::Dynamic>;
 
   xyz::polymorphic<Manifold> space_;
   VectorXs target_;
+  /// Name of the stage parameter slot to read the target from, if not empty.
+  std::string target_parameter_;
 
   /// @brief Constructor using the state space dimension, control manifold and
   ///        control target.
@@ -87,6 +127,7 @@ struct StateOrControlErrorResidual : StageFunctionTpl<_Scalar> {
       : Base(ndx, uspace.nx(), uspace.ndx())
       , space_(std::forward<U>(uspace))
       , target_(target) {
+    this->jac_pattern.x_size = 0;
     validate();
   }
 
@@ -96,13 +137,16 @@ struct StateOrControlErrorResidual : StageFunctionTpl<_Scalar> {
       : Base(ndx, uspace->nx(), uspace->ndx())
       , space_(uspace)
       , target_(target) {
+    this->jac_pattern.x_size = 0;
     validate();
   }
 
   StateOrControlErrorResidual(const int ndx, const int nu)
       : Base(ndx, nu, nu)
       , space_(VectorSpace(nu))
-      , target_(space_->neutral()) {}
+      , target_(space_->neutral()) {
+    this->jac_pattern.x_size = 0;
+  }
 
   /// @brief Constructor using state space and control space dimensions,
   ///        the control space is assumed to be Euclidean.
@@ -112,10 +156,12 @@ struct StateOrControlErrorResidual : StageFunctionTpl<_Scalar> {
   }
 
   void evaluate(const ConstVectorRef &, const ConstVectorRef &u,
-                Data &data) const override {
+                BaseData &data) const override {
+    const ConstVectorRef target =
+        static_cast<Data &>(data).target_.valueOr(target_);
     switch (arg) {
     case 1:
-      space_->difference(target_, u, data.value_);
+      space_->difference(target, u, data.value_);
       break;
     default:
       break;
@@ -123,16 +169,30 @@ struct StateOrControlErrorResidual : StageFunctionTpl<_Scalar> {
   }
 
   void computeJacobians(const ConstVectorRef &, const ConstVectorRef &u,
-                        Data &data) const override {
+                        BaseData &data) const override {
+    const ConstVectorRef target =
+        static_cast<Data &>(data).target_.valueOr(target_);
     switch (arg) {
     case 1:
-      space_->Jdifference(target_, u, data.Ju_, 1);
+      space_->Jdifference(target, u, data.Ju_, 1);
       break;
     default:
       break;
     }
   }
 
+  shared_ptr<BaseData> createData() const override {
+    return std::make_shared<Data>(*this);
+  }
+
+  void registerParameters(StageParametersTpl<Scalar> &params) const override {
+    if (!target_parameter_.empty())
+      params.declareSlot(target_parameter_, target_);
+  }
+
+  /// The Jacobians are identities on Euclidean spaces.
+  bool hasConstantJacobians() const override { return space_->isEuclidean(); }
+
 protected:
   void validate() const {
     if (!space_->isNormalized(target_)) {
@@ -13,6 +13,7 @@
 #include "results.hpp"
 
 #include "aligator/utils/logger.hpp"
+#include "aligator/utils/deadline.hpp"
 #include "aligator/utils/string-hash.hpp"
 #include "aligator/threads.hpp"
 
@@ -71,6 +72,13 @@ template <typename Scalar> struct SolverFDDPTpl {
   /// satisfy the initial condition. This flag switches that behaviour on or
   /// off.
   bool force_initial_condition_;
+  /// Wall-clock budget for run(), in seconds (anytime mode). A new iteration or
+  /// trial step is only started if its measured duration fits before the
+  /// deadline; otherwise run() sets ResultsBaseTpl::timed_out and returns the
+  /// best iterate whose gains were computed during the run (lowest dynamical
+  /// infeasibility above target_tol_, then lowest cost), with these gains.
+  /// Non-positive values disable the budget.
+  double time_limit_ = 0.;
 
   Logger logger{};
 
@@ -85,6 +93,22 @@ protected:
   std::size_t num_threads_;
   /// Callbacks
   CallbackMap callbacks_;
+  /// Deadline of the current run() call.
+  Deadline deadline_;
+  /// Last measured durations (in seconds) of the linearization (derivatives
+  /// and backward pass) and of a forward pass. Used to predict whether the
+  /// next phase fits in the time budget.
+  double linearize_time_ = 0.;
+  double forward_time_ = 0.;
+  /// Best iterate of the current run() call whose gains were computed,
+  /// returned if the time budget runs out.
+  Results best_iterate_;
+  bool has_best_iterate_ = false;
+
+  /// Save the current iterate and its gains as best_iterate_, if it is better.
+  void updateBestIterate();
+  /// Return best_iterate_ after the time budget ran out.
+  void restoreBestIterate();
 
 public:
   Results results_;
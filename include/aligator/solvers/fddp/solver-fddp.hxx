@@ -34,6 +34,8 @@ void SolverFDDPTpl<Scalar>::setup(const Problem &problem) {
   workspace_.~Workspace();
   new (&results_) Results(problem);
   new (&workspace_) Workspace(problem);
+  best_iterate_ = results_;
+  linearize_time_ = forward_time_ = 0.;
   // check if there are any constraints other than dynamics and throw a warning
   std::vector<std::size_t> idx_where_constraints;
   for (std::size_t i = 0; i < problem.numSteps(); i++) {
@@ -106,7 +108,7 @@ Scalar SolverFDDPTpl<Scalar>::forwardPass(const Problem &problem,
   CostData &cd_term = *prob_data.term_cost_data;
 
   ALIGATOR_NOMALLOC_END;
-  problem.term_cost_->evaluate(xs_try.back(), us_try.back(), cd_term);
+  problem.term_cost_->evaluate(xs_try.back(), problem.unone_, cd_term);
   ALIGATOR_NOMALLOC_BEGIN;
 
   traj_cost_ += cd_term.value_;
@@ -279,16 +281,42 @@ void SolverFDDPTpl<Scalar>::backwardPass(const Problem &problem,
   ALIGATOR_NOMALLOC_END;
 }
 
+template <typename Scalar> void SolverFDDPTpl<Scalar>::updateBestIterate() {
+  // infeasibilities below the target tolerance are all feasible
+  const Scalar infeas = std::max(results_.prim_infeas, target_tol_);
+  const Scalar best_infeas = std::max(best_iterate_.prim_infeas, target_tol_);
+  if (has_best_iterate_ &&
+      (infeas > best_infeas || (infeas == best_infeas &&
+                                results_.traj_cost_ >=
+                                    best_iterate_.traj_cost_)))
+    return;
+  best_iterate_.copyIterate(results_);
+  has_best_iterate_ = true;
+}
+
+template <typename Scalar> void SolverFDDPTpl<Scalar>::restoreBestIterate() {
+  results_.timed_out = true;
+  if (!has_best_iterate_) {
+    // no gains were computed during this run
+    results_.gains_stale = true;
+    return;
+  }
+  results_.copyIterate(best_iterate_);
+}
+
 template <typename Scalar>
 bool SolverFDDPTpl<Scalar>::run(const Problem &problem,
                                 const std::vector<VectorXs> &xs_init,
                                 const std::vector<VectorXs> &us_init) {
+  deadline_.start(time_limit_);
   preg_ = reg_init;
 
   if (!results_.isInitialized() || !workspace_.isInitialized()) {
     ALIGATOR_RUNTIME_ERROR(
         "Either results or workspace not allocated. Call setup() first!");
   }
+  // constant derivatives are computed once per solve
+  workspace_.problem_data.resetConstantDerivatives(true);
 
   check_initial_guess_and_assign(problem, xs_init, us_init, results_.xs,
                                  results_.us);
@@ -297,6 +325,10 @@ bool SolverFDDPTpl<Scalar>::run(const Problem &problem,
     workspace_.trial_xs[0] = problem.getInitState();
   }
   results_.conv = false;
+  results_.timed_out = false;
+  results_.gains_stale = false;
+  has_best_iterate_ = false;
+  results_.stats.reset();
 
   logger.active = verbose_ > 0;
   logger.addColumn(BASIC_KEYS[0]);
@@ -311,8 +343,20 @@ bool SolverFDDPTpl<Scalar>::run(const Problem &problem,
 
   // in Crocoddyl, linesearch xs is primed to use problem x0
 
+  // set when the time budget cannot fit another forward pass: the remaining
+  // linesearch steps are rejected without being evaluated.
+  bool ls_timed_out = false;
+  SolverStats &stats = results_.stats;
   const auto linesearch_fun = [&](const Scalar alpha) {
-    return forwardPass(problem, results_, workspace_, alpha);
+    if (!deadline_.fits(forward_time_)) {
+      ls_timed_out = true;
+      return std::numeric_limits<Scalar>::infinity();
+    }
+    Stopwatch trial_sw;
+    stats.num_merit_evals++;
+    const Scalar phi = forwardPass(problem, results_, workspace_, alpha);
+    forward_time_ = trial_sw.lap();
+    return phi;
   };
 
   Scalar &d1_phi = workspace_.d1_;
@@ -325,19 +369,31 @@ bool SolverFDDPTpl<Scalar>::run(const Problem &problem,
   };
 
   std::size_t &iter = results_.num_iters;
+  Stopwatch sw;
   results_.traj_cost_ = problem.evaluate(results_.xs, results_.us,
                                          workspace_.problem_data, num_threads_);
+  stats.evaluate += sw.lap();
 
   for (iter = 0; iter < max_iters; ++iter) {
+    if (!deadline_.fits(linearize_time_)) {
+      restoreBestIterate();
+      break;
+    }
+    sw.lap();
 
     problem.computeDerivatives(results_.xs, results_.us,
                                workspace_.problem_data, num_threads_);
     results_.prim_infeas = computeInfeasibility(problem);
     ALIGATOR_RAISE_IF_NAN(results_.prim_infeas);
+    const double derivatives_time = sw.lap();
 
     backwardPass(problem, workspace_);
     results_.dual_infeas = computeCriterion(workspace_);
     ALIGATOR_RAISE_IF_NAN(results_.dual_infeas);
+    const double backward_time = sw.lap();
+    linearize_time_ = derivatives_time + backward_time;
+    stats.derivatives += derivatives_time;
+    stats.backward += backward_time;
 
     Scalar stopping_criterion =
         std::max(results_.prim_infeas, results_.dual_infeas);
@@ -347,6 +403,11 @@ bool SolverFDDPTpl<Scalar>::run(const Problem &problem,
     }
 
     acceptGains(workspace_, results_);
+    updateBestIterate();
+    if (!deadline_.fits(forward_time_)) {
+      restoreBestIterate();
+      break;
+    }
 
     phi0 = results_.traj_cost_;
     ALIGATOR_RAISE_IF_NAN(phi0);
@@ -356,6 +417,12 @@ bool SolverFDDPTpl<Scalar>::run(const Problem &problem,
     Scalar alpha_opt, phi_new;
     std::tie(alpha_opt, phi_new) = fddp_goldstein_linesearch(
         linesearch_fun, ls_model, phi0, ls_params, th_grad_, d1_phi);
+    stats.linesearch += sw.lap();
+    if (ls_timed_out) {
+      // reject the step
+      restoreBestIterate();
+      break;
+    }
 
     results_.traj_cost_ = phi_new;
     ALIGATOR_RAISE_IF_NAN(alpha_opt);
@@ -382,6 +449,7 @@ bool SolverFDDPTpl<Scalar>::run(const Problem &problem,
     }
     if (alpha_opt <= th_step_inc_) {
       increaseRegularization();
+      stats.num_reg_increases++;
       if (preg_ == reg_max_) {
         results_.conv = false;
         break;
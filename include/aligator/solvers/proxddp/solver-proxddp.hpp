@@ -12,6 +12,7 @@
 #include "aligator/core/enums.hpp"
 #include "aligator/core/mimalloc-resource.hpp"
 #include "aligator/utils/logger.hpp"
+#include "aligator/utils/deadline.hpp"
 #include "aligator/gar/riccati-base.hpp"
 
 #include "workspace.hpp"
@@ -19,6 +20,7 @@
 
 #include <boost/unordered_map.hpp>
 #include <boost/version.hpp>
+#include <exception>
 #include <variant>
 
 namespace aligator {
@@ -173,6 +175,21 @@ public:
   Scalar refinement_threshold_ = 1e-13; //< Target tol. for the KKT system.
   size_t max_iters;                     //< Max number of Newton iterations.
   size_t max_al_iters = 100;            //< Maximum number of ALM iterations.
+  /// Warm-start run() from the state of the previous solve: ALM penalty,
+  /// regularization, BCL tolerances and, when no initial guess is given, the
+  /// primal-dual iterate (as shifted by cycleProblem()). Meant for MPC.
+  bool warm_start_ = false;
+  /// Number of step sizes \f$(1, 1/2, 1/4, \ldots)\f$ evaluated concurrently
+  /// by the speculative linesearch. Values lower than 2 disable speculation.
+  /// @warning Set this before calling setup().
+  size_t speculative_ls_lanes = 1;
+  /// Wall-clock budget for run(), in seconds (anytime mode). A new iteration or
+  /// trial step is only started if its measured duration fits before the
+  /// deadline; otherwise run() sets ResultsBaseTpl::timed_out and returns the
+  /// best iterate whose gains were computed during the run (lowest primal
+  /// infeasibility above target_tol_, then lowest merit value), with these
+  /// gains. Non-positive values disable the budget.
+  double time_limit_ = 0.;
 
   mimalloc_resource memory_resource_; //< Memory resource
   polymorphic_allocator allocator_;   //< Main allocator
@@ -205,14 +222,47 @@ public:
   ///           \f$(\bfx \oplus\alpha\delta\bfx, \bfu+\alpha\delta\bfu,
   ///           \bmlam+\alpha\delta\bmlam)\f$
   /// @returns  The trajectory cost.
-  Scalar tryLinearStep(const Problem &problem, const Scalar alpha);
+  Scalar tryLinearStep(const Problem &problem, const Scalar alpha) {
+    return tryLinearStep(problem, alpha, workspace_, num_threads_);
+  }
+
+  /// @copybrief tryLinearStep()
+  /// @param trial_ws     Workspace receiving the trial point. The search
+  ///                     direction is always read from the solver workspace.
+  /// @param num_threads  Number of threads used to evaluate the problem.
+  Scalar tryLinearStep(const Problem &problem, const Scalar alpha,
+                       Workspace &trial_ws, const size_t num_threads);
 
   /// @brief    Policy rollout using the full nonlinear dynamics. The feedback
   /// gains need to be computed first. This will evaluate all the terms in the
   /// problem into the problem data, similar to TrajOptProblemTpl::evaluate().
   /// @returns  The trajectory cost.
-  Scalar tryNonlinearRollout(const Problem &problem, const Scalar alpha);
+  Scalar tryNonlinearRollout(const Problem &problem, const Scalar alpha) {
+    return tryNonlinearRollout(problem, alpha, workspace_, num_threads_);
+  }
 
+  /// @copybrief tryNonlinearRollout()
+  /// @param trial_ws     Workspace receiving the trial point. Its step buffers
+  ///                     are used as scratch space.
+  /// @param num_threads  With the parallel LQ solver, its legs are rolled out
+  ///                     concurrently only if this is greater than one.
+  Scalar tryNonlinearRollout(const Problem &problem, const Scalar alpha,
+                             Workspace &trial_ws, const size_t num_threads);
+
+  /// @brief    Nonlinear rollout over the knots \f$[t_0, t_1)\f$, starting
+  /// from the linear step at \f$t_0\f$.
+  /// @details  When \f$t_1\f$ is not the end of the horizon, the state at
+  /// \f$t_1\f$ is left to the next leg, leaving a dynamical defect which the
+  /// merit function accounts for.
+  /// @param par_solver Parallel LQ solver whose legs are rolled out, to get
+  ///                   the feedback gains w.r.t. the leg parameter (if any).
+  void nonlinearRolloutLeg(
+      const Problem &problem, const Scalar alpha, Workspace &trial_ws,
+      const size_t t0, const size_t t1,
+      const gar::ParallelRiccatiSolver<Scalar> *par_solver = nullptr);
+
+  /// @brief    Evaluate the merit function at the trial point of step size
+  /// \f$\alpha\f$. The trial point is left in the solver workspace.
   Scalar forwardPass(const Problem &problem, const Scalar alpha);
 
   void updateLQSubproblem();
@@ -305,7 +355,19 @@ public:
   bool computeMultipliers(const Problem &problem,
                           const std::vector<VectorXs> &xs,
                           const std::vector<VectorXs> &lams,
-                          const std::vector<VectorXs> &vs);
+                          const std::vector<VectorXs> &vs) {
+    return computeMultipliers(problem, xs, lams, vs, workspace_,
+                              results_.prim_infeas);
+  }
+
+  /// @copybrief computeMultipliers()
+  /// @param trial_ws     Workspace receiving the multiplier estimates.
+  /// @param prim_infeas  Output primal infeasibility.
+  bool computeMultipliers(const Problem &problem,
+                          const std::vector<VectorXs> &xs,
+                          const std::vector<VectorXs> &lams,
+                          const std::vector<VectorXs> &vs, Workspace &trial_ws,
+                          Scalar &prim_infeas) const;
 
   inline Scalar mu() const { return mu_penal_; }
   inline Scalar mu_inv() const { return 1. / mu_penal_; }
@@ -322,6 +384,56 @@ protected:
   /// Dual proximal/ALM penalty parameter \f$\mu\f$. This is the global
   /// parameter. There might be individual scaling for stagewise constraints.
   Scalar mu_penal_ = mu_init_;
+  /// Whether run() was called since setup(), i.e. there is a state to
+  /// warm-start from.
+  bool has_warm_state_ = false;
+  /// Deadline of the current run() call.
+  Deadline deadline_;
+  /// Last measured durations (in seconds) of the derivative evaluation, of the
+  /// LQ subproblem solve and of a trial point evaluation. Used to predict
+  /// whether the next phase fits in the time budget.
+  double derivatives_time_ = 0.;
+  double lq_solve_time_ = 0.;
+  double trial_eval_time_ = 0.;
+  /// Best iterate of the current run() call whose gains were computed,
+  /// returned if the time budget runs out.
+  Results best_iterate_;
+  bool has_best_iterate_ = false;
+
+  /// Save the current iterate and its gains as best_iterate_, if it is better.
+  void updateBestIterate();
+  /// Return best_iterate_ after the time budget ran out.
+  void restoreBestIterate();
+
+  /// @brief A trial point of the speculative linesearch.
+  struct SpeculativeLane {
+    Workspace workspace; //< Trial point buffers, see Workspace::trialPoint()
+    Scalar alpha = 0.;   //< Step size
+    Scalar phi = 0.;     //< Merit function value
+    Scalar prim_infeas = 0.;
+    bool ready = false; //< Evaluated for the current direction, not consumed
+    /// Error raised by the evaluation, rethrown if the lane is consumed.
+    std::exception_ptr error = nullptr;
+  };
+  std::vector<SpeculativeLane> ls_lanes_; //< Speculative linesearch lanes
+
+  /// @brief Evaluate the merit function at the trial point of step size
+  /// \f$\alpha\f$ into @p trial_ws.
+  Scalar forwardPass(const Problem &problem, const Scalar alpha,
+                     Workspace &trial_ws, const size_t num_threads,
+                     Scalar &prim_infeas);
+
+  /// @brief Speculative version of forwardPass(). On a miss, evaluate the step
+  /// sizes \f$(\alpha, \alpha/2, \ldots)\f$ concurrently, one per lane, then
+  /// swap the trial point of the requested step size into the solver
+  /// workspace.
+  Scalar speculativeForwardPass(const Problem &problem, const Scalar alpha);
+
+  /// Invalidate the speculative lanes, e.g. when the search direction changes.
+  void resetSpeculativeLanes() noexcept {
+    for (SpeculativeLane &lane : ls_lanes_)
+      lane.ready = false;
+  }
 
   void updateTolsOnFailure() noexcept {
     const Scalar arg = std::min(mu_penal_, 0.99);
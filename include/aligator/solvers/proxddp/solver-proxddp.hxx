@@ -16,6 +16,7 @@
 #include "aligator/tracy.hpp"
 
 #include <fmt/format.h>
+#include <exception>
 
 namespace aligator {
 
@@ -36,9 +37,15 @@ void computeProjectedJacobians(const TrajOptProblemTpl<Scalar> &problem,
     const StageDataTpl<Scalar> &sd = *prob_data.stage_data[i];
     auto &jac = workspace.cstr_proj_jacs[i];
 
+    // the columns outside of the Jacobian patterns are zero since the
+    // workspace was allocated, and the projection keeps them zero
     for (size_t j = 0; j < sm.numConstraints(); j++) {
-      jac(j, 0) = sd.constraint_data[j]->Jx();
-      jac(j, 1) = sd.constraint_data[j]->Ju();
+      const JacobianPattern &p = sm.constraints_.funcs[j]->jac_pattern;
+      const StageFunctionDataTpl<Scalar> &cd = *sd.constraint_data[j];
+      jac(j, 0).middleCols(p.x_begin, p.x_size) =
+          cd.Jx_.middleCols(p.x_begin, p.x_size);
+      jac(j, 1).middleCols(p.u_begin, p.u_size) =
+          cd.Ju_.middleCols(p.u_begin, p.u_size);
     }
 
     auto Px = jac.blockCol(0);
@@ -56,7 +63,9 @@ void computeProjectedJacobians(const TrajOptProblemTpl<Scalar> &problem,
     auto &jac = workspace.cstr_proj_jacs[N];
     const auto &cds = prob_data.term_cstr_data;
     for (size_t j = 0; j < cds.size(); j++) {
-      jac(j, 0) = cds[j]->Jx();
+      const JacobianPattern &p = problem.term_cstrs_.funcs[j]->jac_pattern;
+      jac(j, 0).middleCols(p.x_begin, p.x_size) =
+          cds[j]->Jx_.middleCols(p.x_begin, p.x_size);
     }
 
     auto Px = jac.blockCol(0);
@@ -81,7 +90,7 @@ SolverProxDDPTpl<Scalar>::SolverProxDDPTpl(const Scalar tol,
     , hess_approx_(hess_approx)
     , sa_strategy_(sa_strategy)
     , max_iters(max_iters)
-    , memory_resource_{}
+    , memory_resource_{true}
     , allocator_{&memory_resource_}
     , workspace_{allocator_}
     , results_()
@@ -109,7 +118,9 @@ void SolverProxDDPTpl<Scalar>::setNumThreads(const size_t num_threads) {
 
 template <typename Scalar>
 Scalar SolverProxDDPTpl<Scalar>::tryLinearStep(const Problem &problem,
-                                               const Scalar alpha) {
+                                               const Scalar alpha,
+                                               Workspace &trial_ws,
+                                               const size_t num_threads) {
   ALIGATOR_TRACY_ZONE_SCOPED;
 
   const size_t nsteps = workspace_.nsteps;
@@ -119,8 +130,8 @@ Scalar SolverProxDDPTpl<Scalar>::tryLinearStep(const Problem &problem,
   assert(results_.vs.size() == nsteps + 1);
 
   math::vectorMultiplyAdd(results_.lams, workspace_.dlams,
-                          workspace_.trial_lams, alpha);
-  math::vectorMultiplyAdd(results_.vs, workspace_.dvs, workspace_.trial_vs,
+                          trial_ws.trial_lams, alpha);
+  math::vectorMultiplyAdd(results_.vs, workspace_.dvs, trial_ws.trial_vs,
                           alpha);
 
   long ndx_max = 0U;
@@ -140,18 +151,18 @@ Scalar SolverProxDDPTpl<Scalar>::tryLinearStep(const Problem &problem,
     dx_tmp.head(ndx) = alpha * workspace_.dxs[i];
     du_tmp.head(nu) = alpha * workspace_.dus[i];
     stage.xspace_->integrate(results_.xs[i], dx_tmp.head(ndx),
-                             workspace_.trial_xs[i]);
+                             trial_ws.trial_xs[i]);
     stage.uspace_->integrate(results_.us[i], du_tmp.head(nu),
-                             workspace_.trial_us[i]);
+                             trial_ws.trial_us[i]);
   }
   const StageModel &stage = *problem.stages_[nsteps - 1];
   const long ndxN = workspace_.dxs[nsteps].size();
   dx_tmp.head(ndxN) = alpha * workspace_.dxs[nsteps];
   stage.xspace_next_->integrate(results_.xs[nsteps], dx_tmp.head(ndxN),
-                                workspace_.trial_xs[nsteps]);
-  TrajOptData &prob_data = workspace_.problem_data;
-  return problem.evaluate(workspace_.trial_xs, workspace_.trial_us, prob_data,
-                          num_threads_);
+                                trial_ws.trial_xs[nsteps]);
+  TrajOptData &prob_data = trial_ws.problem_data;
+  return problem.evaluate(trial_ws.trial_xs, trial_ws.trial_us, prob_data,
+                          num_threads);
 }
 
 template <typename Scalar>
@@ -164,6 +175,7 @@ void SolverProxDDPTpl<Scalar>::setup(const Problem &problem) {
   }
 
   results_ = Results(problem);
+  best_iterate_ = results_;
   workspace_ = Workspace(problem, allocator_);
   if (workspace_.get_allocator() != allocator_) {
     ALIGATOR_RUNTIME_ERROR("Solver workspace has wrong allocator.");
@@ -176,10 +188,6 @@ void SolverProxDDPTpl<Scalar>::setup(const Problem &problem) {
     break;
   }
   case LQSolverChoice::PARALLEL: {
-    if (rollout_type_ == RolloutType::NONLINEAR) {
-      ALIGATOR_RUNTIME_ERROR(
-          "Nonlinear rollouts not supported with the parallel solver.");
-    }
 #ifndef ALIGATOR_MULTITHREADING
     ALIGATOR_RUNTIME_ERROR(
         "Aligator was not compiled with OpenMP support. The parallel Riccati "
@@ -196,6 +204,22 @@ void SolverProxDDPTpl<Scalar>::setup(const Problem &problem) {
   }
   }
   filter_.resetFilter(0.0, ls_params.alpha_min, ls_params.max_num_steps);
+  has_warm_state_ = false;
+  derivatives_time_ = lq_solve_time_ = trial_eval_time_ = 0.;
+
+  ls_lanes_.clear();
+  if (speculative_ls_lanes > 1) {
+    if (sa_strategy_ == StepAcceptanceStrategy::LINESEARCH_ARMIJO &&
+        ls_params.interp_type != LSInterpolation::BISECTION) {
+      ALIGATOR_WARNING("SolverProxDDP",
+                       "Speculative linesearch lanes evaluate bisection steps, "
+                       "most interpolated Armijo steps will miss them.\n");
+    }
+    ls_lanes_.reserve(speculative_ls_lanes);
+    for (size_t k = 0; k < speculative_ls_lanes; k++) {
+      ls_lanes_.push_back(SpeculativeLane{Workspace::trialPoint(problem)});
+    }
+  }
 }
 
 template <typename Scalar>
@@ -203,9 +227,15 @@ void SolverProxDDPTpl<Scalar>::cycleProblem(const Problem &problem,
                                             const shared_ptr<StageData> &data) {
   ALIGATOR_TRACY_ZONE_SCOPED;
   results_.cycleAppend(problem, problem.getInitState());
+  best_iterate_.cycleAppend(problem, problem.getInitState());
   const auto nsteps = workspace_.nsteps;
   workspace_.cycleAppend(problem, data);
   linear_solver_->cycleAppend(workspace_.lqr_problem.stages[nsteps - 1]);
+  for (SpeculativeLane &lane : ls_lanes_) {
+    lane.workspace.cycleAppend(problem,
+                               problem.stages_[nsteps - 1]->createData());
+    lane.ready = false;
+  }
 }
 
 template <typename... VArgs> bool is_nan_any(const VArgs &...args) {
@@ -219,22 +249,23 @@ template <typename... VArgs> bool is_nan_any(const VArgs &...args) {
 template <typename Scalar>
 bool SolverProxDDPTpl<Scalar>::computeMultipliers(
     const Problem &problem, const std::vector<VectorXs> &xs,
-    const std::vector<VectorXs> &lams, const std::vector<VectorXs> &vs) {
+    const std::vector<VectorXs> &lams, const std::vector<VectorXs> &vs,
+    Workspace &trial_ws, Scalar &prim_infeas) const {
   ALIGATOR_TRACY_ZONE_SCOPED;
   using BlkView = BlkMatrix<VectorRef, -1, 1>;
 
-  const TrajOptData &prob_data = workspace_.problem_data;
+  const TrajOptData &prob_data = trial_ws.problem_data;
   const size_t nsteps = workspace_.nsteps;
 
-  std::vector<VectorXs> &lams_plus = workspace_.lams_plus;
+  std::vector<VectorXs> &lams_plus = trial_ws.lams_plus;
 
   const std::vector<VectorXs> &vs_prev = workspace_.prev_vs;
-  std::vector<VectorXs> &vs_plus = workspace_.vs_plus;
+  std::vector<VectorXs> &vs_plus = trial_ws.vs_plus;
 
-  std::vector<VectorXs> &Lvs = workspace_.Lvs;
-  std::vector<VectorXs> &shifted_constraints = workspace_.shifted_constraints;
-  std::vector<VectorXs> &stage_infeas = workspace_.stage_infeasibilities;
-  std::vector<VectorXs> &fs = workspace_.dyn_slacks;
+  std::vector<VectorXs> &Lvs = trial_ws.Lvs;
+  std::vector<VectorXs> &shifted_constraints = trial_ws.shifted_constraints;
+  std::vector<VectorXs> &stage_infeas = trial_ws.stage_infeasibilities;
+  std::vector<VectorXs> &fs = trial_ws.dyn_slacks;
 
   assert(Lvs.size() == vs_prev.size());
   assert(Lvs.size() == nsteps + 1);
@@ -277,15 +308,14 @@ bool SolverProxDDPTpl<Scalar>::computeMultipliers(
     shifted_constraints[i] += mu() * vs_prev[i];
     op.normalConeProjection(shifted_constraints[i], vs_plus[i]);
     op.computeActiveSet(shifted_constraints[i],
-                        workspace_.active_constraints[i]);
+                        trial_ws.active_constraints[i]);
     Lvs[i] = vs_plus[i];
     Lvs[i].noalias() -= mu() * vs[i];
     vs_plus[i] = mu_inv() * vs_plus[i];
     assert(Lvs[i].size() == stage.nc());
 
     stage_infeas[i] = mu() * (vs_plus[i] - vs_prev[i]);
-    workspace_.stage_cstr_violations[long(i)] =
-        math::infty_norm(stage_infeas[i]);
+    trial_ws.stage_cstr_violations[long(i)] = math::infty_norm(stage_infeas[i]);
     RET_FALSE_IF_NAN(Lvs[i]);
   }
 
@@ -301,19 +331,19 @@ bool SolverProxDDPTpl<Scalar>::computeMultipliers(
     shifted_constraints[nsteps] += mu() * vs_prev[nsteps];
     op.normalConeProjection(shifted_constraints[nsteps], vs_plus[nsteps]);
     op.computeActiveSet(shifted_constraints[nsteps],
-                        workspace_.active_constraints[nsteps]);
+                        trial_ws.active_constraints[nsteps]);
     Lvs[nsteps] = vs_plus[nsteps];
     Lvs[nsteps].noalias() -= mu() * vs[nsteps];
     vs_plus[nsteps] = mu_inv() * vs_plus[nsteps];
     assert(Lvs[nsteps].size() == cstr_stack.totalDim());
 
     stage_infeas[nsteps] = mu() * (vs_plus[nsteps] - vs_prev[nsteps]);
-    workspace_.stage_cstr_violations[long(nsteps)] =
+    trial_ws.stage_cstr_violations[long(nsteps)] =
         math::infty_norm(stage_infeas[nsteps]);
     RET_FALSE_IF_NAN(Lvs[nsteps]);
   }
-  results_.prim_infeas = std::max(math::infty_norm(stage_infeas),
-                                  math::infty_norm(workspace_.dyn_slacks));
+  prim_infeas = std::max(math::infty_norm(stage_infeas),
+                         math::infty_norm(trial_ws.dyn_slacks));
   return true;
 }
 
@@ -323,33 +353,96 @@ bool SolverProxDDPTpl<Scalar>::computeMultipliers(
 // C. Forward pass
 template <typename Scalar>
 Scalar SolverProxDDPTpl<Scalar>::tryNonlinearRollout(const Problem &problem,
-                                                     const Scalar alpha) {
+                                                     const Scalar alpha,
+                                                     Workspace &trial_ws,
+                                                     const size_t num_threads) {
+  ALIGATOR_TRACY_ZONE_SCOPED;
+  const size_t nsteps = workspace_.nsteps;
+  TrajOptData &prob_data = trial_ws.problem_data;
+
+  if (linear_solver_choice == LQSolverChoice::PARALLEL) {
+#ifdef ALIGATOR_MULTITHREADING
+    // Multiple shooting: each leg of the parallel LQ solver is rolled out
+    // starting from its linear step. The legs run concurrently unless this is
+    // a speculative linesearch lane (single thread), which is itself run in a
+    // parallel region and must not change the Eigen thread count.
+    using ParallelSolver = gar::ParallelRiccatiSolver<Scalar>;
+    const auto *par_solver =
+        static_cast<const ParallelSolver *>(linear_solver_.get());
+    const uint num_legs = par_solver->getNumThreads();
+    const bool parallel_legs = num_threads > 1;
+    const uint num_leg_threads = parallel_legs ? num_legs : 1;
+    std::exception_ptr leg_error;
+    const int prev_nb_threads = Eigen::nbThreads();
+    if (parallel_legs)
+      Eigen::setNbThreads(1);
+#pragma omp parallel for num_threads(num_leg_threads) schedule(static, 1)
+    for (uint i = 0; i < num_legs; i++) {
+      const gar::workrange_t leg = par_solver->getLegRange(i);
+      try {
+        nonlinearRolloutLeg(problem, alpha, trial_ws, leg.beg, leg.end,
+                            par_solver);
+      } catch (...) {
+#pragma omp critical
+        leg_error = std::current_exception();
+      }
+    }
+    if (parallel_legs)
+      Eigen::setNbThreads(prev_nb_threads);
+    if (leg_error)
+      std::rethrow_exception(leg_error);
+#endif
+  } else {
+    nonlinearRolloutLeg(problem, alpha, trial_ws, 0, nsteps + 1);
+  }
+
+  prob_data.cost_ = computeTrajectoryCost(prob_data);
+  return prob_data.cost_;
+}
+
+template <typename Scalar>
+void SolverProxDDPTpl<Scalar>::nonlinearRolloutLeg(
+    const Problem &problem, const Scalar alpha, Workspace &trial_ws,
+    const size_t t0, const size_t t1,
+    [[maybe_unused]] const gar::ParallelRiccatiSolver<Scalar> *par_solver) {
   ALIGATOR_TRACY_ZONE_SCOPED;
   using gar::StageFactor;
 
   const size_t nsteps = workspace_.nsteps;
-  std::vector<VectorXs> &xs = workspace_.trial_xs;
-  std::vector<VectorXs> &us = workspace_.trial_us;
-  std::vector<VectorXs> &vs = workspace_.trial_vs;
-  std::vector<VectorXs> &lams = workspace_.trial_lams;
-  std::vector<VectorXs> &dxs = workspace_.dxs;
-  std::vector<VectorXs> &dus = workspace_.dus;
-  std::vector<VectorXs> &dvs = workspace_.dvs;
-  std::vector<VectorXs> &dlams = workspace_.dlams;
-
-  TrajOptData &prob_data = workspace_.problem_data;
+  std::vector<VectorXs> &xs = trial_ws.trial_xs;
+  std::vector<VectorXs> &us = trial_ws.trial_us;
+  std::vector<VectorXs> &vs = trial_ws.trial_vs;
+  std::vector<VectorXs> &lams = trial_ws.trial_lams;
+  std::vector<VectorXs> &dxs = trial_ws.dxs;
+  std::vector<VectorXs> &dus = trial_ws.dus;
+  std::vector<VectorXs> &dvs = trial_ws.dvs;
+  const std::vector<VectorXs> &dlams = workspace_.dlams;
+
+  TrajOptData &prob_data = trial_ws.problem_data;
+
+  // Legs which do not reach the end of the horizon are parameterized by the
+  // costate step at their end.
+  const VectorXs *dtheta = nullptr;
+#ifdef ALIGATOR_MULTITHREADING
+  if (par_solver && t1 <= nsteps)
+    dtheta = &dlams[t1];
+#endif
 
   {
-    const StageModel &stage = *problem.stages_[0];
-    // use lams[0] as a tmp var for alpha * dx0
-    lams[0] = alpha * dxs[0];
-    stage.xspace().integrate(results_.xs[0], lams[0], xs[0]);
-    lams[0] = results_.lams[0] + alpha * dlams[0];
-
-    ALIGATOR_RAISE_IF_NAN_NAME(xs[0], fmt::format("xs[{:d}]", 0));
+    const ManifoldAbstractTpl<Scalar> &space =
+        t0 < nsteps ? problem.stages_[t0]->xspace()
+                    : problem.stages_[t0 - 1]->xspace_next();
+    // use lams[t0] as a tmp var for alpha * dx0
+    lams[t0] = alpha * workspace_.dxs[t0];
+    space.integrate(results_.xs[t0], lams[t0], xs[t0]);
+    lams[t0] = results_.lams[t0] + alpha * dlams[t0];
+
+    ALIGATOR_RAISE_IF_NAN_NAME(xs[t0], fmt::format("xs[{:d}]", t0));
+    if (t0 == 0)
+      problem.init_constraint_->evaluate(xs[0], *prob_data.init_data);
   }
 
-  for (size_t t = 0; t < nsteps; t++) {
+  for (size_t t = t0; t < std::min(t1, nsteps); t++) {
     const StageModel &stage = *problem.stages_[t];
     StageData &data = *prob_data.stage_data[t];
 
@@ -363,25 +456,53 @@ Scalar SolverProxDDPTpl<Scalar>::tryNonlinearRollout(const Problem &problem,
     ConstMatrixRef Kfb = fb.blockRow(0);
     ConstMatrixRef Zfb = fb.blockRow(1);
 
-    dus[t] = alpha * kff;
-    dus[t].noalias() += Kfb * dxs[t];
-    stage.uspace().integrate(results_.us[t], dus[t], us[t]);
+    // The state deviation at the start of a leg is the (scaled) LQ step, except
+    // at the initial state.
+    const VectorXs &dx = (t == t0) ? workspace_.dxs[t] : dxs[t];
+    const Scalar dx_scale = (t == t0 && t > 0) ? alpha : Scalar(1.);
 
+    dus[t] = alpha * kff;
+    dus[t].noalias() += dx_scale * Kfb * dx;
     dvs[t] = alpha * zff;
-    dvs[t].noalias() += Zfb * dxs[t];
+    dvs[t].noalias() += dx_scale * Zfb * dx;
+#ifdef ALIGATOR_MULTITHREADING
+    if (dtheta) {
+      const StageFactor<Scalar> &fac = par_solver->datas[t];
+      ConstMatrixRef Kth = fac.fth.blockRow(0);
+      dus[t].noalias() += alpha * Kth * (*dtheta);
+      dvs[t].noalias() += alpha * fac.fth.blockRow(1) * (*dtheta);
+      if (t == 0) {
+        // The control gain of the first knot was collapsed with the
+        // dependence -Up1t * dx0 of the costate step on the initial state:
+        // remove it from the costate step.
+        const auto &Up1t = par_solver->condensedKktSystem.subdiagonal[1];
+        auto Up1t_dx = trial_ws.costate_corr.head(Up1t.rows());
+        Up1t_dx.noalias() = Up1t * dx;
+        dus[t].noalias() += alpha * Kth * Up1t_dx;
+      }
+    }
+#endif
+
+    stage.uspace().integrate(results_.us[t], dus[t], us[t]);
     vs[t] = results_.vs[t] + dvs[t];
 
     stage.evaluate(xs[t], us[t], data);
+    ALIGATOR_RAISE_IF_NAN_NAME(us[t], fmt::format("us[{:d}]", t));
+    if (t + 1 == t1)
+      break; // next state belongs to the next leg
+
     xs[t + 1] = data.dynamics_data->xnext_;
 
     stage.xspace_next().difference(results_.xs[t + 1], xs[t + 1], dxs[t + 1]);
     lams[t + 1] = results_.lams[t + 1] + alpha * dlams[t + 1];
 
     ALIGATOR_RAISE_IF_NAN_NAME(xs[t + 1], fmt::format("xs[{:d}]", t + 1));
-    ALIGATOR_RAISE_IF_NAN_NAME(us[t], fmt::format("us[{:d}]", t));
     ALIGATOR_RAISE_IF_NAN_NAME(lams[t + 1], fmt::format("lams[{:d}]", t + 1));
   }
 
+  if (t1 <= nsteps)
+    return;
+
   // TERMINAL NODE
   problem.term_cost_->evaluate(xs[nsteps], problem.unone_,
                                *prob_data.term_cost_data);
@@ -406,13 +527,12 @@ Scalar SolverProxDDPTpl<Scalar>::tryNonlinearRollout(const Problem &problem,
     ConstVectorRef zff = ff.blockSegment(1);
     ConstMatrixRef Zfb = fb.blockRow(1);
 
+    const VectorXs &dx = (t0 == nsteps) ? workspace_.dxs[nsteps] : dxs[nsteps];
+    const Scalar dx_scale = (t0 == nsteps && t0 > 0) ? alpha : Scalar(1.);
     dvs[nsteps] = alpha * zff;
-    dvs[nsteps].noalias() += Zfb * dxs[nsteps];
+    dvs[nsteps].noalias() += dx_scale * Zfb * dx;
     vs[nsteps] = results_.vs[nsteps] + dvs[nsteps];
   }
-
-  prob_data.cost_ = computeTrajectoryCost(prob_data);
-  return prob_data.cost_;
 }
 
 // Main loop of the Algorithm 2 detailed in section II. Background
@@ -423,6 +543,7 @@ bool SolverProxDDPTpl<Scalar>::run(const Problem &problem,
                                    const std::vector<VectorXs> &us_init,
                                    const std::vector<VectorXs> &vs_init,
                                    const std::vector<VectorXs> &lams_init) {
+  deadline_.start(time_limit_);
 
   if (sync_dual_tol_)
     target_dual_tol_ = target_tol_;
@@ -431,6 +552,12 @@ bool SolverProxDDPTpl<Scalar>::run(const Problem &problem,
   if (!workspace_.isInitialized() || !results_.isInitialized()) {
     ALIGATOR_RUNTIME_ERROR("workspace and results were not allocated yet!");
   }
+  // constant derivatives are computed once per solve, since the model may have
+  // changed since the last one
+  workspace_.problem_data.resetConstantDerivatives(true);
+  workspace_.lqr_constant_dynamics_ready = false;
+  for (SpeculativeLane &lane : ls_lanes_)
+    lane.workspace.problem_data.resetConstantDerivatives(true);
   if (mu_init_ < bcl_params.mu_lower_bound) {
     ALIGATOR_WARNING("SolverProxDDP",
                      "Initial value of mu_init < mu_lower_bound ({:.3g})\n",
@@ -438,8 +565,15 @@ bool SolverProxDDPTpl<Scalar>::run(const Problem &problem,
     setAlmPenalty(mu_init_);
   }
 
-  check_initial_guess_and_assign(problem, xs_init, us_init, results_.xs,
-                                 results_.us);
+  // warm start: keep the ALM penalty, regularization, BCL tolerances and the
+  // (cycled) primal-dual iterate from the previous solve.
+  const bool warm_start = warm_start_ && has_warm_state_;
+  if (!warm_start || !xs_init.empty())
+    check_initial_guess_and_assign(problem, xs_init, us_init, results_.xs,
+                                   results_.us);
+  else if (problem.initCondIsStateError())
+    // the initial state may have been set after cycleProblem()
+    results_.xs[0] = problem.getInitState();
   const bool v_was_resized =
       !vs_init.empty() && !assign_no_resize(vs_init, results_.vs);
   const bool l_was_resized =
@@ -457,21 +591,27 @@ bool SolverProxDDPTpl<Scalar>::run(const Problem &problem,
   logger.active = (verbose_ > 0);
   logger.printHeadline();
 
-  setAlmPenalty(mu_init_);
-
   workspace_.prev_xs = results_.xs;
   workspace_.prev_us = results_.us;
   workspace_.prev_vs = results_.vs;
 
-  inner_tol_ = inner_tol0;
-  prim_tol_ = prim_tol0;
-  preg_last_ = 0.;
-  updateTolsOnFailure();
+  if (!warm_start) {
+    setAlmPenalty(mu_init_);
+    inner_tol_ = inner_tol0;
+    prim_tol_ = prim_tol0;
+    preg_last_ = 0.;
+    updateTolsOnFailure();
+  }
 
   inner_tol_ = std::max(inner_tol_, target_dual_tol_);
   prim_tol_ = std::max(prim_tol_, target_tol_);
 
   bool &conv = results_.conv = false;
+  results_.timed_out = false;
+  results_.gains_stale = false;
+  has_best_iterate_ = false;
+  results_.stats.reset();
+  const size_t bytes_allocated0 = memory_resource_.bytes_allocated();
 
   results_.al_iter = 0;
   results_.num_iters = 0;
@@ -526,6 +666,9 @@ bool SolverProxDDPTpl<Scalar>::run(const Problem &problem,
     al_iter++;
   }
 
+  has_warm_state_ = true;
+  results_.stats.bytes_allocated =
+      memory_resource_.bytes_allocated() - bytes_allocated0;
   logger.finish(conv);
   return conv;
 }
@@ -535,47 +678,130 @@ bool SolverProxDDPTpl<Scalar>::run(const Problem &problem,
 template <typename Scalar>
 Scalar SolverProxDDPTpl<Scalar>::forwardPass(const Problem &problem,
                                              const Scalar alpha) {
+  if (!ls_lanes_.empty())
+    return speculativeForwardPass(problem, alpha);
+  return forwardPass(problem, alpha, workspace_, num_threads_,
+                     results_.prim_infeas);
+}
+
+template <typename Scalar>
+Scalar SolverProxDDPTpl<Scalar>::forwardPass(const Problem &problem,
+                                             const Scalar alpha,
+                                             Workspace &trial_ws,
+                                             const size_t num_threads,
+                                             Scalar &prim_infeas) {
   ALIGATOR_TRACY_ZONE_SCOPED;
   switch (rollout_type_) {
   case RolloutType::LINEAR:
-    tryLinearStep(problem, alpha);
+    tryLinearStep(problem, alpha, trial_ws, num_threads);
     break;
   case RolloutType::NONLINEAR:
-    tryNonlinearRollout(problem, alpha);
+    tryNonlinearRollout(problem, alpha, trial_ws, num_threads);
     break;
   }
-  if (!computeMultipliers(problem, workspace_.trial_xs, workspace_.trial_lams,
-                          workspace_.trial_vs))
+  if (!computeMultipliers(problem, trial_ws.trial_xs, trial_ws.trial_lams,
+                          trial_ws.trial_vs, trial_ws, prim_infeas))
     ALIGATOR_RUNTIME_ERROR(
         "computeMultipliers() returned false. NaN or Inf detected.");
-  return ALFunction<Scalar>::evaluate(mu_dyn(), mu(), problem, workspace_);
+  return ALFunction<Scalar>::evaluate(mu_dyn(), mu(), problem, trial_ws);
+}
+
+template <typename Scalar>
+Scalar SolverProxDDPTpl<Scalar>::speculativeForwardPass(const Problem &problem,
+                                                        const Scalar alpha) {
+  ALIGATOR_TRACY_ZONE_SCOPED;
+  auto lane = std::find_if(ls_lanes_.begin(), ls_lanes_.end(),
+                           [alpha](const SpeculativeLane &l) {
+                             return l.ready && (l.alpha == alpha);
+                           });
+  if (lane == ls_lanes_.end()) {
+    // Miss: evaluate alpha and the next bisection steps, which are the ones
+    // requested by the backtracking procedures, skipping steps below alpha_min.
+    Scalar a = alpha;
+    for (SpeculativeLane &l : ls_lanes_) {
+      l.alpha = a;
+      l.ready = (&l == &ls_lanes_[0]) || (a >= ls_params.alpha_min);
+      results_.stats.num_ls_lane_evals += l.ready;
+      a *= 0.5;
+    }
+    const long num_lanes = long(ls_lanes_.size());
+#pragma omp parallel for num_threads(num_lanes) schedule(static, 1)
+    for (long k = 0; k < num_lanes; k++) {
+      SpeculativeLane &l = ls_lanes_[size_t(k)];
+      if (!l.ready)
+        continue;
+      // exceptions cannot leave the parallel region: they are kept and
+      // rethrown if the step size of the lane is requested
+      try {
+        l.phi = forwardPass(problem, l.alpha, l.workspace, 1, l.prim_infeas);
+        l.error = nullptr;
+      } catch (...) {
+        l.error = std::current_exception();
+      }
+    }
+    lane = ls_lanes_.begin();
+  } else {
+    results_.stats.num_ls_lane_hits++;
+  }
+
+  lane->ready = false;
+  if (lane->error)
+    std::rethrow_exception(lane->error);
+  workspace_.swapTrialPoint(lane->workspace);
+  results_.prim_infeas = lane->prim_infeas;
+  return lane->phi;
 }
 
 template <typename Scalar>
 bool SolverProxDDPTpl<Scalar>::innerLoop(const Problem &problem) {
   ALIGATOR_TRACY_ZONE_NAMED(InnerLoop, true);
 
+  // set when the time budget cannot fit another trial point: the remaining
+  // linesearch steps are rejected without being evaluated.
+  bool ls_timed_out = false;
+  SolverStats &stats = results_.stats;
+  auto timed_forward_pass = [&](Scalar a0) -> Scalar {
+    if (!deadline_.fits(trial_eval_time_)) {
+      ls_timed_out = true;
+      return std::numeric_limits<Scalar>::infinity();
+    }
+    Stopwatch trial_sw;
+    stats.num_merit_evals++;
+    const Scalar phi = forwardPass(problem, a0);
+    trial_eval_time_ = trial_sw.lap();
+    return phi;
+  };
+
   auto merit_eval_fun = [&](Scalar a0) -> Scalar {
-    return forwardPass(problem, a0);
+    return timed_forward_pass(a0);
   };
 
   auto pair_eval_fun = [&](Scalar a0) -> std::pair<Scalar, Scalar> {
     ALIGATOR_TRACY_ZONE_NAMED_N(FilterPairEval, "pair_eval_fun", true);
     std::pair<Scalar, Scalar> fpair;
-    fpair.first = forwardPass(problem, a0);
-    fpair.second = results_.prim_infeas;
+    fpair.first = timed_forward_pass(a0);
+    fpair.second = ls_timed_out ? std::numeric_limits<Scalar>::infinity()
+                                : results_.prim_infeas;
     return fpair;
   };
 
   size_t &iter = results_.num_iters;
+  Stopwatch sw;
   results_.traj_cost_ = problem.evaluate(results_.xs, results_.us,
                                          workspace_.problem_data, num_threads_);
+  stats.evaluate += sw.lap();
   computeMultipliers(problem, results_.xs, results_.lams, results_.vs);
   results_.merit_value_ =
       ALFunction<Scalar>::evaluate(mu_dyn(), mu(), problem, workspace_);
+  stats.multipliers += sw.lap();
 
   for (; iter < max_iters; iter++) {
     ALIGATOR_TRACY_ZONE_NAMED_N(ZoneIteration, "inner_iteration", true);
+    if (!deadline_.fits(derivatives_time_)) {
+      restoreBestIterate();
+      return false;
+    }
+    sw.lap();
     // ASSUMPTION: last evaluation in previous iterate
     // was during linesearch, at the current candidate solution (x,u).
     /// TODO: make this smarter using e.g. some caching mechanism
@@ -593,6 +819,8 @@ bool SolverProxDDPTpl<Scalar>::innerLoop(const Problem &problem) {
       workspace_.Lxs[0].setZero();
     }
     computeCriterion();
+    derivatives_time_ = sw.lap();
+    stats.derivatives += derivatives_time_;
 
     // exit if either the subproblem or overall problem converged
     const bool overall_converged = (results_.dual_infeas <= target_dual_tol_) &&
@@ -600,12 +828,20 @@ bool SolverProxDDPTpl<Scalar>::innerLoop(const Problem &problem) {
     if ((workspace_.inner_criterion <= inner_tol_) || overall_converged)
       return true;
 
+    // the step needs the LQ solve and at least one trial point
+    if (!deadline_.fits(lq_solve_time_ + trial_eval_time_)) {
+      restoreBestIterate();
+      return false;
+    }
+    sw.lap();
     computeProjectedJacobians(problem, mu_inv(), workspace_);
     initializeRegularization();
     updateLQSubproblem();
+    const double assembly_time = sw.lap();
 
     // Solve the LQ subproblem.
     linear_solver_->backward(mu());
+    const double backward_time = sw.lap();
 
     linear_solver_->forward(workspace_.dxs, workspace_.dus, workspace_.dvs,
                             workspace_.dlams);
@@ -632,12 +868,19 @@ bool SolverProxDDPTpl<Scalar>::innerLoop(const Problem &problem) {
       fb = linear_solver_->getFeedback(N).bottomRows(fb.rows());
     }
 
+    updateBestIterate();
+
     if (force_initial_condition_) {
       workspace_.dxs[0].setZero();
       workspace_.dlams[0].setZero();
     }
     const Scalar dphi0 = ALFunction<Scalar>::directionalDerivative(
         mu_dyn(), mu(), problem, workspace_);
+    const double forward_time = sw.lap();
+    lq_solve_time_ = assembly_time + backward_time + forward_time;
+    stats.lq_assembly += assembly_time;
+    stats.backward += backward_time;
+    stats.forward += forward_time;
     ALIGATOR_RAISE_IF_NAN(dphi0);
 
     // check if we can early stop
@@ -647,6 +890,8 @@ bool SolverProxDDPTpl<Scalar>::innerLoop(const Problem &problem) {
     // otherwise continue linesearch
     Scalar alpha_opt = 1;
     Scalar phi_new;
+    const Scalar prim_infeas0 = results_.prim_infeas;
+    resetSpeculativeLanes();
 
     switch (sa_strategy_) {
     case StepAcceptanceStrategy::LINESEARCH_ARMIJO:
@@ -660,6 +905,14 @@ bool SolverProxDDPTpl<Scalar>::innerLoop(const Problem &problem) {
       assert(false && "unknown StepAcceptanceStrategy!");
       break;
     }
+    stats.linesearch += sw.lap();
+
+    if (ls_timed_out) {
+      // reject the step
+      results_.prim_infeas = prim_infeas0;
+      restoreBestIterate();
+      return false;
+    }
 
     // accept the step
     results_.xs = workspace_.trial_xs;
@@ -691,6 +944,7 @@ bool SolverProxDDPTpl<Scalar>::innerLoop(const Problem &problem) {
       if (preg_ >= reg_max)
         return false;
       increaseRegularization();
+      stats.num_reg_increases++;
     }
     this->invokeCallbacks();
     logger.log();
@@ -700,6 +954,34 @@ bool SolverProxDDPTpl<Scalar>::innerLoop(const Problem &problem) {
   return false;
 }
 
+template <typename Scalar> void SolverProxDDPTpl<Scalar>::updateBestIterate() {
+  // infeasibilities below the target tolerance are all feasible
+  const Scalar infeas = std::max(results_.prim_infeas, target_tol_);
+  const Scalar best_infeas = std::max(best_iterate_.prim_infeas, target_tol_);
+  if (has_best_iterate_ &&
+      (infeas > best_infeas || (infeas == best_infeas &&
+                                results_.merit_value_ >=
+                                    best_iterate_.merit_value_)))
+    return;
+  best_iterate_.copyIterate(results_);
+  best_iterate_.vs = results_.vs;
+  best_iterate_.lams = results_.lams;
+  has_best_iterate_ = true;
+}
+
+template <typename Scalar>
+void SolverProxDDPTpl<Scalar>::restoreBestIterate() {
+  results_.timed_out = true;
+  if (!has_best_iterate_) {
+    // no gains were computed during this run
+    results_.gains_stale = true;
+    return;
+  }
+  results_.copyIterate(best_iterate_);
+  results_.vs = best_iterate_.vs;
+  results_.lams = best_iterate_.lams;
+}
+
 template <typename Scalar> void SolverProxDDPTpl<Scalar>::computeCriterion() {
   ALIGATOR_NOMALLOC_SCOPED;
   ALIGATOR_TRACY_ZONE_SCOPED;
@@ -754,8 +1036,11 @@ template <typename Scalar> void SolverProxDDPTpl<Scalar>::updateLQSubproblem() {
     uint nu = knot.nu;
     uint nc = knot.nc;
 
-    knot.A = dd.Jx();
-    knot.B = dd.Ju();
+    if (!workspace_.lqr_constant_dynamics_ready ||
+        !sd.constant_dynamics_jacobians) {
+      knot.A = dd.Jx();
+      knot.B = dd.Ju();
+    }
     knot.f = dyn_slacks[t + 1];
 
     knot.Q = cd.Lxx_;
@@ -778,6 +1063,9 @@ template <typename Scalar> void SolverProxDDPTpl<Scalar>::updateLQSubproblem() {
     knot.C.topRows(nc) = workspace_.cstr_proj_jacs[t].blockCol(0);
     knot.D.topRows(nc) = workspace_.cstr_proj_jacs[t].blockCol(1);
     knot.d.head(nc) = workspace_.Lvs[t];
+    // the rows of the inactive constraints were zeroed by the projection,
+    // they are left out of the stage KKT system
+    knot.setActiveRows(workspace_.active_constraints[t]);
 
     // correct right-hand side
     knot.q.head(nx) += workspace_.cstr_lx_corr[t];
@@ -802,6 +1090,7 @@ template <typename Scalar> void SolverProxDDPTpl<Scalar>::updateLQSubproblem() {
 
   LqrKnotTpl<Scalar> &model = prob.stages[0];
   model.Q += id.Hxx_;
+  workspace_.lqr_constant_dynamics_ready = pd.cache_constant_derivatives;
 }
 
 } // namespace aligator
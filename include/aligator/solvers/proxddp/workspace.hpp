@@ -42,6 +42,9 @@ template <typename Scalar> struct WorkspaceTpl : WorkspaceBaseTpl<Scalar> {
   using allocator_type = ::aligator::polymorphic_allocator;
 
   gar::LqrProblemTpl<Scalar> lqr_problem; //< Linear-quadratic subproblem
+  /// Whether the constant dynamics Jacobians were copied into lqr_problem
+  /// during the current solve.
+  bool lqr_constant_dynamics_ready = false;
 
   /// @name Lagrangian Gradients
   /// @{
@@ -87,6 +90,9 @@ template <typename Scalar> struct WorkspaceTpl : WorkspaceBaseTpl<Scalar> {
   std::vector<VectorXs> dvs;
   std::vector<VectorXs> dlams;
   /// @}
+  /// Initial state step mapped to the costate at the end of the first leg of
+  /// the parallel nonlinear rollout, sized for the largest knot.
+  VectorXs costate_corr;
 
   /// @name Previous external/proximal iterates
   /// @{
@@ -122,14 +128,38 @@ template <typename Scalar> struct WorkspaceTpl : WorkspaceBaseTpl<Scalar> {
   WorkspaceTpl(WorkspaceTpl &&) = default;
   WorkspaceTpl &operator=(WorkspaceTpl &&) = default;
 
+  /// @brief Workspace holding only the buffers written when evaluating a trial
+  /// point: those exchanged by swapTrialPoint(), and the steps of the
+  /// nonlinear rollout. The LQ subproblem, Lagrangian gradients, projected
+  /// Jacobians and previous iterates are left empty.
+  static WorkspaceTpl trialPoint(const TrajOptProblemTpl<Scalar> &problem);
+
+  /// Whether this workspace was created by trialPoint().
+  bool isTrialPoint() const { return lqr_problem.stages.empty(); }
+
   void cycleAppend(const TrajOptProblemTpl<Scalar> &problem,
                    shared_ptr<StageDataTpl<Scalar>> data);
 
+  /// @brief Swap the buffers written when evaluating a trial point (trial
+  /// primal-dual variables, problem data, multiplier estimates and constraint
+  /// residuals) with those of another workspace for the same problem.
+  /// @details This is a constant-time operation which does not touch the
+  /// search direction or the LQ subproblem.
+  void swapTrialPoint(WorkspaceTpl &other) noexcept;
+
   allocator_type get_allocator() const { return lqr_problem.get_allocator(); }
 
   friend std::ostream &operator<<(std::ostream &oss, const WorkspaceTpl &self) {
     return oss << fmt::format("{}", self);
   }
+
+private:
+  struct trial_point_tag {};
+  WorkspaceTpl(const TrajOptProblemTpl<Scalar> &problem, trial_point_tag);
+  /// Size the trial point buffers and the steps.
+  void initTrialPoint(const TrajOptProblemTpl<Scalar> &problem);
+  /// Size the scratch of the nonlinear rollout after the steps.
+  void initRolloutScratch();
 };
 
 #ifdef ALIGATOR_ENABLE_TEMPLATE_INSTANTIATION
@@ -63,6 +63,7 @@ WorkspaceTpl<Scalar>::WorkspaceTpl(const TrajOptProblemTpl<Scalar> &problem,
 
     cstr_product_sets.emplace_back(getConstraintProductSet(stage.constraints_));
     cstr_proj_jacs[i] = BlkJacobianType(stack.dims(), {ndx1, nu});
+    cstr_proj_jacs[i].setZero();
     active_constraints[i].setZero(ncstr);
   }
 
@@ -73,6 +74,7 @@ WorkspaceTpl<Scalar>::WorkspaceTpl(const TrajOptProblemTpl<Scalar> &problem,
     cstr_product_sets.emplace_back(
         getConstraintProductSet(problem.term_cstrs_));
     cstr_proj_jacs[nsteps] = BlkJacobianType(stack.dims(), {ndx1, 0});
+    cstr_proj_jacs[nsteps].setZero();
     active_constraints[nsteps].setZero(stack.totalDim());
   }
 
@@ -87,12 +89,62 @@ WorkspaceTpl<Scalar>::WorkspaceTpl(const TrajOptProblemTpl<Scalar> &problem,
   Lvs = dvs;
   cstr_lx_corr = Lxs;
   cstr_lu_corr = Lus;
+  initRolloutScratch();
 
   stage_inner_crits.setZero();
   state_dual_infeas.setZero();
   control_dual_infeas.setZero();
 }
 
+template <typename Scalar>
+WorkspaceTpl<Scalar>::WorkspaceTpl(const TrajOptProblemTpl<Scalar> &problem,
+                                   trial_point_tag)
+    : Base(problem)
+    , stage_cstr_violations(nsteps + 1) {
+  stage_cstr_violations.setZero();
+  initTrialPoint(problem);
+}
+
+template <typename Scalar>
+WorkspaceTpl<Scalar>
+WorkspaceTpl<Scalar>::trialPoint(const TrajOptProblemTpl<Scalar> &problem) {
+  return WorkspaceTpl(problem, trial_point_tag{});
+}
+
+template <typename Scalar>
+void WorkspaceTpl<Scalar>::initTrialPoint(
+    const TrajOptProblemTpl<Scalar> &problem) {
+  problem.initializeSolution(trial_xs, trial_us, trial_vs, trial_lams);
+  vs_plus = trial_vs;
+  lams_plus = trial_lams;
+  dyn_slacks = trial_lams;
+  Lvs = trial_vs;
+  shifted_constraints = trial_vs;
+  stage_infeasibilities = trial_vs;
+
+  // same dimensions as the LQ subproblem variables
+  dxs.resize(nsteps + 1);
+  dus.resize(nsteps);
+  dvs = trial_vs;
+  active_constraints.resize(nsteps + 1);
+  for (size_t i = 0; i < nsteps; i++) {
+    const StageModel &stage = *problem.stages_[i];
+    dxs[i].setZero(stage.ndx1());
+    dus[i].setZero(stage.nu());
+    active_constraints[i].setZero(stage.nc());
+  }
+  dxs[nsteps].setZero(internal::problem_last_ndx_helper(problem));
+  active_constraints[nsteps].setZero(problem.term_cstrs_.totalDim());
+  initRolloutScratch();
+}
+
+template <typename Scalar> void WorkspaceTpl<Scalar>::initRolloutScratch() {
+  Eigen::Index ndx_max = 0;
+  for (const VectorXs &dx : dxs)
+    ndx_max = std::max(ndx_max, dx.size());
+  costate_corr.setZero(ndx_max);
+}
+
 template <typename Scalar>
 void WorkspaceTpl<Scalar>::cycleAppend(const TrajOptProblemTpl<Scalar> &problem,
                                        shared_ptr<StageDataTpl<Scalar>> data) {
@@ -105,6 +157,13 @@ void WorkspaceTpl<Scalar>::cycleAppend(const TrajOptProblemTpl<Scalar> &problem,
   if (!problem.checkIntegrity())
     ALIGATOR_RUNTIME_ERROR("Problem failed integrity check.");
 
+  if (isTrialPoint()) {
+    // the trial point is overwritten by the next evaluation
+    stage_cstr_violations.setZero();
+    initTrialPoint(problem);
+    return;
+  }
+
   rotate_vec_left(trial_xs, 1);
   rotate_vec_left(trial_us, 1);
   rotate_vec_left(trial_vs, 0, 1);
@@ -136,6 +195,7 @@ void WorkspaceTpl<Scalar>::cycleAppend(const TrajOptProblemTpl<Scalar> &problem,
   rotate_vec_left(cstr_proj_jacs, 0, 1);
   cstr_proj_jacs[nsteps - 1] =
       BlkJacobianType(stage.constraints_.dims(), {stage.ndx1(), stage.nu()});
+  cstr_proj_jacs[nsteps - 1].setZero();
   rotate_vec_left(active_constraints, 0, 1);
   active_constraints[nsteps - 1].setZero(stage.nc());
 
@@ -148,10 +208,29 @@ void WorkspaceTpl<Scalar>::cycleAppend(const TrajOptProblemTpl<Scalar> &problem,
   Lvs = dvs;
   cstr_lx_corr = Lxs;
   cstr_lu_corr = Lus;
+  initRolloutScratch();
 
   stage_inner_crits.setZero();
   state_dual_infeas.setZero();
   control_dual_infeas.setZero();
 }
 
+template <typename Scalar>
+void WorkspaceTpl<Scalar>::swapTrialPoint(WorkspaceTpl &other) noexcept {
+  using std::swap;
+  swap(problem_data, other.problem_data);
+  swap(trial_xs, other.trial_xs);
+  swap(trial_us, other.trial_us);
+  swap(trial_vs, other.trial_vs);
+  swap(trial_lams, other.trial_lams);
+  swap(dyn_slacks, other.dyn_slacks);
+  swap(lams_plus, other.lams_plus);
+  swap(vs_plus, other.vs_plus);
+  swap(Lvs, other.Lvs);
+  swap(shifted_constraints, other.shifted_constraints);
+  swap(active_constraints, other.active_constraints);
+  swap(stage_infeasibilities, other.stage_infeasibilities);
+  swap(stage_cstr_violations, other.stage_cstr_violations);
+}
+
 } // namespace aligator
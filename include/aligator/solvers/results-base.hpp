@@ -3,6 +3,7 @@
 #pragma once
 
 #include "aligator/context.hpp"
+#include "aligator/solvers/solver-stats.hpp"
 #include <fmt/format.h>
 
 namespace aligator {
@@ -18,6 +19,14 @@ protected:
 public:
   std::size_t num_iters = 0;
   bool conv = false;
+  /// Whether the solver stopped because its time budget ran out.
+  bool timed_out = false;
+  /// Whether the budget ran out before any gains were computed during the
+  /// run: the gains are then those of the previous run, not of the returned
+  /// iterate.
+  bool gains_stale = false;
+  /// Per-phase timings and counters of the last run.
+  SolverStats stats;
 
   Scalar traj_cost_ = 0.;
   Scalar merit_value_ = 0.;
@@ -57,6 +66,18 @@ public:
     return this->gains_[i].rightCols(this->get_ndx1(i));
   }
 
+  /// @brief Copy the iterate of @p other: states, controls, gains and their
+  /// cost, merit and infeasibility measures.
+  void copyIterate(const ResultsBaseTpl &other) {
+    xs = other.xs;
+    us = other.us;
+    gains_ = other.gains_;
+    traj_cost_ = other.traj_cost_;
+    merit_value_ = other.merit_value_;
+    prim_infeas = other.prim_infeas;
+    dual_infeas = other.dual_infeas;
+  }
+
   std::vector<MatrixXs> getCtrlFeedbacks() const {
     const std::size_t N = us.size();
     std::vector<MatrixXs> out;
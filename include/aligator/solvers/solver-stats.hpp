@@ -0,0 +1,57 @@
+/// @file
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include <cstddef>
+
+namespace aligator {
+
+/// @brief Per-phase timings and counters of the last solver run.
+/// @details Timings are wall-clock durations in seconds, accumulated over the
+/// iterations of run(). The phases are disjoint: evaluations of trial points
+/// (rollout, cost, constraints and multipliers) are accounted for in
+/// #linesearch only. Phases a solver does not have stay at zero, e.g. FDDP
+/// assembles its LQ subproblem within the backward pass and its only forward
+/// pass is the linesearch rollout.
+struct SolverStats {
+  /// Problem evaluation at the current iterate.
+  double evaluate = 0.;
+  /// Derivatives, Lagrangian gradient and convergence criterion.
+  double derivatives = 0.;
+  /// Multiplier estimates at the current iterate.
+  double multipliers = 0.;
+  /// Assembly of the LQ subproblem.
+  double lq_assembly = 0.;
+  /// Backward pass (factorization).
+  double backward = 0.;
+  /// Forward pass of the LQ solver (search direction and gains).
+  double forward = 0.;
+  /// Step acceptance, including all trial point evaluations.
+  double linesearch = 0.;
+  /// Number of trial points requested by the step acceptance procedure. With
+  /// speculative linesearch lanes, see #num_ls_lane_evals for the number of
+  /// trial points actually evaluated.
+  std::size_t num_merit_evals = 0;
+  /// Number of trial points served by a speculative linesearch lane evaluated
+  /// ahead of the request (ProxDDP with `speculative_ls_lanes > 1`).
+  std::size_t num_ls_lane_hits = 0;
+  /// Number of trial points evaluated by the speculative linesearch lanes,
+  /// including those which were never requested.
+  std::size_t num_ls_lane_evals = 0;
+  /// Number of primal regularization increases. The solvers increase the
+  /// regularization after a failed step rather than refactorizing.
+  std::size_t num_reg_increases = 0;
+  /// Bytes requested from the solver's memory resource during run(). Always
+  /// zero for FDDP, which does not allocate through a memory resource.
+  std::size_t bytes_allocated = 0;
+
+  void reset() noexcept { *this = SolverStats{}; }
+
+  /// Sum of the phase timings.
+  double total() const noexcept {
+    return evaluate + derivatives + multipliers + lq_assembly + backward +
+           forward + linesearch;
+  }
+};
+
+} // namespace aligator
@@ -0,0 +1,82 @@
+/// @file
+/// @brief Wall-clock budget and stopwatch for the solvers.
+/// @copyright Copyright (C) 2026 INRIA
+#pragma once
+
+#include <chrono>
+#include <limits>
+
+namespace aligator {
+
+/// @brief  Deadline measured on a monotonic clock.
+/// @details A non-positive budget disables the deadline: it then never expires
+/// and every phase fits.
+class Deadline {
+public:
+  using clock = std::chrono::steady_clock;
+  using time_point = clock::time_point;
+
+  /// @brief Start the clock with a budget of @p seconds.
+  void start(const double seconds) noexcept {
+    start_ = clock::now();
+    enabled_ = seconds > 0.;
+    if (enabled_)
+      end_ = start_ + toDuration(seconds);
+  }
+
+  bool enabled() const noexcept { return enabled_; }
+
+  /// Time elapsed since start(), in seconds.
+  double elapsed() const noexcept { return secondsSince(start_); }
+
+  /// Time left before the deadline, in seconds.
+  double remaining() const noexcept {
+    if (!enabled_)
+      return std::numeric_limits<double>::infinity();
+    return std::chrono::duration<double>(end_ - clock::now()).count();
+  }
+
+  /// @brief Whether a phase expected to last @p seconds ends before the
+  /// deadline.
+  bool fits(const double seconds) const noexcept {
+    return !enabled_ || (clock::now() + toDuration(seconds) <= end_);
+  }
+
+  bool expired() const noexcept { return enabled_ && (clock::now() >= end_); }
+
+  /// Seconds elapsed since time point @p t0.
+  static double secondsSince(const time_point &t0) noexcept {
+    return std::chrono::duration<double>(clock::now() - t0).count();
+  }
+
+private:
+  static clock::duration toDuration(const double seconds) noexcept {
+    return std::chrono::duration_cast<clock::duration>(
+        std::chrono::duration<double>(seconds));
+  }
+
+  time_point start_{};
+  time_point end_{};
+  bool enabled_ = false;
+};
+
+/// @brief Stopwatch on the same monotonic clock as Deadline.
+class Stopwatch {
+public:
+  Stopwatch() noexcept
+      : t0_(Deadline::clock::now()) {}
+
+  /// @brief Seconds elapsed since construction or the previous lap(), then
+  /// restart.
+  double lap() noexcept {
+    const auto t1 = Deadline::clock::now();
+    const double dt = std::chrono::duration<double>(t1 - t0_).count();
+    t0_ = t1;
+    return dt;
+  }
+
+private:
+  Deadline::time_point t0_;
+};
+
+} // namespace aligator
@@ -4,6 +4,8 @@
 namespace aligator {
 
 void *mimalloc_resource ::do_allocate(size_t bytes, size_t alignment) {
+  if (count_bytes_)
+    bytes_allocated_.fetch_add(bytes, std::memory_order_relaxed);
   return mi_malloc_aligned(bytes, alignment);
 }
 
@@ -0,0 +1,8 @@
+#include "aligator/modelling/centroidal/multi-contact-friction-cone.hxx"
+
+namespace aligator {
+
+template struct MultiContactFrictionConeResidualTpl<context::Scalar>;
+template struct MultiContactFrictionConeDataTpl<context::Scalar>;
+
+} // namespace aligator
@@ -0,0 +1,8 @@
+#include "aligator/modelling/centroidal/multi-contact-wrench-cone.hxx"
+
+namespace aligator {
+
+template struct MultiContactWrenchConeResidualTpl<context::Scalar>;
+template struct MultiContactWrenchConeDataTpl<context::Scalar>;
+
+} // namespace aligator
@@ -0,0 +1,9 @@
+/// @copyright Copyright (C) 2026 INRIA
+#include "aligator/modelling/dynamics/integrator-rk23.hxx"
+
+namespace aligator::dynamics {
+
+template struct IntegratorRK23Tpl<context::Scalar>;
+template struct IntegratorRK23DataTpl<context::Scalar>;
+
+} // namespace aligator::dynamics
@@ -0,0 +1,9 @@
+/// @copyright Copyright (C) 2026 INRIA
+#include "aligator/modelling/dynamics/integrator-rk4.hxx"
+
+namespace aligator::dynamics {
+
+template struct IntegratorRK4Tpl<context::Scalar>;
+template struct IntegratorRK4DataTpl<context::Scalar>;
+
+} // namespace aligator::dynamics
@@ -0,0 +1,9 @@
+/// @file
+/// @copyright Copyright (C) 2026 INRIA
+#include "aligator/modelling/multibody/kinematics-cache.hxx"
+
+namespace aligator {
+
+template struct KinematicsCacheTpl<context::Scalar>;
+
+} // namespace aligator
@@ -0,0 +1,8 @@
+#include "aligator/modelling/multibody/multi-frame-collision.hxx"
+
+namespace aligator {
+
+template struct MultiFrameCollisionResidualTpl<context::Scalar>;
+template struct MultiFrameCollisionDataTpl<context::Scalar>;
+
+} // namespace aligator
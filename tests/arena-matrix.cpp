@@ -22,6 +22,29 @@ static_assert(!alloc_traits::propagate_on_container_swap());
 aligator::mimalloc_resource g_res;
 polymorphic_allocator g_alloc{&g_res};
 
+TEST_CASE("mimalloc_resource_bytes") {
+  REQUIRE_FALSE(g_res.counts_bytes());
+  REQUIRE(g_res.bytes_allocated() == 0);
+
+  aligator::mimalloc_resource res{true};
+  void *p = res.allocate(64);
+  REQUIRE(res.bytes_allocated() == 64);
+
+  // copies keep the count, and count on their own afterwards
+  aligator::mimalloc_resource res_copy{res};
+  REQUIRE(res_copy.counts_bytes());
+  REQUIRE(res_copy.bytes_allocated() == 64);
+  void *q = res_copy.allocate(32);
+  REQUIRE(res_copy.bytes_allocated() == 96);
+  REQUIRE(res.bytes_allocated() == 64);
+
+  res_copy = g_res;
+  REQUIRE_FALSE(res_copy.counts_bytes());
+  REQUIRE(res_copy.bytes_allocated() == 0);
+  res.deallocate(p, 64);
+  res.deallocate(q, 32);
+}
+
 TEST_CASE("managed_matrix_create_copy") {
   AllocMatrixType a{10, 10, g_alloc};
   REQUIRE(a.get_allocator() == g_alloc);
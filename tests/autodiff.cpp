@@ -0,0 +1,163 @@
+/// @file
+/// @copyright Copyright (C) 2026 INRIA
+#include "aligator/modelling/autodiff/forward-mode.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+
+using namespace aligator;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+using Dual = autodiff::DualTpl<double, 2>;
+
+namespace {
+constexpr int NX = 12;
+constexpr int NU = 5;
+
+/// Chain of coupled elements: each entry depends on its neighbours and on
+/// one control.
+struct Chain {
+  template <typename X, typename U, typename Out>
+  void operator()(const X &x, const U &u, Out &out) const {
+    using std::exp;
+    using std::sin;
+    using T = typename Out::Scalar;
+    for (int i = 0; i < NX; i++) {
+      const T prev = i > 0 ? T(sin(x[i - 1])) : T(0.);
+      const T next = i + 1 < NX ? T(sin(x[i + 1])) : T(0.);
+      out[i] = prev - 2. * sin(x[i]) + next + u[i % NU] * exp(-x[i] * x[i]);
+    }
+  }
+};
+
+/// Discrete dynamics stepping along the chain.
+struct ChainStep {
+  template <typename X, typename U, typename Out>
+  void operator()(const X &x, const U &u, Out &out) const {
+    Out r(NX);
+    Chain()(x, u, r);
+    out = x + 0.1 * r / (1. + r.squaredNorm());
+  }
+};
+
+/// Jacobian \f$[J_x\ J_u]\f$ of the chain.
+MatrixXd chainJacobian(const VectorXd &x, const VectorXd &u) {
+  MatrixXd J = MatrixXd::Zero(NX, NX + NU);
+  for (int i = 0; i < NX; i++) {
+    const double e = std::exp(-x[i] * x[i]);
+    if (i > 0)
+      J(i, i - 1) = std::cos(x[i - 1]);
+    if (i + 1 < NX)
+      J(i, i + 1) = std::cos(x[i + 1]);
+    J(i, i) = -2. * std::cos(x[i]) - 2. * x[i] * u[i % NU] * e;
+    J(i, NX + i % NU) = e;
+  }
+  return J;
+}
+} // namespace
+
+TEST_CASE("dual_elementary_functions", "[autodiff]") {
+  const Dual a(0.3, Eigen::Vector2d(1., 0.));
+  const Dual b(1.7, Eigen::Vector2d(0., 1.));
+  using std::atan2;
+  using std::exp;
+  using std::pow;
+  using std::sin;
+  using std::sqrt;
+
+  // f(a, b) = sin(a) exp(b) / (1 + a^2) + b^3 + atan2(a, b) + sqrt(a b)
+  const Dual f = sin(a) * exp(b) / (1 + a * a) + pow(b, 3.) + atan2(a, b) +
+                 sqrt(a * b);
+  const double av = a.val, bv = b.val;
+  const double r2 = av * av + bv * bv;
+  const double dfa =
+      (std::cos(av) * (1 + av * av) - 2 * av * std::sin(av)) * std::exp(bv) /
+          ((1 + av * av) * (1 + av * av)) +
+      bv / r2 + 0.5 * std::sqrt(bv / av);
+  const double dfb = std::sin(av) * std::exp(bv) / (1 + av * av) +
+                     3 * bv * bv - av / r2 + 0.5 * std::sqrt(av / bv);
+  REQUIRE(f.der.isApprox(Eigen::Vector2d(dfa, dfb), 1e-12));
+
+  // comparisons and constants
+  REQUIRE(a < b);
+  REQUIRE(2. * a == 0.6);
+  REQUIRE((1. - a).der == -a.der);
+  REQUIRE((2. / b).der.isApprox(-2. / (bv * bv) * b.der));
+}
+
+TEST_CASE("dual_pow", "[autodiff]") {
+  using std::isfinite;
+  using std::pow;
+  using std::sqrt;
+  const Eigen::Vector2d dir(1., -2.);
+
+  // fractional exponents
+  const Dual a(0.7, dir);
+  for (double b : {0.5, 1.5, 2.5, -0.3}) {
+    const Dual p = pow(a, b);
+    REQUIRE(p.val == std::pow(0.7, b));
+    REQUIRE(p.der.isApprox(b * std::pow(0.7, b - 1) * dir, 1e-12));
+  }
+
+  // at zero, the value is exact
+  const Dual zero(0., dir);
+  REQUIRE(pow(zero, 0.5).val == 0.);
+  REQUIRE(sqrt(zero).val == 0.);
+  REQUIRE(pow(zero, 1.).val == 0.);
+  REQUIRE(pow(zero, 1.).der == dir);
+  REQUIRE(pow(zero, 1.5).val == 0.);
+  REQUIRE(pow(zero, 1.5).der.isZero(0.));
+  REQUIRE(pow(zero, 2.).der.isZero(0.));
+  REQUIRE(pow(zero, 0.).val == 1.);
+  REQUIRE(pow(zero, 0.).der.isZero(0.));
+  // no inf * 0 in the value of a constant
+  REQUIRE(isfinite(pow(Dual(0.), 0.5).val));
+}
+
+TEST_CASE("autodiff_function", "[autodiff]") {
+  const VectorXd x = VectorXd::Random(NX);
+  const VectorXd u = VectorXd::Random(NU);
+  const MatrixXd J = chainJacobian(x, u);
+
+  // the chunks do not divide the number of columns
+  auto func = autodiff::makeAutoDiffFunction<double, 4>(NX, NU, NX, Chain());
+  auto data = func.createData();
+  func.evaluate(x, u, *data);
+  func.computeJacobians(x, u, *data);
+  VectorXd value(NX);
+  Chain()(x, u, value);
+  REQUIRE(data->value_.isApprox(value));
+  REQUIRE(data->jac_buffer_.isApprox(J, 1e-12));
+
+  // the default chunk covers the controls in a single evaluation
+  auto func8 = autodiff::makeAutoDiffFunction<double>(NX, NU, NX, Chain());
+  auto data8 = func8.createData();
+  func8.computeJacobians(x, u, *data8);
+  REQUIRE(data8->jac_buffer_.isApprox(J, 1e-12));
+}
+
+TEST_CASE("autodiff_dynamics", "[autodiff]") {
+  const VectorXd x = VectorXd::Random(NX);
+  const VectorXd u = VectorXd::Random(NU);
+
+  auto dyn = autodiff::makeAutoDiffDynamics<double>(NX, NU, ChainStep());
+  auto data = dyn.createData();
+  dyn.forward(x, u, *data);
+  dyn.dForward(x, u, *data);
+
+  // central differences
+  const double eps = 1e-6;
+  MatrixXd J(NX, NX + NU);
+  VectorXd xp(NX), xm(NX);
+  for (int c = 0; c < NX + NU; c++) {
+    VectorXd dx = VectorXd::Zero(NX), du = VectorXd::Zero(NU);
+    (c < NX ? dx[c] : du[c - NX]) = eps;
+    ChainStep()(x + dx, u + du, xp);
+    ChainStep()(x - dx, u - du, xm);
+    J.col(c) = (xp - xm) / (2 * eps);
+  }
+  ChainStep()(x, u, xp);
+  REQUIRE(data->xnext_.isApprox(xp));
+  REQUIRE(data->jac_buffer_.isApprox(J, 1e-7));
+}
@@ -0,0 +1,109 @@
+/// @file
+/// @copyright Copyright (C) 2026 INRIA
+#include "aligator/modelling/centroidal/centroidal-friction-cone.hpp"
+#include "aligator/modelling/centroidal/centroidal-wrench-cone.hpp"
+#include "aligator/modelling/centroidal/multi-contact-friction-cone.hpp"
+#include "aligator/modelling/centroidal/multi-contact-wrench-cone.hpp"
+#include "aligator/modelling/autodiff/finite-difference.hpp"
+#include "aligator/core/vector-space.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace aligator;
+using Eigen::VectorXd;
+
+using VectorSpace = VectorSpaceTpl<double>;
+using CentroidalFrictionConeResidual = CentroidalFrictionConeResidualTpl<double>;
+using CentroidalWrenchConeResidual = CentroidalWrenchConeResidualTpl<double>;
+using MultiContactFrictionConeResidual =
+    MultiContactFrictionConeResidualTpl<double>;
+using MultiContactWrenchConeResidual =
+    MultiContactWrenchConeResidualTpl<double>;
+
+namespace {
+constexpr int NX = 9;
+constexpr double MU = 0.7;
+
+/// Compare the Jacobians of @p func to finite differences.
+template <typename Func>
+void checkFiniteDifferences(const Func &func, const VectorXd &x,
+                            const VectorXd &u) {
+  auto data = func.createData();
+  func.evaluate(x, u, *data);
+  func.computeJacobians(x, u, *data);
+
+  autodiff::FiniteDifferenceHelper<double> fd(VectorSpace(NX), func, 1e-7);
+  auto fd_data = fd.createData();
+  fd.evaluate(x, u, *fd_data);
+  fd.computeJacobians(x, u, *fd_data);
+  REQUIRE(fd_data->value_.isApprox(data->value_));
+  REQUIRE(fd_data->jac_buffer_.isApprox(data->jac_buffer_, 1e-5));
+}
+} // namespace
+
+TEST_CASE("multi_contact_friction_cone", "[centroidal]") {
+  const int nk = 4;
+  const int nu = 3 * nk;
+  const double eps = 1e-3;
+  // out of order, and contact 1 left out
+  const std::vector<int> ids{2, 0, 3};
+  const int nc = int(ids.size());
+  const VectorXd x = VectorXd::Random(NX);
+  const VectorXd u = VectorXd::Random(nu);
+
+  MultiContactFrictionConeResidual multi(NX, nu, ids, MU, eps);
+  auto data = multi.createData();
+  multi.evaluate(x, u, *data);
+  multi.computeJacobians(x, u, *data);
+  REQUIRE(data->value_.size() == 2 * nc);
+
+  // the conditions are stacked by kind: normal forces, then cones
+  for (int i = 0; i < nc; i++) {
+    CentroidalFrictionConeResidual single(NX, nu, ids[size_t(i)], MU, eps);
+    auto sdata = single.createData();
+    single.evaluate(x, u, *sdata);
+    single.computeJacobians(x, u, *sdata);
+    const Eigen::Vector2i rows(i, nc + i);
+    REQUIRE(data->value_(rows).isApprox(sdata->value_));
+    REQUIRE(data->jac_buffer_(rows, Eigen::all).isApprox(sdata->jac_buffer_));
+  }
+
+  checkFiniteDifferences(multi, x, u);
+}
+
+TEST_CASE("multi_contact_wrench_cone", "[centroidal]") {
+  const int nk = 3;
+  const int nu = 6 * nk;
+  const double hL = 0.1, hW = 0.05;
+  const std::vector<int> ids{1, 2, 0};
+  const int nc = int(ids.size());
+  const VectorXd x = VectorXd::Random(NX);
+  const VectorXd u = VectorXd::Random(nu);
+
+  MultiContactWrenchConeResidual multi(NX, nu, ids, MU, hL, hW);
+  REQUIRE(multi.hasConstantJacobians());
+  auto data = multi.createData();
+  multi.evaluate(x, u, *data);
+  multi.computeJacobians(x, u, *data);
+  REQUIRE(data->value_.size() == 17 * nc);
+
+  // one block of 17 rows per contact
+  for (int i = 0; i < nc; i++) {
+    CentroidalWrenchConeResidual single(NX, nu, ids[size_t(i)], MU, hL, hW);
+    auto sdata = single.createData();
+    single.evaluate(x, u, *sdata);
+    single.computeJacobians(x, u, *sdata);
+    REQUIRE(data->value_.segment(17 * i, 17).isApprox(sdata->value_));
+    REQUIRE(data->jac_buffer_.middleRows(17 * i, 17)
+                .isApprox(sdata->jac_buffer_));
+  }
+
+  checkFiniteDifferences(multi, x, u);
+}
+
+TEST_CASE("multi_contact_cone_indices", "[centroidal]") {
+  REQUIRE_THROWS(MultiContactFrictionConeResidual(NX, 6, {}, MU, 0.));
+  REQUIRE_THROWS(MultiContactFrictionConeResidual(NX, 6, {0, 2}, MU, 0.));
+  REQUIRE_THROWS(MultiContactWrenchConeResidual(NX, 12, {-1}, MU, 0.1, 0.1));
+  REQUIRE_THROWS(MultiContactWrenchConeResidual(NX, 12, {2}, MU, 0.1, 0.1));
+}
@@ -8,6 +8,15 @@
 using namespace aligator;
 using namespace aligator::context;
 
+/// Box whose projection is overridden.
+struct ShiftedBox : BoxConstraintTpl<double> {
+  using BoxConstraintTpl<double>::BoxConstraintTpl;
+  void projection(const ConstVectorRef &z, VectorRef zout) const override {
+    BoxConstraintTpl<double>::projection(z, zout);
+    zout.array() += 1.;
+  }
+};
+
 const int N = 20;
 VectorSpace space(N);
 
@@ -45,3 +54,75 @@ TEST_CASE("constraint_product_op", "[constraint]") {
 
   REQUIRE(z.isApprox(zCopy));
 }
+
+TEST_CASE("constraint_product_flat", "[constraint]") {
+  EqualityConstraintTpl<double> eq_op;
+  NegativeOrthantTpl<double> neg_op;
+  const long n1 = 2, n2 = 3, n3 = 4;
+  const VectorXs lower = -VectorXs::Constant(n3, 0.5);
+  const VectorXs upper = VectorXs::Constant(n3, 0.3);
+  BoxConstraintTpl<double> box_op(lower, upper);
+  ConstraintSetProductTpl<double> op({eq_op, box_op, neg_op}, {n1, n3, n2});
+  REQUIRE(op.isFlat());
+
+  // the product is not flat as soon as one set is not a box
+  ConstraintSetProductTpl<double> op_l1(
+      {eq_op, NonsmoothPenaltyL1Tpl<double>(), neg_op}, {n1, n3, n2});
+  REQUIRE(!op_l1.isFlat());
+  // nor if a set is a subclass of a box, which may override its projections
+  const ShiftedBox shifted_op(lower, upper);
+  ConstraintSetProductTpl<double> op_shifted({eq_op, shifted_op, neg_op},
+                                             {n1, n3, n2});
+  REQUIRE(!op_shifted.isFlat());
+
+  const long nr = n1 + n2 + n3;
+  VectorXs z = VectorXs::Random(nr);
+  z[1] = 0.;
+  VectorXs zproj(nr), zexp(nr);
+
+  op.projection(z, zproj);
+  eq_op.projection(z.head(n1), zexp.head(n1));
+  box_op.projection(z.segment(n1, n3), zexp.segment(n1, n3));
+  neg_op.projection(z.tail(n2), zexp.tail(n2));
+  REQUIRE(zproj.isApprox(zexp));
+
+  op.normalConeProjection(z, zproj);
+  eq_op.normalConeProjection(z.head(n1), zexp.head(n1));
+  box_op.normalConeProjection(z.segment(n1, n3), zexp.segment(n1, n3));
+  neg_op.normalConeProjection(z.tail(n2), zexp.tail(n2));
+  REQUIRE(zproj.isApprox(zexp));
+
+  using ActiveType = ConstraintSetTpl<double>::ActiveType;
+  ActiveType active(nr), active_exp(nr);
+  op.computeActiveSet(z, active);
+  eq_op.computeActiveSet(z.head(n1), active_exp.head(n1));
+  box_op.computeActiveSet(z.segment(n1, n3), active_exp.segment(n1, n3));
+  neg_op.computeActiveSet(z.tail(n2), active_exp.tail(n2));
+  REQUIRE(active == active_exp);
+
+  const MatrixXs J = MatrixXs::Random(nr, 5);
+  MatrixXs Jout = J, Jexp = J;
+  op.applyNormalConeProjectionJacobian(z, Jout);
+  eq_op.applyNormalConeProjectionJacobian(z.head(n1), Jexp.topRows(n1));
+  box_op.applyNormalConeProjectionJacobian(z.segment(n1, n3),
+                                           Jexp.middleRows(n1, n3));
+  neg_op.applyNormalConeProjectionJacobian(z.tail(n2), Jexp.bottomRows(n2));
+  REQUIRE(Jout == Jexp);
+
+  Jout = J;
+  Jexp = J;
+  op.applyProjectionJacobian(z, Jout);
+  eq_op.applyProjectionJacobian(z.head(n1), Jexp.topRows(n1));
+  box_op.applyProjectionJacobian(z.segment(n1, n3), Jexp.middleRows(n1, n3));
+  neg_op.applyProjectionJacobian(z.tail(n2), Jexp.bottomRows(n2));
+  REQUIRE(Jout == Jexp);
+
+  // the generic path still projects each block with its own set
+  op_l1.normalConeProjection(z, zproj);
+  REQUIRE(zproj.head(n1).isApprox(z.head(n1)));
+  REQUIRE(zproj.tail(n2).isApprox(z.tail(n2).cwiseMax(0.)));
+
+  op_shifted.projection(z, zproj);
+  shifted_op.projection(z.segment(n1, n3), zexp.segment(n1, n3));
+  REQUIRE(zproj.segment(n1, n3).isApprox(zexp.segment(n1, n3)));
+}
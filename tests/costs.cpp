@@ -5,6 +5,7 @@
 #include "aligator/modelling/costs/sum-of-costs.hpp"
 
 #include "aligator/modelling/costs/quad-state-cost.hpp"
+#include "aligator/modelling/costs/quad-costs.hpp"
 
 #ifdef ALIGATOR_WITH_PINOCCHIO
 #include "aligator/modelling/spaces/pinocchio-groups.hpp"
@@ -17,10 +18,12 @@ using context::MatrixXs;
 using context::VectorXs;
 using QuadraticResidualCost = QuadraticResidualCostTpl<T>;
 using StateError = StateErrorResidualTpl<T>;
+using ControlError = ControlErrorResidualTpl<T>;
 #ifdef ALIGATOR_WITH_PINOCCHIO
 using SE2 = SETpl<2, T>;
 #endif
 using context::VectorSpace;
+using Manifold = ManifoldAbstractTpl<T>;
 
 void fd_test(VectorXs x0, VectorXs u0, MatrixXs weights,
              QuadraticResidualCost qres, shared_ptr<CostData> data) {
@@ -115,6 +118,131 @@ TEST_CASE("quad_state_highdim", "[costs]") {
   }
 }
 
+TEST_CASE("quad_residual_jacobian_pattern", "[costs]") {
+  const int ndx = 40;
+  const int nu = 3;
+  const VectorSpace space(ndx);
+  const ControlError ctrl(ndx, VectorXs::Random(nu));
+  const StateError state(space, nu, space.rand());
+  REQUIRE(ctrl.jac_pattern.x_size == 0);
+  REQUIRE(ctrl.jac_pattern.u_size == nu);
+  REQUIRE(state.jac_pattern.x_size == ndx);
+  REQUIRE(state.jac_pattern.u_size == 0);
+
+  auto check = [&](const auto &sparse) {
+    REQUIRE_FALSE(sparse.jac_pattern.isDense(ndx, nu));
+    auto dense = sparse;
+    dense.jac_pattern = JacobianPattern(ndx, nu);
+    const MatrixXs A = MatrixXs::Random(sparse.nr, sparse.nr);
+    const MatrixXs W =
+        A * A.transpose() + MatrixXs::Identity(sparse.nr, sparse.nr);
+    const QuadraticResidualCost cost(space, sparse, W);
+    const QuadraticResidualCost cost_dense(space, dense, W);
+    auto data = cost.createData();
+    auto data_dense = cost_dense.createData();
+
+    for (int k = 0; k < 5; k++) {
+      const VectorXs x = space.rand();
+      const VectorXs u = VectorXs::Random(nu);
+      fd_test(x, u, W, cost, data);
+      cost_dense.evaluate(x, u, *data_dense);
+      cost_dense.computeGradients(x, u, *data_dense);
+      cost_dense.computeHessians(x, u, *data_dense);
+      REQUIRE(data->value_ == data_dense->value_);
+      REQUIRE(data->grad_.isApprox(data_dense->grad_));
+      REQUIRE(data->hess_.isApprox(data_dense->hess_));
+    }
+  };
+  check(ctrl);
+  check(state);
+}
+
+/// The state cost only forms the products with the non-Euclidean block of
+/// the Jacobian, compare with those of the generic quadratic residual cost.
+void check_quad_state_structure(const xyz::polymorphic<Manifold> &space) {
+  const int ndx = space->ndx();
+  const int nu = 2;
+  const MatrixXs A = MatrixXs::Random(ndx, ndx);
+  const MatrixXs W = A * A.transpose() + MatrixXs::Identity(ndx, ndx);
+  const StateError fun(space, nu, space->rand());
+  const QuadraticStateCostTpl<T> cost(fun, W);
+  const QuadraticResidualCost cost_ref(space, fun, W);
+  auto data = cost.createData();
+  auto data_ref = cost_ref.createData();
+
+  for (int k = 0; k < 5; k++) {
+    const VectorXs x = space->rand();
+    const VectorXs u = VectorXs::Random(nu);
+    cost.evaluate(x, u, *data);
+    cost.computeGradients(x, u, *data);
+    cost.computeHessians(x, u, *data);
+    cost_ref.evaluate(x, u, *data_ref);
+    cost_ref.computeGradients(x, u, *data_ref);
+    cost_ref.computeHessians(x, u, *data_ref);
+    REQUIRE(data->value_ == data_ref->value_);
+    REQUIRE(data->grad_.isApprox(data_ref->grad_));
+    REQUIRE(data->hess_.isApprox(data_ref->hess_));
+  }
+}
+
+TEST_CASE("quad_state_euclidean_tail", "[costs]") {
+  check_quad_state_structure(VectorSpace(12));
+#ifdef ALIGATOR_WITH_PINOCCHIO
+  const xyz::polymorphic<Manifold> se2{SE2()};
+  const xyz::polymorphic<Manifold> vs{VectorSpace(4)};
+  check_quad_state_structure(se2 * vs);
+  check_quad_state_structure(vs * se2);
+#endif
+}
+
+TEST_CASE("cost_stack_stacked_gauss_newton", "[costs]") {
+  using CostStack = CostStackTpl<T>;
+  const int ndx = 12;
+  const int nu = 4;
+  const VectorSpace space(ndx);
+  auto randomWeights = [](const int n) -> MatrixXs {
+    const MatrixXs A = MatrixXs::Random(n, n);
+    return A * A.transpose() + MatrixXs::Identity(n, n);
+  };
+
+  CostStack cost(space, nu);
+  cost.addCost("x", QuadraticResidualCost(space,
+                                          StateError(space, nu, space.rand()),
+                                          randomWeights(ndx)),
+               0.5);
+  cost.addCost("u", QuadraticResidualCost(space,
+                                          ControlError(ndx, VectorXs::Zero(nu)),
+                                          randomWeights(nu)),
+               2.);
+  QuadraticResidualCost exact(space, StateError(space, nu, space.rand()),
+                              randomWeights(ndx));
+  exact.gauss_newton = false;
+  cost.addCost("exact", exact);
+  cost.addCost("quad", QuadraticCostTpl<T>(randomWeights(ndx),
+                                           randomWeights(nu)));
+
+  CostStack stacked(cost);
+  stacked.stacked_gauss_newton = true;
+  auto data = cost.createData();
+  auto stacked_data = stacked.createData();
+  const auto &sd = static_cast<const CostStackDataTpl<T> &>(*stacked_data);
+  REQUIRE(sd.stacked_jac.rows() == 2 * ndx + nu);
+
+  for (int k = 0; k < 5; k++) {
+    const VectorXs x = space.rand();
+    const VectorXs u = VectorXs::Random(nu);
+    for (auto [c, d] : {std::pair{&cost, data.get()},
+                        std::pair{&stacked, stacked_data.get()}}) {
+      c->evaluate(x, u, *d);
+      c->computeGradients(x, u, *d);
+      c->computeHessians(x, u, *d);
+    }
+    REQUIRE(stacked_data->value_ == data->value_);
+    REQUIRE(stacked_data->grad_.isApprox(data->grad_));
+    REQUIRE(stacked_data->hess_.isApprox(data->hess_));
+  }
+}
+
 #ifdef ALIGATOR_WITH_PINOCCHIO
 TEST_CASE("cost_stack", "[costs]") {
   using CostStack = CostStackTpl<T>;
@@ -135,3 +263,25 @@ TEST_CASE("cost_stack", "[costs]") {
   }
 }
 #endif
+
+TEST_CASE("cost_stack_stable_references", "[costs]") {
+  using CostStack = CostStackTpl<T>;
+  const int ndx = 6;
+  const int nu = 2;
+  const VectorSpace space(ndx);
+  CostStack cost(space, nu);
+  auto &item = cost.addCost(
+      "x0", QuadraticStateCostTpl<T>(space, nu, space.neutral(),
+                                     MatrixXs::Identity(ndx, ndx)));
+  const auto *pitem = &item;
+  // Enough insertions to force any contiguous storage to reallocate.
+  for (int i = 1; i < 64; i++) {
+    cost.addCost("x" + std::to_string(i),
+                 QuadraticStateCostTpl<T>(space, nu, space.rand(),
+                                          MatrixXs::Identity(ndx, ndx)));
+  }
+  REQUIRE(pitem == &cost.components_.at("x0"));
+  item.second = 3.;
+  REQUIRE(cost.getWeight("x0") == 3.);
+  REQUIRE(cost.getComponent<QuadraticStateCostTpl<T>>("x0") != nullptr);
+}
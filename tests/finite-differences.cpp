@@ -0,0 +1,140 @@
+/// @file
+/// @copyright Copyright (C) 2026 INRIA
+#include "aligator/modelling/autodiff/finite-difference.hpp"
+#include "aligator/core/vector-space.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace aligator;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+using StageFunction = StageFunctionTpl<double>;
+using StageFunctionData = StageFunctionDataTpl<double>;
+using ExplicitDynamics = ExplicitDynamicsModelTpl<double>;
+using ExplicitDynamicsData = ExplicitDynamicsDataTpl<double>;
+using VectorSpace = VectorSpaceTpl<double>;
+using autodiff::SparsityPattern;
+
+namespace {
+constexpr int NX = 12;
+constexpr int NU = 4;
+
+/// Chain of coupled elements: each entry depends on its neighbours and on
+/// one control.
+VectorXd chain(const VectorXd &x, const VectorXd &u) {
+  VectorXd r(x.size());
+  for (int i = 0; i < x.size(); i++) {
+    const double prev = i > 0 ? x[i - 1] : 0.;
+    const double next = i + 1 < x.size() ? x[i + 1] : 0.;
+    r[i] = std::sin(prev) - 2. * std::sin(x[i]) + std::sin(next) +
+           u[i % u.size()] * x[i];
+  }
+  return r;
+}
+
+struct ChainFunction : StageFunction {
+  ChainFunction()
+      : StageFunction(NX, NU, NX) {}
+
+  void evaluate(const ConstVectorRef &x, const ConstVectorRef &u,
+                StageFunctionData &data) const override {
+    data.value_ = chain(x, u);
+  }
+
+  void computeJacobians(const ConstVectorRef &, const ConstVectorRef &,
+                        StageFunctionData &) const override {}
+};
+
+struct ChainDynamics : ExplicitDynamics {
+  ChainDynamics()
+      : ExplicitDynamics(VectorSpace(NX), NU) {}
+
+  void forward(const ConstVectorRef &x, const ConstVectorRef &u,
+               ExplicitDynamicsData &data) const override {
+    data.xnext_ = x + 0.1 * chain(x, u);
+  }
+
+  void dForward(const ConstVectorRef &, const ConstVectorRef &,
+                ExplicitDynamicsData &) const override {}
+};
+
+SparsityPattern chainPattern() {
+  SparsityPattern pattern = SparsityPattern::Zero(NX, NX + NU);
+  for (int i = 0; i < NX; i++) {
+    pattern.block(std::max(i - 1, 0), i, std::min(i + 2, NX) -
+                                             std::max(i - 1, 0), 1)
+        .setConstant(true);
+    pattern(i, NX + i % NU) = true;
+  }
+  return pattern;
+}
+} // namespace
+
+TEST_CASE("finite_difference_coloring", "[finite_difference]") {
+  const SparsityPattern pattern = chainPattern();
+  const auto groups = autodiff::colorJacobianColumns(pattern);
+  // three colors for the tridiagonal block, one for the controls
+  REQUIRE(groups.size() == 4);
+  for (const auto &group : groups) {
+    for (std::size_t a = 0; a < group.size(); a++)
+      for (std::size_t b = a + 1; b < group.size(); b++)
+        REQUIRE_FALSE((pattern.col(group[a]).array() &&
+                       pattern.col(group[b]).array())
+                          .any());
+  }
+}
+
+TEST_CASE("finite_difference_function", "[finite_difference]") {
+  const VectorSpace space(NX);
+  const double eps = 1e-7;
+  const VectorXd x = VectorXd::Random(NX);
+  const VectorXd u = VectorXd::Random(NU);
+
+  autodiff::FiniteDifferenceHelper<double> dense(space, ChainFunction(), eps);
+  auto dense_data = dense.createData();
+  dense.evaluate(x, u, *dense_data);
+  dense.computeJacobians(x, u, *dense_data);
+  REQUIRE(dense.numColors() == NX + NU);
+
+  // the detected pattern matches the structure of the chain
+  REQUIRE(dense.computeSparsityPattern(x, u) == chainPattern());
+
+  autodiff::FiniteDifferenceHelper<double> colored(dense);
+  colored.setSparsityPattern(chainPattern());
+  REQUIRE(colored.numColors() == 4);
+  REQUIRE_THROWS(colored.setSparsityPattern(SparsityPattern(NX, NX)));
+  for (std::size_t num_threads : {1, 3}) {
+    colored.setNumThreads(num_threads);
+    auto data = colored.createData();
+    colored.evaluate(x, u, *data);
+    colored.computeJacobians(x, u, *data);
+    REQUIRE(data->jac_buffer_.isApprox(dense_data->jac_buffer_, 1e-6));
+  }
+}
+
+TEST_CASE("finite_difference_dynamics", "[finite_difference]") {
+  const VectorSpace space(NX);
+  const double eps = 1e-7;
+  const VectorXd x = VectorXd::Random(NX);
+  const VectorXd u = VectorXd::Random(NU);
+
+  autodiff::DynamicsFiniteDifferenceHelper<double> dense(space, ChainDynamics(),
+                                                         eps);
+  auto dense_data = dense.createData();
+  dense.forward(x, u, *dense_data);
+  dense.dForward(x, u, *dense_data);
+
+  // the dynamics add the identity to the pattern of the chain
+  const SparsityPattern pattern = dense.computeSparsityPattern(x, u);
+  REQUIRE(pattern == chainPattern());
+
+  autodiff::DynamicsFiniteDifferenceHelper<double> colored(dense);
+  colored.setSparsityPattern(pattern);
+  colored.setNumThreads(4);
+  auto data = colored.createData();
+  colored.forward(x, u, *data);
+  colored.dForward(x, u, *data);
+  REQUIRE(colored.numColors() == 4);
+  REQUIRE(data->jac_buffer_.isApprox(dense_data->jac_buffer_, 1e-6));
+}
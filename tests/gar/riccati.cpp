@@ -190,3 +190,57 @@ TEST_CASE("riccati_parametric", "[gar]") {
   REQUIRE_FALSE(check_value(solver.datas[horz].vm.Vxt));
   REQUIRE_FALSE(check_value(solver.datas[horz].vm.Vtt));
 }
+
+TEST_CASE("riccati_active_rows", "[gar]") {
+  std::mt19937 rng{Catch::getSeed()};
+  uint nx = 8;
+  uint nu = 4;
+  uint nc = 6;
+  uint horz = 20;
+  uint nth = GENERATE(0, 1);
+  VectorXs x0 = VectorXs::NullaryExpr(nx, normal_unary_op(rng));
+  auto problem =
+      generateLqProblem(rng, x0, horz, nx, nu, nth, nc, false, alloc);
+  const double mueq = 1e-4;
+
+  // every other row is inactive: its Jacobians are zero
+  Eigen::Matrix<bool, -1, 1> active(nc);
+  for (uint i = 0; i < nc; i++)
+    active[i] = (i % 2 == 0);
+  for (uint t = 0; t < horz; t++) {
+    knot_t &knot = problem.stages[t];
+    for (uint i = 0; i < nc; i++) {
+      if (!active[i]) {
+        knot.C.row(i).setZero();
+        knot.D.row(i).setZero();
+      }
+    }
+  }
+  VectorXs theta = VectorXs::Ones(nth);
+  std::optional<ConstVectorRef> th;
+  if (nth > 0)
+    th.emplace(theta);
+
+  ProximalRiccatiSolver solver_full{problem};
+  solver_full.backward(mueq);
+  auto [xs, us, vs, lbdas] = lqrInitializeSolution(problem);
+  solver_full.forward(xs, us, vs, lbdas, th);
+
+  for (uint t = 0; t < horz; t++)
+    problem.stages[t].setActiveRows(active);
+  REQUIRE(problem.stages[0].nca == nc / 2);
+  ProximalRiccatiSolver solver{problem};
+  solver.backward(mueq);
+  auto [xs2, us2, vs2, lbdas2] = lqrInitializeSolution(problem);
+  solver.forward(xs2, us2, vs2, lbdas2, th);
+
+  KktError err = computeKktError(problem, xs2, us2, vs2, lbdas2, th, mueq);
+  fmt::println("{}", err);
+  REQUIRE(err.max <= 1e-8);
+  for (uint t = 0; t <= horz; t++) {
+    REQUIRE(xs2[t].isApprox(xs[t], 1e-8));
+    REQUIRE(vs2[t].isApprox(vs[t], 1e-8));
+    if (t < horz)
+      REQUIRE(us2[t].isApprox(us[t], 1e-8));
+  }
+}
@@ -1,10 +1,73 @@
 #include "aligator/modelling/dynamics/integrator-euler.hpp"
+#include "aligator/modelling/dynamics/integrator-midpoint.hpp"
 #include "aligator/modelling/dynamics/integrator-rk2.hpp"
+#include "aligator/modelling/dynamics/integrator-rk4.hpp"
+#include "aligator/modelling/dynamics/integrator-rk23.hpp"
+#include "aligator/modelling/dynamics/linear-ode.hpp"
 #include "aligator/core/vector-space.hpp"
 
 #include <catch2/catch_test_macros.hpp>
 
 using Manifold = aligator::VectorSpaceTpl<double>;
+using namespace aligator::dynamics;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+/// Damped pendulum \f$\ddot{q} = -\sin q - b\dot{q} + u\f$.
+struct PendulumODE : ODEAbstractTpl<double> {
+  using Base = ODEAbstractTpl<double>;
+  double damping = 0.1;
+
+  PendulumODE()
+      : Base(::Manifold(2), 1) {}
+
+  void forward(const ConstVectorRef &x, const ConstVectorRef &u,
+               Data &data) const override {
+    data.xdot_[0] = x[1];
+    data.xdot_[1] = -std::sin(x[0]) - damping * x[1] + u[0];
+  }
+
+  void dForward(const ConstVectorRef &x, const ConstVectorRef &,
+                Data &data) const override {
+    data.Jx_ << 0., 1., -std::cos(x[0]), -damping;
+    data.Ju_ << 0., 1.;
+  }
+};
+
+/// Central finite differences of the next state of @p dyn.
+template <typename Integrator>
+void checkDerivatives(const Integrator &dyn, const VectorXd &x,
+                      const VectorXd &u) {
+  const double eps = 1e-6;
+  auto data = dyn.createData();
+  dyn.forward(x, u, *data);
+  dyn.dForward(x, u, *data);
+  const MatrixXd Jx = data->Jx();
+  const MatrixXd Ju = data->Ju();
+
+  MatrixXd Jx_fd(x.size(), x.size());
+  MatrixXd Ju_fd(x.size(), u.size());
+  for (int i = 0; i < x.size(); i++) {
+    VectorXd xp = x, xm = x;
+    xp[i] += eps;
+    xm[i] -= eps;
+    dyn.forward(xp, u, *data);
+    const VectorXd yp = data->xnext_;
+    dyn.forward(xm, u, *data);
+    Jx_fd.col(i) = (yp - data->xnext_) / (2 * eps);
+  }
+  for (int i = 0; i < u.size(); i++) {
+    VectorXd up = u, um = u;
+    up[i] += eps;
+    um[i] -= eps;
+    dyn.forward(x, up, *data);
+    const VectorXd yp = data->xnext_;
+    dyn.forward(x, um, *data);
+    Ju_fd.col(i) = (yp - data->xnext_) / (2 * eps);
+  }
+  REQUIRE(Jx.isApprox(Jx_fd, 1e-6));
+  REQUIRE(Ju.isApprox(Ju_fd, 1e-6));
+}
 
 TEST_CASE("euler", "[integrators]") {
   constexpr int NX = 3;
@@ -15,3 +78,142 @@ TEST_CASE("rk2", "[integrators]") {
   constexpr int NX = 3;
   Manifold space(NX);
 }
+
+TEST_CASE("euler_derivatives", "[integrators]") {
+  const PendulumODE ode;
+  const IntegratorEulerTpl<double> dyn(ode, 0.1);
+  const VectorXd x = VectorXd::Random(2);
+  const VectorXd u = VectorXd::Random(1);
+  checkDerivatives(dyn, x, u);
+}
+
+TEST_CASE("rk2_derivatives", "[integrators]") {
+  const PendulumODE ode;
+  const IntegratorRK2Tpl<double> dyn(ode, 0.1);
+  const VectorXd x = VectorXd::Random(2);
+  const VectorXd u = VectorXd::Random(1);
+  checkDerivatives(dyn, x, u);
+}
+
+TEST_CASE("midpoint_derivatives", "[integrators]") {
+  const PendulumODE ode;
+  const IntegratorMidpointTpl<double> dyn(ode, 0.1);
+  auto data = dyn.createData();
+  const double eps = 1e-6;
+  // stack z = (x, u, y)
+  VectorXd z = VectorXd::Random(5);
+  const auto residual = [&](const VectorXd &z_) -> VectorXd {
+    dyn.evaluate(z_.head(2), z_.segment(2, 1), z_.tail(2), *data);
+    return data->value_;
+  };
+  MatrixXd J_fd(2, 5);
+  for (int i = 0; i < 5; i++) {
+    VectorXd zp = z, zm = z;
+    zp[i] += eps;
+    zm[i] -= eps;
+    J_fd.col(i) = (residual(zp) - residual(zm)) / (2 * eps);
+  }
+  dyn.evaluate(z.head(2), z.segment(2, 1), z.tail(2), *data);
+  dyn.computeJacobians(z.head(2), z.segment(2, 1), z.tail(2), *data);
+  REQUIRE(data->Jx_.isApprox(J_fd.leftCols(2), 1e-6));
+  REQUIRE(data->Ju_.isApprox(J_fd.middleCols(2, 1), 1e-6));
+  REQUIRE(data->Jy_.isApprox(J_fd.rightCols(2), 1e-6));
+}
+
+TEST_CASE("rk4_linear", "[integrators]") {
+  constexpr int NX = 4;
+  constexpr int NU = 2;
+  const double dt = 0.1;
+  const MatrixXd A = MatrixXd::Random(NX, NX);
+  const MatrixXd B = MatrixXd::Random(NX, NU);
+  const VectorXd c = VectorXd::Random(NX);
+  const LinearODETpl<double> ode(A, B, c);
+  const IntegratorRK4Tpl<double> dyn(ode, dt);
+  auto data = dyn.createData();
+
+  const VectorXd x = VectorXd::Random(NX);
+  const VectorXd u = VectorXd::Random(NU);
+  dyn.forward(x, u, *data);
+  dyn.dForward(x, u, *data);
+
+  // RK4 is exact for the fourth-order Taylor expansion of a linear ODE
+  VectorXd xnext = x;
+  VectorXd term = A * x + B * u + c;
+  MatrixXd Jx = MatrixXd::Identity(NX, NX);
+  MatrixXd Ax_pow = MatrixXd::Identity(NX, NX);
+  MatrixXd Ju = MatrixXd::Zero(NX, NU);
+  double coeff = 1.;
+  for (int k = 1; k <= 4; k++) {
+    coeff *= dt / k;
+    xnext += coeff * term;
+    Ju += coeff * Ax_pow * B;
+    Ax_pow = A * Ax_pow;
+    Jx += coeff * Ax_pow;
+    term = A * term;
+  }
+  REQUIRE(data->xnext_.isApprox(xnext));
+  REQUIRE(data->Jx().isApprox(Jx));
+  REQUIRE(data->Ju().isApprox(Ju));
+}
+
+TEST_CASE("rk4_derivatives", "[integrators]") {
+  const PendulumODE ode;
+  const IntegratorRK4Tpl<double> dyn(ode, 0.1);
+  const VectorXd x = VectorXd::Random(2);
+  const VectorXd u = VectorXd::Random(1);
+  checkDerivatives(dyn, x, u);
+}
+
+TEST_CASE("rk23_derivatives", "[integrators]") {
+  const PendulumODE ode;
+  const IntegratorRK23Tpl<double> dyn(ode, 0.1);
+  const VectorXd x = VectorXd::Random(2);
+  const VectorXd u = VectorXd::Random(1);
+  checkDerivatives(dyn, x, u);
+}
+
+TEST_CASE("rk_local_errors", "[integrators]") {
+  const PendulumODE ode;
+  const VectorXd x = (VectorXd(2) << 1., -0.5).finished();
+  const VectorXd u = VectorXd::Constant(1, 0.2);
+
+  // reference: many small RK4 steps
+  const auto reference = [&](const double dt) {
+    const int nsub = 1000;
+    const IntegratorRK4Tpl<double> fine(ode, dt / nsub);
+    auto data = fine.createData();
+    VectorXd y = x;
+    for (int i = 0; i < nsub; i++) {
+      fine.forward(y, u, *data);
+      y = data->xnext_;
+    }
+    return y;
+  };
+
+  double err_rk2[2], err_rk4[2], err_rk23[2], est_rk23[2];
+  const double dts[2] = {0.1, 0.05};
+  for (int k = 0; k < 2; k++) {
+    const VectorXd y = reference(dts[k]);
+    const IntegratorRK2Tpl<double> rk2(ode, dts[k]);
+    const IntegratorRK4Tpl<double> rk4(ode, dts[k]);
+    const IntegratorRK23Tpl<double> rk23(ode, dts[k]);
+    auto d2 = rk2.createData();
+    auto d4 = rk4.createData();
+    auto d23 = rk23.createData();
+    rk2.forward(x, u, *d2);
+    rk4.forward(x, u, *d4);
+    rk23.forward(x, u, *d23);
+    err_rk2[k] = (d2->xnext_ - y).norm();
+    err_rk4[k] = (d4->xnext_ - y).norm();
+    err_rk23[k] = (d23->xnext_ - y).norm();
+    est_rk23[k] =
+        static_cast<IntegratorRK23DataTpl<double> &>(*d23).error_.norm();
+  }
+  // local errors in O(h^{p+1}): halving the time step divides them by 2^{p+1}
+  REQUIRE(err_rk4[0] < err_rk2[0]);
+  REQUIRE(err_rk4[0] / err_rk4[1] > 24.);
+  REQUIRE(err_rk23[0] / err_rk23[1] > 12.);
+  REQUIRE(est_rk23[0] / est_rk23[1] > 6.);
+  // the estimate is that of the embedded second-order solution
+  REQUIRE(est_rk23[0] > err_rk23[0]);
+}
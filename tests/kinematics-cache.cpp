@@ -0,0 +1,620 @@
+/// @file
+/// @copyright Copyright (C) 2026 INRIA
+#include <pinocchio/multibody/sample-models.hpp>
+#include <pinocchio/algorithm/joint-configuration.hpp>
+#include <pinocchio/algorithm/jacobian.hpp>
+#include <pinocchio/algorithm/centroidal.hpp>
+#include <pinocchio/algorithm/center-of-mass.hpp>
+#include <pinocchio/algorithm/frames.hpp>
+#if defined(PINOCCHIO_WITH_HPP_FCL) || defined(PINOCCHIO_WITH_COAL)
+#include <coal/shape/geometric_shapes.h>
+#endif
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <map>
+#include <optional>
+
+#include "aligator/core/stage-model.hpp"
+#include "aligator/core/stage-data.hpp"
+#include "aligator/core/shared-data-scope.hpp"
+#include "aligator/modelling/costs/sum-of-costs.hpp"
+#include "aligator/modelling/costs/quad-residual-cost.hpp"
+#include "aligator/modelling/dynamics/kinodynamics-fwd.hpp"
+#include "aligator/modelling/dynamics/multibody-free-fwd.hpp"
+#include "aligator/modelling/dynamics/integrator-semi-euler.hpp"
+#include "aligator/modelling/dynamics/integrator-rk2.hpp"
+#include "aligator/modelling/multibody/center-of-mass-translation.hpp"
+#include "aligator/modelling/multibody/centroidal-momentum.hpp"
+#include "aligator/modelling/multibody/fly-high.hpp"
+#include "aligator/modelling/multibody/frame-collision.hpp"
+#include "aligator/modelling/multibody/frame-placement.hpp"
+#include "aligator/modelling/multibody/frame-translation.hpp"
+#include "aligator/modelling/multibody/frame-velocity.hpp"
+#include "aligator/modelling/multibody/multi-frame-collision.hpp"
+#include "aligator/modelling/spaces/multibody.hpp"
+
+namespace pin = pinocchio;
+using namespace aligator;
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+using pin::Model;
+using Space = MultibodyPhaseSpace<double>;
+using StageModel = StageModelTpl<double>;
+using StageData = StageDataTpl<double>;
+using StageFunctionData = StageFunctionDataTpl<double>;
+using StageFunction = StageFunctionTpl<double>;
+using CostStack = CostStackTpl<double>;
+using CostStackData = CostStackDataTpl<double>;
+using CompositeCostData = CompositeCostDataTpl<double>;
+using QuadraticResidualCost = QuadraticResidualCostTpl<double>;
+using KinematicsCache = KinematicsCacheTpl<double>;
+using FramePlacement = FramePlacementResidualTpl<double>;
+using FrameTranslation = FrameTranslationResidualTpl<double>;
+using FrameVelocity = FrameVelocityResidualTpl<double>;
+using CenterOfMassTranslation = CenterOfMassTranslationResidualTpl<double>;
+using FlyHigh = FlyHighResidualTpl<double>;
+using ExplicitIntegratorData = dynamics::ExplicitIntegratorDataTpl<double>;
+using MultibodyFreeFwdData = dynamics::MultibodyFreeFwdDataTpl<double>;
+using IntegratorRK2Data = dynamics::IntegratorRK2DataTpl<double>;
+
+struct HumanoidStage {
+  Model model;
+  std::map<std::string, xyz::polymorphic<StageFunction>> residuals;
+  std::optional<StageModel> stage;
+
+  HumanoidStage() {
+    pin::buildModels::humanoidRandom(model, true);
+    Space space(model);
+    const int ndx = space.ndx();
+    const int nu = model.nv - 6;
+    const auto lf = model.getFrameId("lleg6_joint");
+    const auto rf = model.getFrameId("rleg6_joint");
+    // the functions of the stage share the model of the state space, and
+    // hence its kinematics cache
+    const auto handle = space.getModelHandle();
+
+    residuals.emplace("placement",
+                      FramePlacement(ndx, nu, handle, pin::SE3::Random(), lf));
+    residuals.emplace("translation",
+                      FrameTranslation(ndx, nu, handle,
+                                       Eigen::Vector3d::Random(), rf));
+    residuals.emplace("velocity",
+                      FrameVelocity(ndx, nu, handle, pin::Motion::Random(), lf,
+                                    pin::LOCAL_WORLD_ALIGNED));
+    residuals.emplace("com", CenterOfMassTranslation(
+                                 ndx, nu, handle, Eigen::Vector3d::Random()));
+    residuals.emplace("fly_high", FlyHigh(ndx, handle, rf, 2., nu));
+
+    CostStack costs(space, nu);
+    for (const auto &[name, fn] : residuals) {
+      const MatrixXd w = MatrixXd::Identity(fn->nr, fn->nr);
+      costs.addCost(name, QuadraticResidualCost(space, fn, w));
+    }
+    MatrixXd actuation = MatrixXd::Zero(model.nv, nu);
+    actuation.bottomRows(nu).setIdentity();
+    dynamics::MultibodyFreeFwdDynamicsTpl<double> ode(space, actuation);
+    dynamics::IntegratorSemiImplEulerTpl<double> dyn(ode, 0.01);
+    stage.emplace(costs, dyn);
+  }
+
+  VectorXd randomState() const {
+    VectorXd x(model.nq + model.nv);
+    x << pin::randomConfiguration(model), VectorXd::Random(model.nv);
+    return x;
+  }
+
+  static StageFunctionData &residualData(StageData &sd,
+                                         const std::string &name) {
+    auto &cd = static_cast<CostStackData &>(*sd.cost_data);
+    auto &rd = static_cast<CompositeCostData &>(*cd.sub_cost_data.at(name));
+    return *rd.residual_data;
+  }
+};
+
+template <typename Data>
+static const KinematicsCache *cacheOf(StageFunctionData &data) {
+  return static_cast<Data &>(data).kinematics_.get();
+}
+
+TEST_CASE("copies_share_model", "[kinematics_cache]") {
+  HumanoidStage problem;
+  const Model &model = problem.model;
+  Space space(model);
+  Space space_copy(space);
+  Space space_shared(space.getModelHandle());
+  REQUIRE(&space.getModel() != &model);
+  REQUIRE(&space_copy.getModel() == &space.getModel());
+  REQUIRE(&space_shared.getModel() == &space.getModel());
+
+  const FramePlacement fn(space.ndx(), model.nv - 6, model, pin::SE3::Random(),
+                          model.getFrameId("lleg6_joint"));
+  const FramePlacement fn_copy(fn);
+  REQUIRE(&fn_copy.getModel() == &fn.getModel());
+  REQUIRE(fn.pin_model_handle_.use_count() == 2);
+
+  const FramePlacement fn_shared(space.ndx(), model.nv - 6,
+                                 space.getModelHandle(), pin::SE3::Random(),
+                                 model.getFrameId("lleg6_joint"));
+  REQUIRE(&fn_shared.getModel() == &space.getModel());
+
+  // residuals hold no reference to the model, and can be assigned to
+  CenterOfMassTranslation com(space.ndx(), model.nv - 6,
+                              space.getModelHandle(), Eigen::Vector3d::Zero());
+  CenterOfMassTranslation com_other(space.ndx(), model.nv - 6, model,
+                                    Eigen::Vector3d::Ones());
+  com_other = com;
+  REQUIRE(&com_other.getModel() == &space.getModel());
+
+  // the stage model holds deep copies of the residuals, which share the model
+  // held by the problem's residual
+  const StageModel &stage = *problem.stage;
+  const auto &costs = static_cast<const CostStack &>(*stage.cost_);
+  const auto &cost = static_cast<const QuadraticResidualCost &>(
+      *costs.components_.at("placement").first);
+  const auto &residual = static_cast<const FramePlacement &>(*cost.residual_);
+  const auto &original =
+      static_cast<const FramePlacement &>(*problem.residuals.at("placement"));
+  REQUIRE(&residual.getModel() == &original.getModel());
+}
+
+TEST_CASE("shared_data_scope", "[kinematics_cache]") {
+  HumanoidStage problem;
+  const FramePlacement &fn =
+      static_cast<const FramePlacement &>(*problem.residuals.at("placement"));
+
+  // no scope: each data owns a cache
+  auto d1 = std::static_pointer_cast<FramePlacementDataTpl<double>>(
+      fn.createData());
+  auto d2 = std::static_pointer_cast<FramePlacementDataTpl<double>>(
+      fn.createData());
+  REQUIRE(SharedDataScope::current() == nullptr);
+  REQUIRE(d1->kinematics_ != d2->kinematics_);
+
+  {
+    SharedDataScope scope;
+    auto d3 = std::static_pointer_cast<FramePlacementDataTpl<double>>(
+        fn.createData());
+    auto d4 = std::static_pointer_cast<FramePlacementDataTpl<double>>(
+        fn.createData());
+    REQUIRE(SharedDataScope::current() == &scope);
+    REQUIRE(d3->kinematics_ == d4->kinematics_);
+    REQUIRE(&d3->pin_data_ == &d4->pin_data_);
+    REQUIRE(scope.size() == 1);
+  }
+  REQUIRE(SharedDataScope::current() == nullptr);
+}
+
+TEST_CASE("stage_shares_kinematics", "[kinematics_cache]") {
+  HumanoidStage problem;
+  const StageModel &stage = *problem.stage;
+  auto sd = stage.createData();
+
+  const KinematicsCache *cache = cacheOf<FramePlacementDataTpl<double>>(
+      HumanoidStage::residualData(*sd, "placement"));
+  REQUIRE(cache != nullptr);
+  REQUIRE(cacheOf<FrameTranslationDataTpl<double>>(HumanoidStage::residualData(
+              *sd, "translation")) == cache);
+  REQUIRE(cacheOf<FrameVelocityDataTpl<double>>(
+              HumanoidStage::residualData(*sd, "velocity")) == cache);
+  REQUIRE(cacheOf<CenterOfMassTranslationDataTpl<double>>(
+              HumanoidStage::residualData(*sd, "com")) == cache);
+  REQUIRE(cacheOf<FlyHigh::Data>(HumanoidStage::residualData(
+              *sd, "fly_high")) == cache);
+
+  // another stage data gets its own cache
+  auto sd2 = stage.createData();
+  REQUIRE(cacheOf<FramePlacementDataTpl<double>>(HumanoidStage::residualData(
+              *sd2, "placement")) != cache);
+}
+
+TEST_CASE("shared_kinematics_match_standalone", "[kinematics_cache]") {
+  HumanoidStage problem;
+  const StageModel &stage = *problem.stage;
+  auto sd = stage.createData();
+  const int nu = stage.nu();
+
+  // standalone datas, created outside of any stage
+  std::map<std::string, shared_ptr<StageFunctionData>> standalone;
+  for (const auto &[name, fn] : problem.residuals)
+    standalone[name] = fn->createData();
+
+  // several states, to check the cache is invalidated when x changes
+  for (int i = 0; i < 3; i++) {
+    const VectorXd x = problem.randomState();
+    const VectorXd u = VectorXd::Random(nu);
+    stage.evaluate(x, u, *sd);
+    stage.computeFirstOrderDerivatives(x, u, *sd);
+
+    for (const auto &[name, fn] : problem.residuals) {
+      StageFunctionData &ref = *standalone[name];
+      fn->evaluate(x, u, ref);
+      fn->computeJacobians(x, u, ref);
+      const StageFunctionData &shared = HumanoidStage::residualData(*sd, name);
+      INFO("residual " << name << ", state " << i);
+      REQUIRE(shared.value_.isApprox(ref.value_));
+      REQUIRE(shared.jac_buffer_.isApprox(ref.jac_buffer_));
+    }
+  }
+}
+
+TEST_CASE("dynamics_publish_kinematics", "[kinematics_cache]") {
+  HumanoidStage problem;
+  const Model &model = problem.model;
+  const StageModel &stage = *problem.stage;
+  auto sd = stage.createData();
+  const VectorXd x = problem.randomState();
+  const VectorXd u = VectorXd::Random(stage.nu());
+
+  const KinematicsCache *cache = cacheOf<FramePlacementDataTpl<double>>(
+      HumanoidStage::residualData(*sd, "placement"));
+  auto &dd = static_cast<ExplicitIntegratorData &>(*sd->dynamics_data);
+  auto &ode_data = static_cast<MultibodyFreeFwdData &>(*dd.continuous_data);
+  REQUIRE(ode_data.kinematics_.get() == cache);
+
+  // the dynamics run before the other functions of the stage
+  stage.dynamics_->forward(x, u, dd);
+  stage.dynamics_->dForward(x, u, dd);
+  REQUIRE(cache->isComputed(KinematicsCache::PLACEMENTS |
+                            KinematicsCache::VELOCITIES |
+                            KinematicsCache::JOINT_JACOBIANS));
+
+  pin::Data ref(model);
+  pin::computeJointJacobians(model, ref, x.head(model.nq));
+  REQUIRE(cache->data.J.isApprox(ref.J));
+  for (std::size_t i = 1; i < ref.oMi.size(); i++)
+    REQUIRE(cache->data.oMi[i].isApprox(ref.oMi[i]));
+}
+
+TEST_CASE("distinct_models_get_distinct_caches", "[kinematics_cache]") {
+  HumanoidStage problem;
+  const Model &model = problem.model;
+  const int ndx = 2 * model.nv;
+  const int nu = model.nv - 6;
+  const auto lf = model.getFrameId("lleg6_joint");
+
+  // equal models held at different addresses are not matched: a model which
+  // is later modified in place must not read the kinematics of another one
+  const FramePlacement fn1(ndx, nu, model, pin::SE3::Random(), lf);
+  const FramePlacement fn2(ndx, nu, model, pin::SE3::Random(), lf);
+  REQUIRE(&fn1.getModel() != &fn2.getModel());
+
+  SharedDataScope scope;
+  auto d1 = std::static_pointer_cast<FramePlacementDataTpl<double>>(
+      fn1.createData());
+  auto d2 = std::static_pointer_cast<FramePlacementDataTpl<double>>(
+      fn2.createData());
+  REQUIRE(d1->kinematics_ != d2->kinematics_);
+  REQUIRE(scope.size() == 2);
+}
+
+TEST_CASE("velocity_invalidates_centroidal_momentum", "[kinematics_cache]") {
+  HumanoidStage problem;
+  const Model &model = problem.model;
+  KinematicsCache cache(model);
+  const VectorXd q = pin::randomConfiguration(model);
+  const VectorXd v1 = VectorXd::Random(model.nv);
+  const VectorXd v2 = VectorXd::Random(model.nv);
+
+  cache.ccrba(model, q, v1);
+  REQUIRE(cache.isComputed(KinematicsCache::CENTROIDAL_MAP));
+  // same configuration, other velocity: hg = Ag(q) v must be recomputed
+  cache.ccrba(model, q, v2);
+
+  pin::Data ref(model);
+  pin::ccrba(model, ref, q, v2);
+  REQUIRE(cache.data.Ag.isApprox(ref.Ag));
+  REQUIRE(cache.data.hg.toVector().isApprox(ref.hg.toVector()));
+}
+
+TEST_CASE("single_frame_placements", "[kinematics_cache]") {
+  HumanoidStage problem;
+  const Model &model = problem.model;
+  KinematicsCache cache(model);
+  const auto lf = model.getFrameId("lleg6_joint");
+  const auto rf = model.getFrameId("rleg6_joint");
+  const VectorXd q1 = pin::randomConfiguration(model);
+  const VectorXd q2 = pin::randomConfiguration(model);
+  pin::Data ref(model);
+
+  cache.updateFramePlacement(model, q1, lf);
+  REQUIRE(cache.isFrameComputed(lf));
+  REQUIRE_FALSE(cache.isFrameComputed(rf));
+  REQUIRE_FALSE(cache.isComputed(KinematicsCache::FRAME_PLACEMENTS));
+  pin::framesForwardKinematics(model, ref, q1);
+  REQUIRE(cache.data.oMf[lf].isApprox(ref.oMf[lf]));
+
+  // the frames are invalidated with the configuration
+  cache.updateFramePlacement(model, q2, rf);
+  REQUIRE_FALSE(cache.isFrameComputed(lf));
+  pin::framesForwardKinematics(model, ref, q2);
+  REQUIRE(cache.data.oMf[rf].isApprox(ref.oMf[rf]));
+
+  cache.updateFramePlacements(model, q2);
+  REQUIRE(cache.isFrameComputed(lf));
+  REQUIRE(cache.data.oMf[lf].isApprox(ref.oMf[lf]));
+}
+
+TEST_CASE("rk2_stage_keeps_kinematics_at_x", "[kinematics_cache]") {
+  HumanoidStage problem;
+  const Model &model = problem.model;
+  const auto &placement =
+      static_cast<const FramePlacement &>(*problem.residuals.at("placement"));
+  const Space space(placement.pin_model_handle_);
+  const int nu = model.nv - 6;
+  MatrixXd actuation = MatrixXd::Zero(model.nv, nu);
+  actuation.bottomRows(nu).setIdentity();
+  dynamics::MultibodyFreeFwdDynamicsTpl<double> ode(space, actuation);
+  dynamics::IntegratorRK2Tpl<double> dyn(ode, 0.01);
+  const StageModel stage(problem.stage->cost_, dyn);
+
+  auto sd = stage.createData();
+  const KinematicsCache *cache = cacheOf<FramePlacementDataTpl<double>>(
+      HumanoidStage::residualData(*sd, "placement"));
+  auto &dd = static_cast<IntegratorRK2Data &>(*sd->dynamics_data);
+  // only the ODE data at x publishes to the stage's cache
+  REQUIRE(static_cast<MultibodyFreeFwdData &>(*dd.continuous_data)
+              .kinematics_.get() == cache);
+  REQUIRE(static_cast<MultibodyFreeFwdData &>(*dd.continuous_data2)
+              .kinematics_.get() != cache);
+
+  const VectorXd x = problem.randomState();
+  const VectorXd u = VectorXd::Random(nu);
+  stage.dynamics_->forward(x, u, dd);
+  stage.dynamics_->dForward(x, u, dd);
+  REQUIRE(cache->isComputed(KinematicsCache::PLACEMENTS |
+                            KinematicsCache::JOINT_JACOBIANS));
+
+  // the cache holds the kinematics at x, not at the midpoint of the step
+  pin::Data ref(model);
+  pin::computeJointJacobians(model, ref, x.head(model.nq));
+  REQUIRE(cache->data.J.isApprox(ref.J));
+  for (std::size_t i = 1; i < ref.oMi.size(); i++)
+    REQUIRE(cache->data.oMi[i].isApprox(ref.oMi[i]));
+}
+
+TEST_CASE("frame_reference_parameters", "[kinematics_cache]") {
+  HumanoidStage problem;
+  const Model &model = problem.model;
+  const auto handle =
+      static_cast<const FramePlacement &>(*problem.residuals.at("placement"))
+          .pin_model_handle_;
+  const Space space(handle);
+  const int ndx = space.ndx();
+  const int nu = model.nv - 6;
+  const auto fid = model.getFrameId("lleg6_joint");
+  const pin::SE3 M_ref = pin::SE3::Random();
+  const Eigen::Vector3d p_ref = Eigen::Vector3d::Random();
+
+  // residuals reading their references from the stage parameters
+  FramePlacement placement(ndx, nu, handle, pin::SE3::Identity(), fid);
+  placement.reference_parameter_ = "placement_ref";
+  FrameTranslation translation(ndx, nu, handle, Eigen::Vector3d::Zero(), fid);
+  translation.reference_parameter_ = "translation_ref";
+  CostStack costs(space, nu);
+  costs.addCost("placement", QuadraticResidualCost(space, placement,
+                                                   MatrixXd::Identity(6, 6)));
+  costs.addCost("translation",
+                QuadraticResidualCost(space, translation,
+                                      MatrixXd::Identity(3, 3)));
+  StageModel stage(costs, problem.stage->dynamics_);
+
+  Eigen::Matrix<double, 7, 1> p;
+  p.head<3>() = M_ref.translation();
+  p.tail<4>() = Eigen::Quaterniond(M_ref.rotation()).coeffs();
+  stage.parameters_["placement_ref"] = p;
+  stage.parameters_["translation_ref"] = p_ref;
+
+  // residuals holding the same references
+  std::map<std::string, xyz::polymorphic<StageFunction>> expected;
+  expected.emplace("placement", FramePlacement(ndx, nu, handle, M_ref, fid));
+  expected.emplace("translation",
+                   FrameTranslation(ndx, nu, handle, p_ref, fid));
+
+  auto sd = stage.createData();
+  const VectorXd x = problem.randomState();
+  const VectorXd u = VectorXd::Random(nu);
+  stage.evaluate(x, u, *sd);
+  stage.computeFirstOrderDerivatives(x, u, *sd);
+  for (const auto &[name, fn] : expected) {
+    auto ref = fn->createData();
+    fn->evaluate(x, u, *ref);
+    fn->computeJacobians(x, u, *ref);
+    const StageFunctionData &read = HumanoidStage::residualData(*sd, name);
+    INFO("residual " << name);
+    REQUIRE(read.value_.isApprox(ref->value_));
+    REQUIRE(read.jac_buffer_.isApprox(ref->jac_buffer_));
+  }
+}
+
+/// Central finite differences of @p f (writing its value in its last argument)
+/// along the tangent directions of x and along u.
+template <typename F>
+static void finiteDifferences(const Space &space, const VectorXd &x,
+                              const VectorXd &u, F &&f, MatrixXd &Jx,
+                              MatrixXd &Ju) {
+  const double eps = 1e-6;
+  VectorXd xp(x.size()), xm(x.size()), fp(Jx.rows()), fm(Jx.rows());
+  for (int i = 0; i < space.ndx(); i++) {
+    const VectorXd e = VectorXd::Unit(space.ndx(), i) * eps;
+    space.integrate(x, e, xp);
+    space.integrate(x, -e, xm);
+    f(xp, u, fp);
+    f(xm, u, fm);
+    Jx.col(i) = (fp - fm) / (2 * eps);
+  }
+  for (int j = 0; j < u.size(); j++) {
+    const VectorXd e = VectorXd::Unit(u.size(), j) * eps;
+    f(x, u + e, fp);
+    f(x, u - e, fm);
+    Ju.col(j) = (fp - fm) / (2 * eps);
+  }
+}
+
+TEST_CASE("kinodynamics_centroidal_momentum", "[kinematics_cache]") {
+  using KinodynamicsFwd = dynamics::KinodynamicsFwdDynamicsTpl<double>;
+  using KinodynamicsFwdData = dynamics::KinodynamicsFwdDataTpl<double>;
+  using CentroidalMomentum = CentroidalMomentumResidualTpl<double>;
+  HumanoidStage problem;
+  const Model &model = problem.model;
+  const auto handle =
+      static_cast<const FramePlacement &>(*problem.residuals.at("placement"))
+          .pin_model_handle_;
+  const Space space(handle);
+  const int ndx = space.ndx();
+  const std::vector<pin::FrameIndex> contact_ids{
+      model.getFrameId("lleg6_joint"), model.getFrameId("rleg6_joint")};
+  const VectorXd x = problem.randomState();
+  const VectorXd q = x.head(model.nq);
+  const VectorXd v = x.tail(model.nv);
+
+  for (const int force_size : {3, 6}) {
+    INFO("force_size " << force_size);
+    const KinodynamicsFwd ode(space, space.getModel(),
+                              Eigen::Vector3d(0., 0., -9.81), {true, false},
+                              contact_ids, force_size);
+    const int nu = ode.nu();
+    const CentroidalMomentum momentum(ndx, nu, handle,
+                                      CentroidalMomentum::Vector6s::Random());
+    const StageFunction &momentum_fn = momentum;
+    REQUIRE(ode.pin_model_handle_ == handle);
+
+    shared_ptr<KinodynamicsFwdData> od;
+    shared_ptr<StageFunctionData> md;
+    {
+      SharedDataScope scope;
+      od = std::static_pointer_cast<KinodynamicsFwdData>(ode.createData());
+      md = momentum.createData();
+    }
+    const KinematicsCache *cache = od->kinematics_.get();
+    REQUIRE(cacheOf<CentroidalMomentumDataTpl<double>>(*md) == cache);
+
+    const VectorXd u = VectorXd::Random(nu);
+    ode.forward(x, u, *od);
+    ode.dForward(x, u, *od);
+    momentum_fn.evaluate(x, u, *md);
+    momentum_fn.computeJacobians(x, u, *md);
+    REQUIRE(cache->isComputed(KinematicsCache::CENTROIDAL_DERIVATIVES));
+    // only the active contact frame is placed
+    REQUIRE(cache->isFrameComputed(contact_ids[0]));
+    REQUIRE_FALSE(cache->isFrameComputed(contact_ids[1]));
+
+    // what the forward pass takes from dccrba and publishes
+    pin::Data ref(model);
+    pin::ccrba(model, ref, q, v);
+    pin::centerOfMass(model, ref, q);
+    pin::updateFramePlacement(model, ref, contact_ids[0]);
+    REQUIRE(cache->data.oMf[contact_ids[0]].isApprox(ref.oMf[contact_ids[0]]));
+    REQUIRE(cache->data.Ag.isApprox(ref.Ag));
+    REQUIRE(cache->data.hg.toVector().isApprox(ref.hg.toVector()));
+    REQUIRE(cache->data.com[0].isApprox(ref.com[0]));
+    REQUIRE(std::abs(cache->data.mass[0] - ref.mass[0]) < 1e-12);
+    for (std::size_t i = 1; i < ref.oMi.size(); i++)
+      REQUIRE(cache->data.oMi[i].isApprox(ref.oMi[i]));
+
+    // the Jacobians, against finite differences on standalone datas
+    auto od_fd = ode.createData();
+    auto md_fd = momentum.createData();
+    MatrixXd Jx(ndx, ndx), Ju(ndx, nu);
+    finiteDifferences(
+        space, x, u,
+        [&](const VectorXd &x_, const VectorXd &u_, VectorXd &out) {
+          ode.forward(x_, u_, *od_fd);
+          out = od_fd->xdot_;
+        },
+        Jx, Ju);
+    REQUIRE(od->Jx_.isApprox(Jx, 1e-5));
+    REQUIRE(od->Ju_.isApprox(Ju, 1e-5));
+
+    MatrixXd Jh(6, ndx), Jhu(6, nu);
+    finiteDifferences(
+        space, x, u,
+        [&](const VectorXd &x_, const VectorXd &u_, VectorXd &out) {
+          momentum_fn.evaluate(x_, u_, *md_fd);
+          out = md_fd->value_;
+        },
+        Jh, Jhu);
+    REQUIRE(md->Jx_.isApprox(Jh, 1e-5));
+  }
+}
+
+#if defined(PINOCCHIO_WITH_HPP_FCL) || defined(PINOCCHIO_WITH_COAL)
+TEST_CASE("multi_frame_collision", "[kinematics_cache]") {
+  using FrameCollision = FrameCollisionResidualTpl<double>;
+  using MultiFrameCollision = MultiFrameCollisionResidualTpl<double>;
+  Model model;
+  pin::buildModels::humanoid(model, true);
+  const Space space(model);
+  const auto handle = space.getModelHandle();
+  const int ndx = space.ndx();
+  const int nu = model.nv;
+
+  // capsules on the effectors of three limbs
+  pin::GeometryModel geom_model;
+  for (const char *name :
+       {"larm_effector_body", "rarm_effector_body", "lleg_effector_body"}) {
+    const auto frame_id = model.getFrameId(name);
+    const pin::Frame &frame = model.frames[frame_id];
+    geom_model.addGeometryObject(pin::GeometryObject(
+        std::string(name) + "_capsule", frame.parentJoint, frame_id,
+        frame.placement, std::make_shared<coal::Capsule>(0.05, 0.1)));
+  }
+  geom_model.addAllCollisionPairs();
+  const int npairs = int(geom_model.collisionPairs.size());
+
+  const MultiFrameCollision fn(ndx, nu, handle, geom_model);
+  const StageFunction &fn_ref = fn;
+  REQUIRE(fn.nr == npairs);
+  const FramePlacement placement(ndx, nu, handle, pin::SE3::Random(),
+                                 model.getFrameId("larm_effector_body"));
+  const StageFunction &placement_ref = placement;
+
+  shared_ptr<StageFunctionData> data, placement_data;
+  {
+    SharedDataScope scope;
+    data = fn.createData();
+    placement_data = placement.createData();
+  }
+  REQUIRE(cacheOf<MultiFrameCollisionDataTpl<double>>(*data) ==
+          cacheOf<FramePlacementDataTpl<double>>(*placement_data));
+
+  // one residual per pair, for reference
+  std::vector<xyz::polymorphic<StageFunction>> singles;
+  std::vector<shared_ptr<StageFunctionData>> single_datas;
+  for (pin::PairIndex k = 0; k < geom_model.collisionPairs.size(); k++)
+    singles.emplace_back(FrameCollision(ndx, nu, handle, geom_model, k));
+  for (const auto &single : singles)
+    single_datas.push_back(single->createData());
+
+  auto data_fd = fn.createData();
+  const VectorXd u = VectorXd::Zero(nu);
+  MatrixXd Jx(npairs, ndx), Ju(npairs, nu);
+  for (int i = 0; i < 5; i++) {
+    INFO("state " << i);
+    VectorXd x(space.nx());
+    space.integrate(space.neutral(), VectorXd::Random(ndx), x);
+    placement_ref.evaluate(x, u, *placement_data);
+    fn_ref.evaluate(x, u, *data);
+    fn_ref.computeJacobians(x, u, *data);
+
+    for (int k = 0; k < npairs; k++) {
+      INFO("pair " << k);
+      StageFunctionData &sd = *single_datas[std::size_t(k)];
+      singles[std::size_t(k)]->evaluate(x, u, sd);
+      singles[std::size_t(k)]->computeJacobians(x, u, sd);
+      REQUIRE(std::abs(data->value_[k] - sd.value_[0]) < 1e-8);
+      REQUIRE((data->Jx_.row(k) - sd.Jx_.row(0)).isZero(1e-8));
+    }
+
+    finiteDifferences(
+        space, x, u,
+        [&](const VectorXd &x_, const VectorXd &u_, VectorXd &out) {
+          fn_ref.evaluate(x_, u_, *data_fd);
+          out = data_fd->value_;
+        },
+        Jx, Ju);
+    REQUIRE((data->Jx_ - Jx).isZero(1e-5));
+  }
+}
+#endif
@@ -1,18 +1,27 @@
+#include "aligator/core/stage-data.hpp"
 #include "aligator/modelling/linear-discrete-dynamics.hpp"
 #include "aligator/modelling/costs/quad-costs.hpp"
+#include "aligator/modelling/costs/quad-state-cost.hpp"
+#include "aligator/modelling/costs/sum-of-costs.hpp"
+#include "aligator/modelling/constraints/box-constraint.hpp"
+#include "aligator/modelling/state-error.hpp"
 #include "aligator/solvers/proxddp/solver-proxddp.hpp"
+#include "aligator/solvers/fddp/solver-fddp.hpp"
+#include "aligator/utils/rollout.hpp"
 
 #include <aligator/fmt-eigen.hpp>
 #include <aligator/fmt.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 #include <random>
+#include <thread>
 
 using namespace aligator;
 
 using LinearDynamics = dynamics::LinearDiscreteDynamicsTpl<double>;
 using QuadraticCost = QuadraticCostTpl<double>;
 using context::CostAbstract;
+using context::SolverFDDP;
 using context::SolverProxDDP;
 using context::StageModel;
 using context::TrajOptProblem;
@@ -73,3 +82,409 @@ TEST_CASE("lqr_proxddp") {
 
   fmt::println("{}", ddp.results_);
 }
+
+/// LQR with box constraints on the controls.
+static TrajOptProblem createBoxLqrProblem(const size_t nsteps,
+                                          const bool with_bounds = true) {
+  const auto nx = 4;
+  const auto nu = 2;
+
+  NormalGen norm_gen;
+  MatrixXd A;
+  A.setIdentity(nx, nx);
+  A.topRightCorner<2, 2>().setIdentity() *= 0.1;
+  MatrixXd B = MatrixXd::NullaryExpr(nx, nu, norm_gen);
+  VectorXd x0 = VectorXd::NullaryExpr(nx, norm_gen);
+
+  auto dyn_model = LinearDynamics(A, B, VectorXd::Zero(nx));
+  MatrixXd Q = MatrixXd::Identity(nx, nx);
+  MatrixXd R = 1e-2 * MatrixXd::Identity(nu, nu);
+  QuadraticCost cost = QuadraticCost(Q, R);
+  QuadraticCost term_cost = QuadraticCost(Q * 10., MatrixXd());
+
+  auto stage = StageModel(cost, dyn_model);
+  if (with_bounds) {
+    const VectorXd umax = VectorXd::Constant(nu, 0.5);
+    stage.addConstraint(ControlErrorResidualTpl<double>(nx, nu),
+                        BoxConstraintTpl<double>(-umax, umax));
+  }
+
+  std::vector<xyz::polymorphic<StageModel>> stages(nsteps, stage);
+  return TrajOptProblem(x0, stages, term_cost);
+}
+
+TEST_CASE("lqr_proxddp_speculative_linesearch") {
+  const size_t nsteps = 50;
+  const TrajOptProblem problem = createBoxLqrProblem(nsteps);
+
+  auto solve = [&](StepAcceptanceStrategy strategy, RolloutType rollout,
+                   size_t num_lanes) {
+    SolverProxDDP ddp(1e-6, 1e-2, 200);
+    ddp.sa_strategy_ = strategy;
+    ddp.rollout_type_ = rollout;
+    ddp.ls_params.interp_type = LSInterpolation::BISECTION;
+    ddp.speculative_ls_lanes = num_lanes;
+    ddp.setup(problem);
+    ddp.run(problem);
+    return std::move(ddp.results_);
+  };
+
+  for (auto rollout : {RolloutType::LINEAR, RolloutType::NONLINEAR}) {
+    for (auto strategy : {StepAcceptanceStrategy::LINESEARCH_ARMIJO,
+                          StepAcceptanceStrategy::LINESEARCH_NONMONOTONE,
+                          StepAcceptanceStrategy::FILTER}) {
+      auto res_ref = solve(strategy, rollout, 1);
+      auto res_spec = solve(strategy, rollout, 4);
+      // speculation must not change the iterates
+      REQUIRE(res_ref.conv == res_spec.conv);
+      REQUIRE(res_ref.num_iters == res_spec.num_iters);
+      REQUIRE(res_ref.al_iter == res_spec.al_iter);
+      REQUIRE(res_ref.stats.num_merit_evals ==
+              res_spec.stats.num_merit_evals);
+      for (size_t i = 0; i <= nsteps; i++) {
+        REQUIRE(res_ref.xs[i].isApprox(res_spec.xs[i]));
+      }
+      for (size_t i = 0; i < nsteps; i++) {
+        REQUIRE(res_ref.us[i].isApprox(res_spec.us[i]));
+      }
+    }
+  }
+}
+
+TEST_CASE("lqr_proxddp_jacobian_pattern") {
+  const size_t nsteps = 50;
+  const TrajOptProblem problem = createBoxLqrProblem(nsteps);
+  // same problem, without the structural zeros of the control bounds
+  TrajOptProblem problem_dense = problem;
+  for (auto &stage : problem_dense.stages_) {
+    auto &func = stage->constraints_.funcs[0];
+    REQUIRE(func->jac_pattern.x_size == 0);
+    func->jac_pattern = JacobianPattern(func->ndx1, func->nu);
+  }
+
+  auto solve = [](const TrajOptProblem &p) {
+    SolverProxDDP ddp(1e-6, 1e-2, 200);
+    ddp.setup(p);
+    REQUIRE(ddp.run(p));
+    return std::move(ddp.results_);
+  };
+  const auto res = solve(problem);
+  const auto res_dense = solve(problem_dense);
+  REQUIRE(res.num_iters == res_dense.num_iters);
+  for (size_t i = 0; i <= nsteps; i++) {
+    REQUIRE(res.xs[i].isApprox(res_dense.xs[i]));
+  }
+  for (size_t i = 0; i < nsteps; i++) {
+    REQUIRE(res.us[i].isApprox(res_dense.us[i]));
+  }
+}
+
+TEST_CASE("lqr_proxddp_cycle_jacobian_pattern") {
+  const size_t nsteps = 20;
+  TrajOptProblem problem = createBoxLqrProblem(nsteps);
+  // start far enough that the control bounds are active
+  problem.setInitState(2.5 * problem.getInitState());
+  SolverProxDDP ddp(1e-6, 1e-2, 200);
+  ddp.setup(problem);
+  REQUIRE(ddp.run(problem));
+
+  const VectorXd x1 = ddp.results_.xs[1];
+  problem.replaceStageCircular(problem.stages_[0]);
+  ddp.cycleProblem(problem, problem.stages_[nsteps - 1]->createData());
+  // the control bounds only fill the control columns of the appended stage
+  REQUIRE(ddp.workspace_.cstr_proj_jacs[nsteps - 1].matrix().isZero(0.));
+  problem.setInitState(x1);
+  REQUIRE(ddp.run(problem));
+  REQUIRE(ddp.workspace_.cstr_proj_jacs[nsteps - 1].blockCol(0).isZero(0.));
+
+  SolverProxDDP ddp_ref(1e-6, 1e-2, 200);
+  ddp_ref.setup(problem);
+  REQUIRE(ddp_ref.run(problem));
+  for (size_t i = 0; i <= nsteps; i++) {
+    REQUIRE(ddp.results_.xs[i].isApprox(ddp_ref.results_.xs[i], 1e-5));
+  }
+  for (size_t i = 0; i < nsteps; i++) {
+    REQUIRE(ddp.results_.us[i].isApprox(ddp_ref.results_.us[i], 1e-5));
+  }
+}
+
+TEST_CASE("lqr_proxddp_mpc_warm_start") {
+  const size_t nsteps = 50;
+  const TrajOptProblem problem0 = createBoxLqrProblem(nsteps);
+
+  // total number of iterations over the MPC cycles, and the final cost
+  auto run_mpc = [&](bool warm_start) {
+    TrajOptProblem problem = problem0;
+    // start far enough that the control bounds stay active over the cycles
+    problem.setInitState(2.5 * problem0.getInitState());
+    SolverProxDDP ddp(1e-6, 1e-5, 200);
+    ddp.warm_start_ = warm_start;
+    ddp.setup(problem);
+    REQUIRE(ddp.run(problem));
+
+    size_t num_iters = 0;
+    for (size_t i = 0; i < 20; i++) {
+      const VectorXd x1 = ddp.results_.xs[1];
+      problem.replaceStageCircular(problem.stages_[0]);
+      ddp.cycleProblem(problem, problem.stages_[nsteps - 1]->createData());
+      problem.setInitState(x1);
+      // both runs must solve every cycle for the comparison to hold
+      REQUIRE(ddp.run(problem));
+      num_iters += ddp.results_.num_iters;
+    }
+    return std::make_pair(num_iters, ddp.results_.traj_cost_);
+  };
+
+  const auto [iters_cold, cost_cold] = run_mpc(false);
+  const auto [iters_warm, cost_warm] = run_mpc(true);
+  fmt::println("MPC iterations: {:d} (cold), {:d} (warm-start)", iters_cold,
+               iters_warm);
+  REQUIRE(iters_warm < iters_cold);
+  // both runs follow the same closed-loop trajectory
+  REQUIRE(std::abs(cost_warm - cost_cold) <= 1e-6 * std::abs(cost_cold));
+}
+
+/// Callback simulating a slow iteration.
+struct SleepCallback : CallbackBaseTpl<double> {
+  explicit SleepCallback(double seconds)
+      : duration(seconds) {}
+  void call(const WorkspaceBaseTpl<double> &,
+            const ResultsBaseTpl<double> &) override {
+    std::this_thread::sleep_for(duration);
+  }
+  std::chrono::duration<double> duration;
+};
+
+TEST_CASE("lqr_time_limit") {
+  const size_t nsteps = 50;
+
+  SECTION("proxddp") {
+    const TrajOptProblem problem = createBoxLqrProblem(nsteps);
+    SolverProxDDP ddp(1e-6, 1e-2, 200);
+    ddp.sa_strategy_ = StepAcceptanceStrategy::FILTER;
+    ddp.setup(problem);
+
+    // budget exhausted before the first iteration
+    ddp.time_limit_ = 1e-12;
+    REQUIRE_FALSE(ddp.run(problem));
+    REQUIRE(ddp.results_.timed_out);
+    REQUIRE(ddp.results_.num_iters == 0);
+    REQUIRE(ddp.results_.gains_stale);
+    REQUIRE_FALSE(ddp.results_.gains_[0].hasNaN());
+
+    // budget running out during the solve
+    ddp.time_limit_ = 0.05;
+    ddp.registerCallback("sleep", std::make_shared<SleepCallback>(0.1));
+    REQUIRE_FALSE(ddp.run(problem));
+    REQUIRE(ddp.results_.timed_out);
+    REQUIRE(ddp.results_.num_iters == 1);
+    // the best iterate is returned with its gains
+    REQUIRE_FALSE(ddp.results_.gains_stale);
+    REQUIRE_FALSE(ddp.results_.gains_[0].hasNaN());
+    REQUIRE_FALSE(ddp.results_.gains_[0].isZero());
+    REQUIRE(ddp.removeCallback("sleep"));
+
+    ddp.time_limit_ = 10.;
+    REQUIRE(ddp.run(problem));
+    REQUIRE_FALSE(ddp.results_.timed_out);
+    REQUIRE_FALSE(ddp.results_.gains_stale);
+    REQUIRE_FALSE(ddp.results_.gains_[0].hasNaN());
+  }
+
+  SECTION("fddp") {
+    const TrajOptProblem problem = createBoxLqrProblem(nsteps, false);
+    SolverFDDP fddp(1e-6);
+    fddp.setup(problem);
+
+    fddp.time_limit_ = 1e-12;
+    REQUIRE_FALSE(fddp.run(problem));
+    REQUIRE(fddp.results_.timed_out);
+    REQUIRE(fddp.results_.num_iters == 0);
+    REQUIRE(fddp.results_.gains_stale);
+    REQUIRE_FALSE(fddp.results_.gains_[0].hasNaN());
+
+    fddp.time_limit_ = 10.;
+    REQUIRE(fddp.run(problem));
+    REQUIRE_FALSE(fddp.results_.timed_out);
+    REQUIRE_FALSE(fddp.results_.gains_stale);
+    REQUIRE_FALSE(fddp.results_.gains_[0].hasNaN());
+  }
+}
+
+TEST_CASE("lqr_time_limit_best_iterate") {
+  const size_t nsteps = 50;
+  TrajOptProblem problem = createBoxLqrProblem(nsteps);
+  // start far enough that the first step leaves the control bounds
+  problem.setInitState(2.5 * problem.getInitState());
+  // feasible initial guess: zero controls, rolled out
+  std::vector<VectorXd> xs_init, us_init;
+  problem.initializeSolution(xs_init, us_init);
+  rollout(*problem.stages_[0]->dynamics_, problem.getInitState(), us_init,
+          xs_init);
+
+  // the first accepted iterate, and the gains computed at the initial guess
+  SolverProxDDP ddp1(1e-6, 1e-2, 1);
+  ddp1.setup(problem);
+  REQUIRE_FALSE(ddp1.run(problem, xs_init, us_init));
+  REQUIRE(ddp1.results_.num_iters == 1);
+
+  SolverProxDDP ddp(1e-6, 1e-2, 200);
+  ddp.setup(problem);
+  ddp.time_limit_ = 0.05;
+  ddp.registerCallback("sleep", std::make_shared<SleepCallback>(0.1));
+  REQUIRE_FALSE(ddp.run(problem, xs_init, us_init));
+  const auto &res = ddp.results_;
+  REQUIRE(res.timed_out);
+  REQUIRE(res.num_iters == 1);
+  // the accepted iterate is not the best one: the initial guess is returned,
+  // with the gains computed there
+  REQUIRE(ddp1.results_.prim_infeas > std::max(res.prim_infeas, 1e-6));
+  REQUIRE_FALSE(res.gains_stale);
+  for (size_t i = 0; i <= nsteps; i++) {
+    REQUIRE(res.xs[i] == xs_init[i]);
+    REQUIRE(res.gains_[i].isApprox(ddp1.results_.gains_[i]));
+  }
+  for (size_t i = 0; i < nsteps; i++) {
+    REQUIRE(res.us[i] == us_init[i]);
+  }
+}
+
+TEST_CASE("lqr_solver_stats") {
+  const size_t nsteps = 50;
+
+  SECTION("proxddp") {
+    const TrajOptProblem problem = createBoxLqrProblem(nsteps);
+    SolverProxDDP ddp(1e-6, 1e-2, 200);
+    ddp.sa_strategy_ = StepAcceptanceStrategy::FILTER;
+    ddp.setup(problem);
+
+    Stopwatch sw_run;
+    REQUIRE(ddp.run(problem));
+    const double wall_time = sw_run.lap();
+
+    const SolverStats &stats = ddp.results_.stats;
+    fmt::println("ProxDDP: {:d} iters, {:d} merit evals, {:.3e} s, {:d} bytes",
+                 ddp.results_.num_iters, stats.num_merit_evals, stats.total(),
+                 stats.bytes_allocated);
+    REQUIRE(stats.num_merit_evals >= ddp.results_.num_iters);
+    REQUIRE(stats.derivatives > 0.);
+    REQUIRE(stats.lq_assembly > 0.);
+    REQUIRE(stats.backward > 0.);
+    REQUIRE(stats.linesearch > 0.);
+    REQUIRE(stats.total() <= wall_time);
+  }
+
+  SECTION("fddp") {
+    const TrajOptProblem problem = createBoxLqrProblem(nsteps, false);
+    SolverFDDP fddp(1e-6);
+    fddp.setup(problem);
+    REQUIRE(fddp.run(problem));
+
+    const SolverStats &stats = fddp.results_.stats;
+    REQUIRE(stats.num_merit_evals >= fddp.results_.num_iters);
+    REQUIRE(stats.derivatives > 0.);
+    REQUIRE(stats.backward > 0.);
+    REQUIRE(stats.lq_assembly == 0.);
+  }
+}
+
+TEST_CASE("lqr_proxddp_constant_derivatives") {
+  using CostStack = CostStackTpl<double>;
+  using QuadraticControlCost = QuadraticControlCostTpl<double>;
+  const size_t nsteps = 50;
+  const auto nx = 4;
+  const auto nu = 2;
+  TrajOptProblem problem = createBoxLqrProblem(nsteps, false);
+  const VectorSpaceTpl<double> space(nx);
+  const VectorXd umax = VectorXd::Constant(nu, 10.);
+  for (auto &stage : problem.stages_) {
+    stage->addConstraint(ControlErrorResidualTpl<double>(nx, nu),
+                         BoxConstraintTpl<double>(-umax, umax));
+    CostStack cost(space, nu);
+    const MatrixXd wx = MatrixXd::Identity(nx, nx);
+    cost.addCost("x", QuadraticStateCostTpl<double>(space, nu,
+                                                    VectorXd::Ones(nx), wx));
+    cost.addCost("u", QuadraticControlCost(space, nu,
+                                           MatrixXd::Identity(nu, nu) * 1e-2));
+    stage->cost_ = cost;
+    REQUIRE(stage->cost_->hasConstantHessians());
+    REQUIRE(stage->dynamics_->hasConstantJacobians());
+    REQUIRE(stage->constraints_.funcs[0]->hasConstantJacobians());
+  }
+  auto *ucost = problem.stages_[0]
+                    ->getCost<CostStack>()
+                    ->getComponent<QuadraticControlCost>("u");
+  ucost->gauss_newton = false;
+  REQUIRE_FALSE(problem.stages_[0]->cost_->hasConstantHessians());
+  ucost->gauss_newton = true;
+
+  auto solve = [](SolverProxDDP &ddp, const TrajOptProblem &p) {
+    REQUIRE(ddp.run(p));
+    return ddp.results_;
+  };
+  SolverProxDDP ddp(1e-6, 1e-2, 200);
+  ddp.setup(problem);
+  solve(ddp, problem);
+  for (const auto &sd : ddp.workspace_.problem_data.stage_data) {
+    REQUIRE(sd->constant_jacobians_ready);
+    REQUIRE(sd->constant_hessians_ready);
+  }
+
+  // the cached derivatives are dropped between solves
+  for (size_t i = 0; i < nsteps; i++) {
+    problem.stages_[i]
+        ->getCost<CostStack>()
+        ->getComponent<QuadraticControlCost>("u")
+        ->weights_ *= 5.;
+  }
+  const auto res = solve(ddp, problem);
+  SolverProxDDP ddp_ref(1e-6, 1e-2, 200);
+  ddp_ref.setup(problem);
+  const auto res_ref = solve(ddp_ref, problem);
+  for (size_t i = 0; i < nsteps; i++) {
+    REQUIRE(res.us[i].isApprox(res_ref.us[i], 1e-6));
+  }
+
+  // the stage data does not cache outside of the solvers
+  auto data = problem.stages_[0]->createData();
+  problem.stages_[0]->computeSecondOrderDerivatives(res.xs[0], res.us[0],
+                                                    *data);
+  REQUIRE_FALSE(data->constant_hessians_ready);
+}
+
+#ifdef ALIGATOR_MULTITHREADING
+TEST_CASE("lqr_proxddp_parallel_rollout_free_x0") {
+  const size_t nsteps = 50;
+  const TrajOptProblem problem = createBoxLqrProblem(nsteps, false);
+
+  // initial guess away from the initial condition, so that the step on x0
+  // does not vanish
+  std::vector<VectorXd> xs_init, us_init;
+  problem.initializeSolution(xs_init, us_init);
+  xs_init[0] += VectorXd::Ones(xs_init[0].size());
+
+  auto solve = [&](LQSolverChoice choice) {
+    SolverProxDDP ddp(1e-6, 1e-8, 10);
+    ddp.rollout_type_ = RolloutType::NONLINEAR;
+    ddp.force_initial_condition_ = false;
+    ddp.linear_solver_choice = choice;
+    ddp.setNumThreads(4);
+    ddp.setup(problem);
+    REQUIRE(ddp.run(problem, xs_init, us_init));
+    return std::move(ddp.results_);
+  };
+
+  auto res_serial = solve(LQSolverChoice::SERIAL);
+  auto res_parallel = solve(LQSolverChoice::PARALLEL);
+  // the rollout of linear dynamics is the LQ step: both solvers take the
+  // same single step
+  REQUIRE(res_serial.num_iters == 1);
+  REQUIRE(res_parallel.num_iters == res_serial.num_iters);
+  for (size_t i = 0; i <= nsteps; i++) {
+    REQUIRE(res_serial.xs[i].isApprox(res_parallel.xs[i], 1e-8));
+  }
+  for (size_t i = 0; i < nsteps; i++) {
+    REQUIRE(res_serial.us[i].isApprox(res_parallel.us[i], 1e-8));
+  }
+}
+#endif
@@ -1,6 +1,7 @@
 #include "aligator/core/manifold-base.hpp"
 #include "aligator/core/vector-space.hpp"
 #include "aligator/modelling/spaces/cartesian-product.hpp"
+#include "aligator/modelling/spaces/tangent-bundle.hpp"
 
 #ifdef ALIGATOR_WITH_PINOCCHIO
 #include <pinocchio/config.hpp>
@@ -11,6 +12,8 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include "test_util/manifolds.hpp"
+
 using namespace aligator;
 using xyz::polymorphic;
 using Manifold = ManifoldAbstractTpl<double>;
@@ -52,6 +55,81 @@ TEST_CASE("test_vectorspace") {
   x1 = prod2.rand();
 }
 
+TEST_CASE("non_euclidean_dim_vectorspace") {
+  const VectorSpace vs1(3);
+  const VectorSpace vs2(4);
+  REQUIRE(vs1.isEuclidean());
+  REQUIRE(vs1.nonEuclideanDim() == 0);
+
+  const CartesianProductTpl<double> prod(vs1, vs2);
+  REQUIRE(prod.isEuclidean());
+  REQUIRE(VectorSpaceTpl<double, 2>().isEuclidean());
+
+  // the transport is a no-op
+  Eigen::MatrixXd J = Eigen::MatrixXd::Random(7, 2);
+  const Eigen::MatrixXd J0 = J;
+  const Eigen::VectorXd x = prod.rand();
+  prod.JintegrateTransport(x, Eigen::VectorXd::Random(7), J, 1);
+  REQUIRE(J == J0);
+}
+
+/// Compare the batched operations to those on each knot.
+void check_batch_operations(const Manifold &space, const int nknots) {
+  const int nx = space.nx();
+  const int ndx = space.ndx();
+  Eigen::MatrixXd xs(nx, nknots), ys(nx, nknots);
+  const Eigen::MatrixXd vs = Eigen::MatrixXd::Random(ndx, nknots);
+  for (int i = 0; i < nknots; i++) {
+    xs.col(i) = space.rand();
+    ys.col(i) = space.rand();
+  }
+  const double alpha = 0.3;
+
+  Eigen::MatrixXd out(nx, nknots);
+  Eigen::MatrixXd dout(ndx, nknots);
+  Eigen::MatrixXd Jout(ndx, ndx * nknots);
+  space.integrateBatch(xs, vs, alpha, out);
+  space.differenceBatch(xs, ys, dout);
+  for (int arg = 0; arg < 2; arg++) {
+    space.JdifferenceBatch(xs, ys, Jout, arg);
+    for (int i = 0; i < nknots; i++) {
+      Eigen::MatrixXd J(ndx, ndx);
+      space.Jdifference(xs.col(i), ys.col(i), J, arg);
+      REQUIRE(Jout.middleCols(i * ndx, ndx).isApprox(J));
+    }
+  }
+  for (int i = 0; i < nknots; i++) {
+    const Eigen::VectorXd v = alpha * vs.col(i);
+    REQUIRE(out.col(i).isApprox(space.integrate(xs.col(i), v)));
+    REQUIRE(dout.col(i).isApprox(space.difference(xs.col(i), ys.col(i))));
+  }
+
+  // a single knot, e.g. a vector of a trajectory
+  Eigen::VectorXd x = xs.col(0);
+  Eigen::VectorXd y(nx);
+  space.integrateBatch(x, vs.col(0), alpha, y);
+  REQUIRE(y.isApprox(out.col(0)));
+}
+
+TEST_CASE("batch_operations") {
+  const VectorSpace vs1(3);
+  const VectorSpace vs2(5);
+  check_batch_operations(vs1, 7);
+  check_batch_operations(CartesianProductTpl<double>(vs1, vs2), 7);
+  check_batch_operations(TangentBundleTpl<VectorSpace>(vs1), 7);
+  check_batch_operations(LoopedVectorSpace(3), 7);
+#ifdef ALIGATOR_WITH_PINOCCHIO
+  const polymorphic<Manifold> se2{SETpl<2, double>()};
+  check_batch_operations(*se2, 7);
+  check_batch_operations(se2 * polymorphic<Manifold>(vs2), 7);
+
+  pinocchio::Model model;
+  pinocchio::buildModels::humanoidRandom(model, true);
+  check_batch_operations(MultibodyPhaseSpace<double>(model), 7);
+  check_batch_operations(MultibodyConfiguration<double>(model), 7);
+#endif
+}
+
 #ifdef ALIGATOR_WITH_PINOCCHIO
 
 TEST_CASE("test_lg_vecspace") {
@@ -150,6 +228,42 @@ TEST_CASE("test_pinmodel") {
   REQUIRE(d.isApprox(pinocchio::difference(model, x0, x1)));
 }
 
+TEST_CASE("non_euclidean_dim_multibody") {
+  const polymorphic<Manifold> se2{SETpl<2, double>()};
+  const polymorphic<Manifold> vs{VectorSpace(3)};
+  REQUIRE(se2->nonEuclideanDim() == 3);
+  REQUIRE((se2 * vs).nonEuclideanDim() == 3);
+  REQUIRE((vs * se2).nonEuclideanDim() == 6);
+  REQUIRE((vs * vs).isEuclidean());
+
+  pinocchio::Model model;
+  auto jid = model.addJoint(0, pinocchio::JointModelFreeFlyer(),
+                            pinocchio::SE3::Identity(), "root");
+  jid = model.addJoint(jid, pinocchio::JointModelRX(),
+                       pinocchio::SE3::Random(), "joint1");
+  model.addJoint(jid, pinocchio::JointModelRY(), pinocchio::SE3::Random(),
+                 "joint2");
+  const MultibodyConfiguration<double> config_space(model);
+  const MultibodyPhaseSpace<double> space(model);
+  REQUIRE(config_space.nonEuclideanDim() == 6);
+  REQUIRE(space.nonEuclideanDim() == 6);
+  REQUIRE(!space.isEuclidean());
+
+  // the Jacobians are identities past the free-flyer block
+  const int ndx = space.ndx();
+  const auto x0 = space.rand();
+  const Eigen::VectorXd dx = Eigen::VectorXd::Random(ndx);
+  Eigen::MatrixXd J(ndx, ndx);
+  space.Jintegrate(x0, dx, J, 0);
+  REQUIRE(J.bottomRightCorner(ndx - 6, ndx - 6).isIdentity());
+  REQUIRE(J.topRightCorner(6, ndx - 6).isZero());
+  REQUIRE(J.bottomLeftCorner(ndx - 6, 6).isZero());
+
+  pinocchio::Model fixed_model;
+  pinocchio::buildModels::manipulator(fixed_model);
+  REQUIRE(MultibodyPhaseSpace<double>(fixed_model).isEuclidean());
+}
+
 /// Test the tangent bundle specialization on rigid multibodies.
 TEST_CASE("tangentbundle_multibody") {
   pinocchio::Model model;
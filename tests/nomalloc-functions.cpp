@@ -0,0 +1,281 @@
+/// @file
+/// @brief The centroidal and multibody functions do not allocate once their
+/// data is created, nor do the batched manifold operations.
+/// @copyright Copyright (C) 2026 INRIA
+#include "aligator/modelling/centroidal/angular-acceleration.hpp"
+#include "aligator/modelling/centroidal/angular-momentum.hpp"
+#include "aligator/modelling/centroidal/centroidal-acceleration.hpp"
+#include "aligator/modelling/centroidal/centroidal-friction-cone.hpp"
+#include "aligator/modelling/centroidal/centroidal-translation.hpp"
+#include "aligator/modelling/centroidal/centroidal-wrapper.hpp"
+#include "aligator/modelling/centroidal/centroidal-wrench-cone.hpp"
+#include "aligator/modelling/centroidal/linear-momentum.hpp"
+#include "aligator/modelling/centroidal/multi-contact-friction-cone.hpp"
+#include "aligator/modelling/centroidal/multi-contact-wrench-cone.hpp"
+#include "aligator/core/shared-data-scope.hpp"
+#include "aligator/modelling/spaces/cartesian-product.hpp"
+#include "aligator/modelling/spaces/tangent-bundle.hpp"
+
+#ifdef ALIGATOR_WITH_PINOCCHIO
+#include "aligator/modelling/multibody/center-of-mass-translation.hpp"
+#include "aligator/modelling/multibody/center-of-mass-velocity.hpp"
+#include "aligator/modelling/multibody/centroidal-momentum.hpp"
+#include "aligator/modelling/multibody/centroidal-momentum-derivative.hpp"
+#include "aligator/modelling/multibody/contact-force.hpp"
+#include "aligator/modelling/multibody/dcm-position.hpp"
+#include "aligator/modelling/multibody/fly-high.hpp"
+#include "aligator/modelling/multibody/frame-collision.hpp"
+#include "aligator/modelling/multibody/frame-equality.hpp"
+#include "aligator/modelling/multibody/frame-placement.hpp"
+#include "aligator/modelling/multibody/frame-translation.hpp"
+#include "aligator/modelling/multibody/frame-velocity.hpp"
+#include "aligator/modelling/multibody/gravity-compensation-residual.hpp"
+#include "aligator/modelling/multibody/multi-frame-collision.hpp"
+#include "aligator/modelling/multibody/multibody-friction-cone.hpp"
+#include "aligator/modelling/multibody/multibody-wrench-cone.hpp"
+#include "aligator/modelling/spaces/multibody.hpp"
+
+#include <pinocchio/multibody/sample-models.hpp>
+#include <pinocchio/algorithm/joint-configuration.hpp>
+
+#include "test_util/pinocchio.hpp"
+#endif
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "test_util/manifolds.hpp"
+
+using namespace aligator;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+using StageFunction = StageFunctionTpl<double>;
+using StageFunctionData = StageFunctionDataTpl<double>;
+
+/// Evaluate @p funs and their derivatives at two points, with malloc forbidden.
+/// The datas of @p funs are created in the same SharedDataScope, as in a
+/// stage.
+void checkNoMalloc(const std::vector<xyz::polymorphic<StageFunction>> &funs,
+                   const VectorXd &x0, const VectorXd &x1, const VectorXd &u) {
+  std::vector<shared_ptr<StageFunctionData>> datas;
+  std::vector<VectorXd> lbdas;
+  {
+    SharedDataScope scope;
+    for (const auto &fun : funs) {
+      datas.push_back(fun->createData());
+      lbdas.push_back(VectorXd::Ones(fun->nr));
+    }
+  }
+  for (const VectorXd *x : {&x0, &x1}) {
+    ALIGATOR_NOMALLOC_SCOPED;
+    for (std::size_t i = 0; i < funs.size(); i++) {
+      const StageFunction &fun = *funs[i];
+      fun.evaluate(*x, u, *datas[i]);
+      fun.computeJacobians(*x, u, *datas[i]);
+      fun.computeVectorHessianProducts(*x, u, lbdas[i], *datas[i]);
+    }
+  }
+}
+
+TEST_CASE("centroidal", "[nomalloc]") {
+  using ContactMap = ContactMapTpl<double>;
+  const int ndx = 9;
+  const int nk = 2;
+  const double mass = 10.;
+  const Eigen::Vector3d gravity(0., 0., -9.81);
+  const ContactMap contact_map(
+      {"left", "right"}, {true, true},
+      {Eigen::Vector3d(0., 0.1, 0.), Eigen::Vector3d(0., -0.1, 0.)});
+  const VectorXd x0 = VectorXd::Random(ndx);
+  const VectorXd x1 = VectorXd::Random(ndx);
+
+  SECTION("3d forces") {
+    const int nu = 3 * nk;
+    const VectorXd u = VectorXd::Random(nu);
+    const Eigen::Vector3d ref = Eigen::Vector3d::Random();
+    std::vector<xyz::polymorphic<StageFunction>> funs;
+    funs.emplace_back(CentroidalCoMResidualTpl<double>(ndx, nu, ref));
+    funs.emplace_back(LinearMomentumResidualTpl<double>(ndx, nu, ref));
+    funs.emplace_back(AngularMomentumResidualTpl<double>(ndx, nu, ref));
+    funs.emplace_back(CentroidalAccelerationResidualTpl<double>(
+        ndx, nu, mass, gravity, contact_map, 3));
+    funs.emplace_back(AngularAccelerationResidualTpl<double>(
+        ndx, nu, mass, gravity, contact_map, 3));
+    funs.emplace_back(
+        CentroidalFrictionConeResidualTpl<double>(ndx, nu, 1, 0.7, 0.));
+    funs.emplace_back(
+        MultiContactFrictionConeResidualTpl<double>(ndx, nu, {0, 1}, 0.7, 0.));
+    funs.emplace_back(
+        CentroidalWrapperResidualTpl<double>(CentroidalCoMResidualTpl<double>(
+            ndx, nu, ref)));
+    checkNoMalloc(funs, x0, x1, u);
+  }
+
+  SECTION("6d forces") {
+    const int nu = 6 * nk;
+    const VectorXd u = VectorXd::Random(nu);
+    std::vector<xyz::polymorphic<StageFunction>> funs;
+    funs.emplace_back(CentroidalAccelerationResidualTpl<double>(
+        ndx, nu, mass, gravity, contact_map, 6));
+    funs.emplace_back(AngularAccelerationResidualTpl<double>(
+        ndx, nu, mass, gravity, contact_map, 6));
+    funs.emplace_back(
+        CentroidalWrenchConeResidualTpl<double>(ndx, nu, 0, 0.7, 0.1, 0.05));
+    funs.emplace_back(MultiContactWrenchConeResidualTpl<double>(
+        ndx, nu, {0, 1}, 0.7, 0.1, 0.05));
+    checkNoMalloc(funs, x0, x1, u);
+  }
+}
+
+/// Integrate with a step size (which scales the increments) and take the
+/// differences of @p nknots knots, with malloc forbidden.
+void checkBatchNoMalloc(const ManifoldAbstractTpl<double> &space,
+                        const int nknots) {
+  MatrixXd xs(space.nx(), nknots), out(space.nx(), nknots);
+  for (int i = 0; i < nknots; i++)
+    xs.col(i) = space.rand();
+  const MatrixXd vs = MatrixXd::Random(space.ndx(), nknots);
+  MatrixXd dout(space.ndx(), nknots);
+  // a single knot, as passed by the solvers
+  const VectorXd x = xs.col(0);
+  VectorXd y(space.nx());
+  ALIGATOR_NOMALLOC_SCOPED;
+  space.integrateBatch(xs, vs, 0.5, out);
+  space.differenceBatch(xs, out, dout);
+  space.integrateBatch(x, dout.col(0), 0.5, y);
+}
+
+TEST_CASE("manifold_batch", "[nomalloc]") {
+  using VectorSpace = VectorSpaceTpl<double>;
+  const VectorSpace vs1(3);
+  const LoopedVectorSpace looped(5);
+  checkBatchNoMalloc(vs1, 4);
+  checkBatchNoMalloc(looped, 4);
+  checkBatchNoMalloc(CartesianProductTpl<double>(vs1, looped), 4);
+  checkBatchNoMalloc(TangentBundleTpl<LoopedVectorSpace>(looped), 4);
+#ifdef ALIGATOR_WITH_PINOCCHIO
+  pinocchio::Model model;
+  pinocchio::buildModels::humanoidRandom(model, true);
+  checkBatchNoMalloc(MultibodyConfiguration<double>(model), 4);
+  checkBatchNoMalloc(MultibodyPhaseSpace<double>(model), 4);
+#endif
+}
+
+#ifdef ALIGATOR_WITH_PINOCCHIO
+namespace pin = pinocchio;
+
+TEST_CASE("multibody", "[nomalloc]") {
+  pin::Model model;
+  pin::buildModels::humanoidRandom(model, true);
+  const int nv = model.nv;
+  const int ndx = 2 * nv;
+  const auto make_state = [&] {
+    VectorXd x(model.nq + nv);
+    x << pin::randomConfiguration(model), VectorXd::Random(nv);
+    return x;
+  };
+  const VectorXd x0 = make_state();
+  const VectorXd x1 = make_state();
+  const auto lfoot = model.getFrameId("lleg6_joint");
+  const auto rfoot = model.getFrameId("rleg6_joint");
+  // the functions share the model, hence their kinematics cache, as in a
+  // stage built from MultibodyPhaseSpace::getModelHandle()
+  const auto handle = std::make_shared<const pin::Model>(model);
+
+  SECTION("kinematics") {
+    const int nu = nv - 6;
+    const VectorXd u = VectorXd::Random(nu);
+    const Eigen::Vector3d p = Eigen::Vector3d::Random();
+    std::vector<xyz::polymorphic<StageFunction>> funs;
+    funs.emplace_back(FramePlacementResidualTpl<double>(
+        ndx, nu, handle, pin::SE3::Random(), lfoot));
+    funs.emplace_back(
+        FrameTranslationResidualTpl<double>(ndx, nu, handle, p, lfoot));
+    funs.emplace_back(FrameVelocityResidualTpl<double>(
+        ndx, nu, handle, pin::Motion::Random(), lfoot, pin::LOCAL));
+    funs.emplace_back(FrameVelocityResidualTpl<double>(
+        ndx, nu, handle, pin::Motion::Random(), rfoot,
+        pin::LOCAL_WORLD_ALIGNED));
+    funs.emplace_back(FrameEqualityResidualTpl<double>(
+        ndx, nu, handle, lfoot, rfoot, pin::SE3::Random()));
+    funs.emplace_back(FlyHighResidualTpl<double>(ndx, handle, rfoot, 2., nu));
+    funs.emplace_back(
+        CenterOfMassTranslationResidualTpl<double>(ndx, nu, handle, p));
+    funs.emplace_back(
+        CenterOfMassVelocityResidualTpl<double>(ndx, nu, handle, p));
+    funs.emplace_back(DCMPositionResidualTpl<double>(ndx, nu, handle, p, 0.3));
+    funs.emplace_back(CentroidalMomentumResidualTpl<double>(
+        ndx, nu, handle, Eigen::Matrix<double, 6, 1>::Random()));
+    funs.emplace_back(GravityCompensationResidualTpl<double>(
+        ndx, MatrixXd::Identity(nv, nu), handle));
+    checkNoMalloc(funs, x0, x1, u);
+  }
+
+  SECTION("centroidal momentum derivative") {
+    const int force_size = 3;
+    const int nu = 2 * force_size + nv - 6;
+    const VectorXd u = VectorXd::Random(nu);
+    std::vector<xyz::polymorphic<StageFunction>> funs;
+    funs.emplace_back(CentroidalMomentumDerivativeResidualTpl<double>(
+        ndx, handle, Eigen::Vector3d(0., 0., -9.81), {true, true},
+        {lfoot, rfoot}, force_size));
+    checkNoMalloc(funs, x0, x1, u);
+  }
+
+  SECTION("contacts") {
+    const int nu = nv - 6;
+    const VectorXd u = VectorXd::Random(nu);
+    MatrixXd actuation = MatrixXd::Zero(nv, nu);
+    actuation.bottomRows(nu).setIdentity();
+    context::RCMVector constraint_models;
+    for (const char *name : {"lleg6_joint", "rleg6_joint"}) {
+      context::RCM cm(pin::CONTACT_6D, model, model.getJointId(name),
+                      pin::LOCAL);
+      set_baumgarte_gains(cm, 10.);
+      cm.name = name;
+      constraint_models.push_back(cm);
+    }
+    const pin::ProximalSettingsTpl<double> prox_settings(1e-12, 0., 1);
+    Eigen::Matrix<double, -1, 1, Eigen::ColMajor, 6, 1> fref(6);
+    fref.setRandom();
+    std::vector<xyz::polymorphic<StageFunction>> funs;
+    funs.emplace_back(ContactForceResidualTpl<double>(
+        ndx, handle, actuation, constraint_models, prox_settings, fref,
+        "lleg6_joint"));
+    funs.emplace_back(MultibodyFrictionConeResidualTpl<double>(
+        ndx, handle, actuation, constraint_models, prox_settings, "lleg6_joint",
+        0.7));
+    funs.emplace_back(MultibodyWrenchConeResidualTpl<double>(
+        ndx, handle, actuation, constraint_models, prox_settings, "rleg6_joint",
+        0.7, 0.1, 0.05));
+    checkNoMalloc(funs, x0, x1, u);
+  }
+
+#if defined(PINOCCHIO_WITH_HPP_FCL) || defined(PINOCCHIO_WITH_COAL)
+  SECTION("collision") {
+    pin::Model manipulator;
+    pin::GeometryModel geom_model;
+    pin::buildModels::manipulator(manipulator);
+    pin::buildModels::manipulatorGeometries(manipulator, geom_model);
+    geom_model.addAllCollisionPairs();
+    const int mnv = manipulator.nv;
+    const VectorXd u = VectorXd::Random(mnv);
+    VectorXd y0(manipulator.nq + mnv), y1(manipulator.nq + mnv);
+    y0 << pin::randomConfiguration(manipulator), VectorXd::Random(mnv);
+    y1 << pin::randomConfiguration(manipulator), VectorXd::Random(mnv);
+    const auto manipulator_handle =
+        std::make_shared<const pin::Model>(manipulator);
+    std::vector<xyz::polymorphic<StageFunction>> funs;
+    for (pin::PairIndex i = 0; i < geom_model.collisionPairs.size(); i++) {
+      funs.emplace_back(FrameCollisionResidualTpl<double>(
+          2 * mnv, mnv, manipulator_handle, geom_model, i));
+    }
+    funs.emplace_back(MultiFrameCollisionResidualTpl<double>(
+        2 * mnv, mnv, manipulator_handle, geom_model));
+    // with the pairs farther apart than their bounding boxes culled
+    funs.emplace_back(MultiFrameCollisionResidualTpl<double>(
+        2 * mnv, mnv, manipulator_handle, geom_model, {}, 0.));
+    checkNoMalloc(funs, y0, y1, u);
+  }
+#endif
+}
+#endif
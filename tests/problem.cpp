@@ -8,11 +8,15 @@
 #include "aligator/core/cost-abstract.hpp"
 #include "aligator/utils/rollout.hpp"
 #include "aligator/modelling/constraints/equality-constraint.hpp"
+#include "aligator/modelling/constraints/box-constraint.hpp"
 #ifdef ALIGATOR_WITH_PINOCCHIO
 #include "aligator/modelling/spaces/pinocchio-groups.hpp"
 #else
 #include "aligator/core/vector-space.hpp"
 #endif
+#include "aligator/modelling/costs/quad-costs.hpp"
+#include "aligator/modelling/dynamics/integrator-euler.hpp"
+#include "aligator/modelling/dynamics/wheeled-inverted-pendulum.hpp"
 #include "aligator/third-party/polymorphic_cxx14.h"
 // #include <boost/test/unit_test.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -20,6 +24,8 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include <memory_resource>
+
 using namespace aligator;
 
 /// @brief    Addition dynamics.
@@ -235,3 +241,210 @@ TEST_CASE("test_constant_init", "[node]") {
     REQUIRE(prev_xs[i] == state);
   }
 }
+
+/// Counts the allocations made through it.
+struct CountingResource : std::pmr::memory_resource {
+  std::size_t num_allocs = 0;
+
+private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    num_allocs++;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST_CASE("test_data_arena", "[node]") {
+  MyFixture f;
+  const auto nsteps = f.problem.numSteps();
+  std::vector<Eigen::VectorXd> xs(nsteps + 1, f.problem.getInitState());
+  std::vector<Eigen::VectorXd> us(nsteps, Eigen::VectorXd::Ones(f.nu));
+
+  TrajOptDataTpl<double> data(f.problem);
+  f.problem.evaluate(xs, us, data);
+  f.problem.computeDerivatives(xs, us, data);
+
+  for (auto &stage : f.problem.stages_) {
+    stage->use_data_arena_ = true;
+    // the arena is allocated at once, and holds all the buffers of the stage
+    CountingResource counter;
+    std::pmr::memory_resource *prev = std::pmr::set_default_resource(&counter);
+    shared_ptr<StageDataTpl<double>> stage_data = stage->createData();
+    std::pmr::set_default_resource(prev);
+    REQUIRE(stage_data->arena != nullptr);
+    REQUIRE(counter.num_allocs == 1);
+  }
+
+  TrajOptDataTpl<double> arena_data(f.problem);
+  f.problem.evaluate(xs, us, arena_data);
+  f.problem.computeDerivatives(xs, us, arena_data);
+  for (std::size_t i = 0; i < nsteps; i++) {
+    const StageDataTpl<double> &sd = *data.stage_data[i];
+    const StageDataTpl<double> &ad = *arena_data.stage_data[i];
+    REQUIRE(ad.arena != nullptr);
+    REQUIRE(sd.arena == nullptr);
+    REQUIRE(ad.dynamics_data->xnext_ == sd.dynamics_data->xnext_);
+    REQUIRE(ad.dynamics_data->jac_buffer_ == sd.dynamics_data->jac_buffer_);
+    REQUIRE(ad.cost_data->grad_ == sd.cost_data->grad_);
+    for (std::size_t j = 0; j < sd.constraint_data.size(); j++) {
+      REQUIRE(ad.constraint_data[j]->value_ == sd.constraint_data[j]->value_);
+      REQUIRE(ad.constraint_data[j]->jac_buffer_ ==
+              sd.constraint_data[j]->jac_buffer_);
+    }
+  }
+}
+
+TEST_CASE("test_speculative_linesearch_backtracking", "[solver]") {
+  using ODE = dynamics::WheeledInvertedPendulumDynamicsTpl<double>;
+  using Euler = dynamics::IntegratorEulerTpl<double>;
+  using Eigen::MatrixXd;
+  using Eigen::VectorXd;
+  const size_t nsteps = 40;
+  const double dt = 0.02;
+
+  const Euler dyn_model(ODE(9.81, 1.0), dt);
+  const int nx = dyn_model.ndx1();
+  const int nu = dyn_model.nu;
+  const QuadraticCostTpl<double> cost(MatrixXd::Identity(nx, nx) * dt,
+                                      MatrixXd::Identity(nu, nu) * 1e-2 * dt);
+  const QuadraticCostTpl<double> term_cost(10. * MatrixXd::Identity(nx, nx),
+                                           MatrixXd());
+  StageModel stage(cost, dyn_model);
+  const VectorXd umax = VectorXd::Ones(nu);
+  stage.addConstraint(ControlErrorResidualTpl<double>(nx, nu),
+                      BoxConstraintTpl<double>(-umax, umax));
+
+  VectorXd x0 = VectorXd::Zero(nx);
+  x0[2] = 0.3;
+  std::vector<xyz::polymorphic<StageModel>> stages(nsteps, stage);
+  TrajOptProblemTpl<double> problem(x0, stages, term_cost);
+
+  // the input bounds make the linesearch backtrack from the first iterations
+  auto solve = [&](StepAcceptanceStrategy strategy, RolloutType rollout,
+                   size_t num_lanes) {
+    SolverProxDDPTpl<double> ddp(1e-6, 1e-2, 20);
+    ddp.sa_strategy_ = strategy;
+    ddp.rollout_type_ = rollout;
+    ddp.ls_params.interp_type = LSInterpolation::BISECTION;
+    ddp.speculative_ls_lanes = num_lanes;
+    ddp.setup(problem);
+    ddp.run(problem);
+    return std::move(ddp.results_);
+  };
+
+  for (auto rollout : {RolloutType::LINEAR, RolloutType::NONLINEAR}) {
+    for (auto strategy : {StepAcceptanceStrategy::LINESEARCH_ARMIJO,
+                          StepAcceptanceStrategy::LINESEARCH_NONMONOTONE,
+                          StepAcceptanceStrategy::FILTER}) {
+      auto res_ref = solve(strategy, rollout, 1);
+      auto res_spec = solve(strategy, rollout, 4);
+      REQUIRE(res_ref.stats.num_merit_evals > res_ref.num_iters);
+      REQUIRE(res_ref.stats.num_ls_lane_hits == 0);
+      REQUIRE(res_ref.stats.num_ls_lane_evals == 0);
+      // backtracking steps were served by lanes evaluated ahead, which are
+      // never the first lane
+      REQUIRE(res_spec.stats.num_ls_lane_hits > 0);
+      // the misses evaluate several lanes each
+      REQUIRE(res_spec.stats.num_ls_lane_evals >
+              res_spec.stats.num_merit_evals - res_spec.stats.num_ls_lane_hits);
+      REQUIRE(res_ref.num_iters == res_spec.num_iters);
+      REQUIRE(res_ref.stats.num_merit_evals ==
+              res_spec.stats.num_merit_evals);
+      for (size_t i = 0; i <= nsteps; i++) {
+        REQUIRE(res_ref.xs[i].isApprox(res_spec.xs[i]));
+      }
+      for (size_t i = 0; i < nsteps; i++) {
+        REQUIRE(res_ref.us[i].isApprox(res_spec.us[i]));
+      }
+    }
+  }
+}
+
+#ifdef ALIGATOR_MULTITHREADING
+TEST_CASE("test_nonlinear_rollout_parallel", "[solver]") {
+  using ODE = dynamics::WheeledInvertedPendulumDynamicsTpl<double>;
+  using Euler = dynamics::IntegratorEulerTpl<double>;
+  using Eigen::MatrixXd;
+  using Eigen::VectorXd;
+  const size_t nsteps = 40;
+  const double dt = 0.02;
+
+  const Euler dyn_model(ODE(9.81, 1.0), dt);
+  const int nx = dyn_model.ndx1();
+  const int nu = dyn_model.nu;
+  const QuadraticCostTpl<double> cost(MatrixXd::Identity(nx, nx) * dt,
+                                      MatrixXd::Identity(nu, nu) * 1e-2 * dt);
+  const QuadraticCostTpl<double> term_cost(MatrixXd::Identity(nx, nx),
+                                           MatrixXd());
+
+  VectorXd x0 = VectorXd::Zero(nx);
+  x0[2] = 0.3;
+  std::vector<xyz::polymorphic<StageModel>> stages(
+      nsteps, StageModel(cost, dyn_model));
+  TrajOptProblemTpl<double> problem(x0, stages, term_cost);
+
+  auto solve = [&](LQSolverChoice choice) {
+    SolverProxDDPTpl<double> ddp(1e-6, 1e-6, 100);
+    ddp.rollout_type_ = RolloutType::NONLINEAR;
+    ddp.linear_solver_choice = choice;
+    ddp.setNumThreads(4);
+    ddp.setup(problem);
+    REQUIRE(ddp.run(problem));
+    return std::move(ddp.results_);
+  };
+
+  auto res_serial = solve(LQSolverChoice::SERIAL);
+  auto res_parallel = solve(LQSolverChoice::PARALLEL);
+  // dynamical defects at the leg boundaries vanish at convergence
+  REQUIRE(res_parallel.prim_infeas <= 1e-6);
+  for (size_t i = 0; i <= nsteps; i++) {
+    REQUIRE(res_serial.xs[i].isApprox(res_parallel.xs[i], 1e-4));
+  }
+
+  // the legs give the same trial point whether they are rolled out
+  // concurrently or one after the other (as in a speculative lane)
+  SolverProxDDPTpl<double> ddp(1e-6, 1e-6, 1);
+  ddp.rollout_type_ = RolloutType::NONLINEAR;
+  ddp.linear_solver_choice = LQSolverChoice::PARALLEL;
+  ddp.setNumThreads(4);
+  ddp.setup(problem);
+  ddp.run(problem);
+  using Workspace = WorkspaceTpl<double>;
+  Workspace ws_par = Workspace::trialPoint(problem);
+  Workspace ws_seq = Workspace::trialPoint(problem);
+  const double phi_par = ddp.tryNonlinearRollout(problem, 0.5, ws_par, 4);
+  const double phi_seq = ddp.tryNonlinearRollout(problem, 0.5, ws_seq, 1);
+  REQUIRE(phi_par == phi_seq);
+  for (size_t i = 0; i <= nsteps; i++) {
+    REQUIRE(ws_par.trial_xs[i].isApprox(ws_seq.trial_xs[i]));
+  }
+  for (size_t i = 0; i < nsteps; i++) {
+    REQUIRE(ws_par.trial_us[i].isApprox(ws_seq.trial_us[i]));
+  }
+
+  // speculative lanes roll out their legs one after the other
+  auto solve_spec = [&](size_t num_lanes) {
+    SolverProxDDPTpl<double> ddp(1e-6, 1e-6, 100);
+    ddp.rollout_type_ = RolloutType::NONLINEAR;
+    ddp.linear_solver_choice = LQSolverChoice::PARALLEL;
+    ddp.ls_params.interp_type = LSInterpolation::BISECTION;
+    ddp.speculative_ls_lanes = num_lanes;
+    ddp.setNumThreads(4);
+    ddp.setup(problem);
+    REQUIRE(ddp.run(problem));
+    return std::move(ddp.results_);
+  };
+  auto res_ref = solve_spec(1);
+  auto res_spec = solve_spec(4);
+  REQUIRE(res_ref.num_iters == res_spec.num_iters);
+  for (size_t i = 0; i <= nsteps; i++) {
+    REQUIRE(res_ref.xs[i].isApprox(res_spec.xs[i]));
+  }
+}
+#endif
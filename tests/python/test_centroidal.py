@@ -4,6 +4,7 @@ Test function related to centroidal residuals
 
 import aligator
 import numpy as np
+import pytest
 from aligator import manifolds
 
 np.random.seed(0)
@@ -309,6 +310,60 @@ def test_wrench_cone():
         assert np.allclose(fdata.Ju, fdata2.Ju, THRESH)
 
 
+def test_multi_contact_friction_cone():
+    x, d, x0 = sample_gauss(space)
+    u0 = np.random.randn(nu)
+    contact_ids = [0, 2, 3]
+    nc = len(contact_ids)
+    mu = 0.5
+    epsilon = 1e-3
+
+    fun = aligator.MultiContactFrictionConeResidual(
+        ndx, nu, contact_ids, mu, epsilon
+    )
+    assert fun.nr == 2 * nc
+    fdata = fun.createData()
+    fun.evaluate(x0, u0, fdata)
+    fun.computeJacobians(x0, u0, fdata)
+
+    # same rows as the per-contact cones, stacked by kind
+    for i, k in enumerate(contact_ids):
+        single = aligator.CentroidalFrictionConeResidual(ndx, nu, k, mu, epsilon)
+        sdata = single.createData()
+        single.evaluate(x0, u0, sdata)
+        single.computeJacobians(x0, u0, sdata)
+        assert np.allclose(fdata.value[[i, nc + i]], sdata.value)
+        assert np.allclose(fdata.Ju[[i, nc + i]], sdata.Ju)
+
+    with pytest.raises(Exception):
+        aligator.MultiContactFrictionConeResidual(ndx, nu, [nk], mu, epsilon)
+
+
+def test_multi_contact_wrench_cone():
+    x, d, x0 = sample_gauss(space)
+    force_size = 6
+    nu = force_size * nk
+    u0 = np.random.randn(nu)
+    contact_ids = [1, 3]
+    mu = 0.5
+    L = 0.1
+    W = 0.05
+
+    fun = aligator.MultiContactWrenchConeResidual(ndx, nu, contact_ids, mu, L, W)
+    fdata = fun.createData()
+    fun.evaluate(x0, u0, fdata)
+    fun.computeJacobians(x0, u0, fdata)
+
+    for i, k in enumerate(contact_ids):
+        single = aligator.CentroidalWrenchConeResidual(ndx, nu, k, mu, L, W)
+        sdata = single.createData()
+        single.evaluate(x0, u0, sdata)
+        single.computeJacobians(x0, u0, sdata)
+        rows = slice(17 * i, 17 * (i + 1))
+        assert np.allclose(fdata.value[rows], sdata.value)
+        assert np.allclose(fdata.Ju[rows], sdata.Ju)
+
+
 def test_angular_acceleration():
     x, d, x0 = sample_gauss(space)
     force_size = 3
@@ -258,6 +258,56 @@ def test_stack_error():
     print(e_info)
 
 
+def test_stacked_gauss_newton():
+    nx = 6
+    nu = 3
+    space = manifolds.VectorSpace(nx)
+    xres = aligator.StateErrorResidual(space, nu, space.rand())
+    ures = aligator.ControlErrorResidual(nx, np.zeros(nu))
+
+    def make_stack(stacked):
+        cost_stack = CostStack(space, nu)
+        xcost = aligator.QuadraticResidualCost(space, xres, np.eye(nx))
+        ucost = aligator.QuadraticResidualCost(space, ures, 2.0 * np.eye(nu))
+        cost_stack.addCost("x", xcost)
+        cost_stack.addCost("u", ucost, 0.5)
+        cost_stack.addCost("quad", QuadraticCost(np.eye(nx), np.eye(nu)))
+        cost_stack.stacked_gauss_newton = stacked
+        return cost_stack
+
+    x0 = space.rand()
+    u0 = np.random.randn(nu)
+    hessians = []
+    for stacked in (False, True):
+        cost_stack = make_stack(stacked)
+        data = cost_stack.createData()
+        cost_stack.evaluate(x0, u0, data)
+        cost_stack.computeGradients(x0, u0, data)
+        cost_stack.computeHessians(x0, u0, data)
+        hessians.append(data.hess.copy())
+    assert_allclose(hessians[0], hessians[1])
+
+
+def test_constant_hessians():
+    nx = 6
+    nu = 3
+    space = manifolds.VectorSpace(nx)
+    xres = aligator.StateErrorResidual(space, nu, space.rand())
+    ures = aligator.ControlErrorResidual(nx, np.zeros(nu))
+    assert xres.hasConstantJacobians()
+    assert ures.hasConstantJacobians()
+
+    cost_stack = CostStack(space, nu)
+    cost_stack.addCost("x", aligator.QuadraticResidualCost(space, xres, np.eye(nx)))
+    cost_stack.addCost("quad", QuadraticCost(np.eye(nx), np.eye(nu)))
+    assert cost_stack.hasConstantHessians()
+    ucost = aligator.QuadraticResidualCost(space, ures, np.eye(nu))
+    ucost.weights_parameter = "u_weights"
+    assert not ucost.hasConstantHessians()
+    cost_stack.addCost("u", ucost)
+    assert not cost_stack.hasConstantHessians()
+
+
 @pytest.mark.skipif(
     not HAS_PINOCCHIO, reason="Aligator was compiled without Pinocchio."
 )
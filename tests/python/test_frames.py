@@ -359,6 +359,87 @@ def test_frame_collision():
         assert np.allclose(fdata.Jx, fdata2.Jx, atol=ATOL)
 
 
+def make_capsules_geometry(frame_names):
+    import coal
+
+    geometry = pin.GeometryModel()
+    for name in frame_names:
+        fr_id = model.getFrameId(name)
+        geometry.addGeometryObject(
+            pin.GeometryObject(
+                name + "_capsule",
+                parent_joint=model.frames[fr_id].parentJoint,
+                parent_frame=fr_id,
+                placement=model.frames[fr_id].placement,
+                collision_geometry=coal.Capsule(0.05, 0.1),
+            )
+        )
+    geometry.addAllCollisionPairs()
+    return geometry
+
+
+def test_multi_frame_collision():
+    geometry = make_capsules_geometry(
+        ["larm_effector_body", "rarm_effector_body", "lleg_effector_body"]
+    )
+    npairs = len(geometry.collisionPairs)
+    space = manifolds.MultibodyConfiguration(model)
+    ndx = space.ndx
+    u0 = np.zeros(nu)
+
+    fun = aligator.MultiFrameCollisionResidual(ndx, nu, model, geometry)
+    assert fun.nr == npairs
+    fdata = fun.createData()
+    fun_fd = aligator.FiniteDifferenceHelper(space, fun, FD_EPS)
+    fdata2 = fun_fd.createData()
+    singles = [
+        aligator.FrameCollisionResidual(ndx, nu, model, geometry, k)
+        for k in range(npairs)
+    ]
+    sdatas = [f.createData() for f in singles]
+
+    for i in range(20):
+        x0 = sample_gauss(space)
+        fun.evaluate(x0, fdata)
+        fun.computeJacobians(x0, fdata)
+        for k in range(npairs):
+            singles[k].evaluate(x0, sdatas[k])
+            singles[k].computeJacobians(x0, sdatas[k])
+            assert np.allclose(fdata.value[k], sdatas[k].value[0])
+            assert np.allclose(fdata.Jx[k], sdatas[k].Jx[0])
+        fun_fd.evaluate(x0, u0, fdata2)
+        fun_fd.computeJacobians(x0, u0, fdata2)
+        assert np.allclose(fdata.Jx, fdata2.Jx, atol=ATOL)
+
+
+def test_multi_frame_collision_culling():
+    geometry = make_capsules_geometry(
+        ["larm_effector_body", "rarm_effector_body", "lleg_effector_body"]
+    )
+    npairs = len(geometry.collisionPairs)
+    space = manifolds.MultibodyConfiguration(model)
+    ndx = space.ndx
+    x0 = space.neutral()
+
+    fun = aligator.MultiFrameCollisionResidual(ndx, nu, model, geometry)
+    fdata = fun.createData()
+    fun.evaluate(x0, fdata)
+    distances = fdata.value.copy()
+    assert np.all(distances > 0.0)
+
+    # cull every separated pair: the values are lower bounds of the distances
+    fun_culled = aligator.MultiFrameCollisionResidual(
+        ndx, nu, model, geometry, list(range(npairs)), 0.0
+    )
+    fdata_culled = fun_culled.createData()
+    fun_culled.evaluate(x0, fdata_culled)
+    fun_culled.computeJacobians(x0, fdata_culled)
+    assert not any(fdata_culled.active_pairs)
+    assert np.all(fdata_culled.value <= distances + 1e-12)
+    assert np.all(fdata_culled.value > 0.0)
+    assert np.allclose(fdata_culled.Jx, 0.0)
+
+
 def test_frame_collision_no_collision_pairs():
     space = manifolds.MultibodyConfiguration(model)
     ndx = space.ndx
@@ -92,6 +92,23 @@ def test_slicing():
     assert fs3.indices.tolist() == [1]
 
 
+def test_jacobian_pattern():
+    space = manifolds.VectorSpace(4)
+    nu = 2
+    ures = aligator.ControlErrorResidual(space.ndx, np.zeros(nu))
+    pattern = ures.jac_pattern
+    assert pattern.x_size == 0
+    assert pattern.u_begin == 0 and pattern.u_size == nu
+    assert not pattern.isDense(space.ndx, nu)
+
+    xres = aligator.StateErrorResidual(space, nu, space.neutral())
+    assert xres.jac_pattern.x_size == space.ndx
+    assert xres.jac_pattern.u_size == 0
+
+    ures.jac_pattern = aligator.JacobianPattern(space.ndx, nu)
+    assert ures.jac_pattern.isDense(space.ndx, nu)
+
+
 if __name__ == "__main__":
     import sys
 
@@ -105,6 +105,8 @@ if HAS_PINOCCHIO:
         dynamics.IntegratorEuler,
         dynamics.IntegratorSemiImplEuler,
         dynamics.IntegratorRK2,
+        dynamics.IntegratorRK4,
+        dynamics.IntegratorRK23,
     ],
 )
 def test_explicit_integrator_combinations(ode, integrator):
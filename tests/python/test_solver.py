@@ -129,5 +129,66 @@ def test_proxddp_lqr(lqr_problem_constrained, strategy):
     assert np.allclose(np.concatenate(res.lams), np.concatenate(res_copy.lams))
 
 
+def test_time_limit(lqr_problem):
+    problem, nx, nu, x0 = lqr_problem
+    nsteps = problem.num_steps
+    xs_init = [x0] * (nsteps + 1)
+    us_init = [np.zeros(nu)] * nsteps
+
+    for solver in [aligator.SolverFDDP(1e-6), aligator.SolverProxDDP(1e-6, 1e-2)]:
+        solver.setup(problem)
+        # budget exhausted before the first iteration
+        solver.time_limit = 1e-12
+        assert not solver.run(problem, xs_init, us_init)
+        assert solver.results.timed_out
+        assert solver.results.num_iters == 0
+
+        solver.time_limit = 10.0
+        assert solver.run(problem, xs_init, us_init)
+        assert not solver.results.timed_out
+
+
+def test_solver_stats(lqr_problem):
+    problem, nx, nu, x0 = lqr_problem
+    nsteps = problem.num_steps
+    xs_init = [x0] * (nsteps + 1)
+    us_init = [np.zeros(nu)] * nsteps
+
+    for solver in [aligator.SolverFDDP(1e-6), aligator.SolverProxDDP(1e-6, 1e-2)]:
+        solver.setup(problem)
+        assert solver.run(problem, xs_init, us_init)
+        stats: aligator.SolverStats = solver.results.stats
+        print(solver.results.num_iters, stats.num_merit_evals, stats.total())
+        assert stats.derivatives > 0.0
+        assert stats.backward > 0.0
+        assert stats.num_merit_evals >= solver.results.num_iters
+
+
+def test_data_arena(lqr_problem):
+    problem, nx, nu, x0 = lqr_problem
+    nsteps = problem.num_steps
+    xs_init = [x0] * (nsteps + 1)
+    us_init = [np.zeros(nu)] * nsteps
+
+    def solve():
+        solver = aligator.SolverProxDDP(1e-6, 1e-2)
+        solver.setup(problem)
+        assert solver.run(problem, xs_init, us_init)
+        return solver.results
+
+    res = solve()
+    for stage in problem.stages:
+        assert not stage.use_data_arena
+        stage.use_data_arena = True
+        assert stage.dataArenaSizeHint() > 0
+        data = stage.createData()
+        data.cost_data.grad[:] = 1.0
+        np.testing.assert_allclose(data.cost_data.grad, 1.0)
+    res_arena = solve()
+    assert res_arena.num_iters == res.num_iters
+    for x, x_arena in zip(res.xs, res_arena.xs):
+        np.testing.assert_allclose(x_arena, x)
+
+
 if __name__ == "__main__":
     sys.exit(pytest.main(sys.argv))
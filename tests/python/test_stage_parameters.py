@@ -0,0 +1,86 @@
+"""
+Test the stage parameters (targets, weights) updated in place.
+"""
+
+import sys
+
+import numpy as np
+import aligator
+import pytest
+
+from aligator.dynamics import LinearDiscreteDynamics
+from aligator.manifolds import VectorSpace
+
+NX = 4
+NU = 2
+NSTEPS = 10
+
+
+def make_problem():
+    space = VectorSpace(NX)
+    A = np.eye(NX)
+    A[:2, 2:] = 0.1 * np.eye(2)
+    B = np.zeros((NX, NU))
+    B[2:] = 0.1 * np.eye(NU)
+    dyn = LinearDiscreteDynamics(A, B, np.zeros(NX))
+
+    xcost = aligator.QuadraticStateCost(space, NU, np.zeros(NX), np.eye(NX))
+    xcost.setTargetParameter("x_ref")
+    ucost = aligator.QuadraticControlCost(space, NU, 1e-2 * np.eye(NU))
+    ucost.weights_parameter = "u_weights"
+    cost = aligator.CostStack(space, NU)
+    cost.addCost("x", xcost)
+    cost.addCost("u", ucost)
+
+    term_cost = aligator.QuadraticStateCost(space, NU, np.zeros(NX), np.eye(NX))
+    problem = aligator.TrajOptProblem(np.zeros(NX), NU, space, term_cost)
+    for _ in range(NSTEPS):
+        problem.addStage(aligator.StageModel(cost, dyn))
+    return problem
+
+
+def test_stage_parameters_views():
+    problem = make_problem()
+    params = problem.getStageParameters(0)
+    assert "x_ref" in params
+    assert "u_weights" in params
+    assert params.size == NX + NU * NU
+    np.testing.assert_allclose(params["u_weights"], 1e-2 * np.eye(NU).ravel())
+
+    # writes through the views are seen by the stage
+    params["x_ref"][:] = 1.0
+    np.testing.assert_allclose(problem.stages[0].parameters["x_ref"], 1.0)
+    params.values[:] = 0.0
+    np.testing.assert_allclose(problem.stages[0].parameters.values, 0.0)
+
+    with pytest.raises(RuntimeError):
+        params["x_ref"] = np.zeros(NX + 1)
+    with pytest.raises(RuntimeError):
+        problem.setStageParameters(0, np.zeros(1))
+
+
+def test_stage_parameters_mpc():
+    problem = make_problem()
+    solver = aligator.SolverProxDDP(1e-6, 1e-3)
+    solver.setup(problem)
+
+    for k in range(3):
+        for i in range(NSTEPS):
+            target = np.zeros(NX)
+            target[0] = np.sin(0.3 * (i + k))
+            problem.setStageParameter(i, "x_ref", target)
+        assert solver.run(problem)
+
+        # the last stage tracks its parameter
+        stage = problem.stages[NSTEPS - 1]
+        data = stage.createData()
+        x = solver.results.xs[NSTEPS - 1]
+        u = solver.results.us[NSTEPS - 1]
+        stage.evaluate(x, u, data)
+        err = x - stage.parameters["x_ref"]
+        expected = 0.5 * err.dot(err) + 0.5e-2 * u.dot(u)
+        assert data.cost_data.value == pytest.approx(expected)
+
+
+if __name__ == "__main__":
+    sys.exit(pytest.main(sys.argv))
@@ -0,0 +1,262 @@
+/// @file
+/// @copyright Copyright (C) 2026 INRIA
+#include "aligator/core/traj-opt-problem.hpp"
+#include "aligator/core/traj-opt-data.hpp"
+#include "aligator/core/stage-data.hpp"
+#include "aligator/core/shared-components.hpp"
+#include "aligator/core/vector-space.hpp"
+#include "aligator/modelling/costs/quad-state-cost.hpp"
+#include "aligator/modelling/costs/sum-of-costs.hpp"
+#include "aligator/modelling/linear-discrete-dynamics.hpp"
+#include "aligator/solvers/proxddp/solver-proxddp.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <utility>
+
+using namespace aligator;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+using StageModel = StageModelTpl<double>;
+using StageData = StageDataTpl<double>;
+using StageParameters = StageParametersTpl<double>;
+using VectorSpace = VectorSpaceTpl<double>;
+using QuadraticStateCost = QuadraticStateCostTpl<double>;
+using QuadraticControlCost = QuadraticControlCostTpl<double>;
+using CostStack = CostStackTpl<double>;
+using LinearDynamics = dynamics::LinearDiscreteDynamicsTpl<double>;
+using TrajOptProblem = TrajOptProblemTpl<double>;
+
+namespace {
+constexpr int nx = 4;
+constexpr int nu = 2;
+constexpr std::size_t nsteps = 10;
+
+LinearDynamics makeDynamics() {
+  MatrixXd A = MatrixXd::Identity(nx, nx);
+  A.topRightCorner(2, 2).setIdentity() *= 0.1;
+  MatrixXd B = MatrixXd::Zero(nx, nu);
+  B.bottomRows(nu).setIdentity() *= 0.1;
+  return LinearDynamics(A, B, VectorXd::Zero(nx));
+}
+
+/// Tracking stage, whose state target is either @p target or stage parameter
+/// "x_ref".
+StageModel makeStage(const VectorXd &target, bool use_parameter) {
+  const VectorSpace space(nx);
+  QuadraticStateCost xcost(space, nu, target, MatrixXd::Identity(nx, nx));
+  if (use_parameter)
+    xcost.setTargetParameter("x_ref");
+  CostStack cost(space, nu);
+  cost.addCost("x", xcost);
+  cost.addCost("u", QuadraticControlCost(space, nu,
+                                         MatrixXd::Identity(nu, nu) * 1e-2));
+  // the stage declares slot "x_ref"
+  return StageModel(cost, makeDynamics());
+}
+
+VectorXd targetAt(std::size_t t) {
+  VectorXd target = VectorXd::Zero(nx);
+  target[0] = std::sin(0.3 * double(t));
+  target[1] = std::cos(0.3 * double(t));
+  return target;
+}
+} // namespace
+
+TEST_CASE("stage_parameters_slots", "[stage_parameters]") {
+  StageParameters params;
+  REQUIRE(params.addSlot("a", VectorXd::Ones(3)) == 0);
+  REQUIRE(params.addSlot("b", VectorXd::Zero(2)) == 1);
+  REQUIRE(params.size() == 5);
+  REQUIRE(params.hasSlot("b"));
+  REQUIRE_FALSE(params.hasSlot("c"));
+  REQUIRE(params.slot("b").offset == 3);
+  REQUIRE_THROWS(params.addSlot("a", VectorXd::Ones(1)));
+  REQUIRE_THROWS(params.slot("c"));
+
+  params["b"] << 4., 5.;
+  REQUIRE(params.values()[4] == 5.);
+
+  StageParameters copy(params);
+  REQUIRE(copy.sameLayout(params));
+  copy.addSlot("c", VectorXd::Zero(1));
+  REQUIRE_FALSE(copy.sameLayout(params));
+}
+
+TEST_CASE("shared_stage_structure", "[stage_parameters]") {
+  auto structure =
+      std::make_shared<const StageModel>(makeStage(targetAt(0), true));
+
+  StageModel stage(structure);
+  const StageModel stage_copy(stage);
+  // the shared functions can be read, not modified
+  REQUIRE(std::as_const(stage).getCost<CostStack>() ==
+          structure->getCost<CostStack>());
+  REQUIRE(std::as_const(stage).getDynamics<LinearDynamics>() ==
+          structure->getDynamics<LinearDynamics>());
+  REQUIRE(stage.getCost<SharedCostTpl<double>>() != nullptr);
+  REQUIRE_THROWS(stage.getCost<CostStack>());
+  REQUIRE_THROWS(stage.getDynamics<LinearDynamics>());
+  const auto &shared_cost =
+      static_cast<const SharedCostTpl<double> &>(*stage_copy.cost_);
+  REQUIRE(&shared_cost.cost() == &*structure->cost_);
+  REQUIRE(stage_copy.parameters_.sameLayout(structure->parameters_));
+  REQUIRE(stage.nu() == nu);
+  REQUIRE(stage.ndx1() == nx);
+
+  // the stage reads its own parameters
+  const VectorXd target = targetAt(3);
+  stage.parameters_["x_ref"] = target;
+  const StageModel expected = makeStage(target, false);
+
+  const VectorXd x = VectorXd::Random(nx);
+  const VectorXd u = VectorXd::Random(nu);
+  auto data = stage.createData();
+  auto expected_data = expected.createData();
+  stage.evaluate(x, u, *data);
+  stage.computeFirstOrderDerivatives(x, u, *data);
+  stage.computeSecondOrderDerivatives(x, u, *data);
+  expected.evaluate(x, u, *expected_data);
+  expected.computeFirstOrderDerivatives(x, u, *expected_data);
+  expected.computeSecondOrderDerivatives(x, u, *expected_data);
+  REQUIRE(data->cost_data->value_ == expected_data->cost_data->value_);
+  REQUIRE(data->cost_data->grad_.isApprox(expected_data->cost_data->grad_));
+  REQUIRE(data->dynamics_data->xnext_.isApprox(
+      expected_data->dynamics_data->xnext_));
+
+  // the structure keeps its default parameters
+  auto structure_data = structure->createData();
+  structure->evaluate(x, u, *structure_data);
+  REQUIRE(structure_data->cost_data->value_ !=
+          expected_data->cost_data->value_);
+
+  // outside of a stage, the residual uses its own target
+  auto standalone = structure->cost_->createData();
+  structure->cost_->evaluate(x, u, *standalone);
+  REQUIRE(standalone->value_ == structure_data->cost_data->value_);
+}
+
+TEST_CASE("stage_parameters_layout_change", "[stage_parameters]") {
+  const StageModel stage = makeStage(targetAt(0), true);
+  // same functions, with the slot at another offset
+  StageModel other = stage;
+  other.parameters_ = StageParameters();
+  other.parameters_.addSlot("pad", VectorXd::Zero(3));
+  other.parameters_.addSlot("x_ref", targetAt(3));
+  const StageModel expected = makeStage(targetAt(3), false);
+
+  const VectorXd x = VectorXd::Random(nx);
+  const VectorXd u = VectorXd::Random(nu);
+  // the data was created by the first stage
+  auto data = stage.createData();
+  auto expected_data = expected.createData();
+  other.evaluate(x, u, *data);
+  expected.evaluate(x, u, *expected_data);
+  REQUIRE(data->cost_data->value_ == expected_data->cost_data->value_);
+
+  other.parameters_ = StageParameters();
+  other.parameters_.addSlot("x_ref", VectorXd::Zero(1));
+  REQUIRE_THROWS(other.evaluate(x, u, *data));
+}
+
+TEST_CASE("shared_stage_problem", "[stage_parameters]") {
+  auto structure =
+      std::make_shared<const StageModel>(makeStage(targetAt(0), true));
+  const VectorSpace space(nx);
+  const QuadraticStateCost term_cost(space, nu, targetAt(nsteps),
+                                     MatrixXd::Identity(nx, nx));
+  const VectorXd x0 = VectorXd::Zero(nx);
+
+  TrajOptProblem problem(x0, nu, space, term_cost);
+  TrajOptProblem reference(x0, nu, space, term_cost);
+  for (std::size_t t = 0; t < nsteps; t++) {
+    StageModel stage(structure);
+    stage.parameters_["x_ref"] = targetAt(t);
+    problem.addStage(stage);
+    reference.addStage(makeStage(targetAt(t), false));
+  }
+
+  auto solve = [](const TrajOptProblem &p) {
+    SolverProxDDPTpl<double> solver(1e-8, 1e-6);
+    solver.setup(p);
+    REQUIRE(solver.run(p));
+    return solver.results_;
+  };
+  const auto res = solve(problem);
+  const auto res_ref = solve(reference);
+  REQUIRE(std::abs(res.traj_cost_ - res_ref.traj_cost_) < 1e-8);
+  for (std::size_t t = 0; t <= nsteps; t++)
+    REQUIRE(res.xs[t].isApprox(res_ref.xs[t], 1e-6));
+
+  // update a parameter in place, as in an MPC loop
+  for (std::size_t t = 0; t < nsteps; t++) {
+    problem.stages_[t]->parameters_["x_ref"] = targetAt(t + 1);
+    reference.stages_[t]
+        ->getCost<CostStack>()
+        ->getComponent<QuadraticStateCost>("x")
+        ->setTarget(targetAt(t + 1));
+  }
+  const auto res2 = solve(problem);
+  const auto res2_ref = solve(reference);
+  REQUIRE(std::abs(res2.traj_cost_ - res2_ref.traj_cost_) < 1e-8);
+}
+
+TEST_CASE("stage_parameters_registry", "[stage_parameters]") {
+  StageModel stage = makeStage(targetAt(0), true);
+  REQUIRE(stage.parameters_.numSlots() == 1);
+  REQUIRE(stage.parameters_["x_ref"] == targetAt(0));
+
+  // read the control weights from the parameters as well
+  auto *costs = stage.getCost<CostStack>();
+  auto *ucost = costs->getComponent<QuadraticControlCost>("u");
+  ucost->weights_parameter_ = "u_weights";
+  stage.registerParameters();
+  REQUIRE(stage.parameters_.numSlots() == 2);
+  REQUIRE(stage.parameters_["x_ref"] == targetAt(0));
+  REQUIRE(stage.parameters_["u_weights"].size() == nu * nu);
+
+  const VectorSpace space(nx);
+  const QuadraticStateCost term_cost(space, nu, targetAt(nsteps),
+                                     MatrixXd::Identity(nx, nx));
+  TrajOptProblem problem(VectorXd::Zero(nx), nu, space, term_cost);
+  for (std::size_t t = 0; t < nsteps; t++)
+    problem.addStage(stage);
+
+  const MatrixXd wu = MatrixXd::Identity(nu, nu) * 0.5;
+  StageModel expected = makeStage(targetAt(2), false);
+  expected.getCost<CostStack>()
+      ->getComponent<QuadraticControlCost>("u")
+      ->weights_ = wu;
+
+  // write a flat buffer, laid out as the stage's parameters
+  const StageParameters &layout = problem.getStageParameters(2);
+  VectorXd buffer(layout.size());
+  buffer.segment(layout.slot("x_ref").offset, nx) = targetAt(2);
+  buffer.segment(layout.slot("u_weights").offset, nu * nu) = wu.reshaped();
+  problem.setStageParameters(2, buffer);
+  REQUIRE_THROWS(problem.setStageParameters(2, VectorXd::Zero(1)));
+  REQUIRE_THROWS(problem.setStageParameter(2, "x_ref", VectorXd::Zero(1)));
+
+  const VectorXd x = VectorXd::Random(nx);
+  const VectorXd u = VectorXd::Random(nu);
+  TrajOptDataTpl<double> data(problem);
+  auto expected_data = expected.createData();
+  problem.stages_[2]->evaluate(x, u, *data.stage_data[2]);
+  problem.stages_[2]->computeFirstOrderDerivatives(x, u, *data.stage_data[2]);
+  problem.stages_[2]->computeSecondOrderDerivatives(x, u,
+                                                    *data.stage_data[2]);
+  expected.evaluate(x, u, *expected_data);
+  expected.computeFirstOrderDerivatives(x, u, *expected_data);
+  expected.computeSecondOrderDerivatives(x, u, *expected_data);
+  const auto &cd = *data.stage_data[2]->cost_data;
+  REQUIRE(std::abs(cd.value_ - expected_data->cost_data->value_) < 1e-12);
+  REQUIRE(cd.grad_.isApprox(expected_data->cost_data->grad_));
+  REQUIRE(cd.hess_.isApprox(expected_data->cost_data->hess_));
+
+  // by name
+  problem.setStageParameter(3, "x_ref", targetAt(2));
+  problem.setStageParameter(3, "u_weights", wu.reshaped());
+  REQUIRE(problem.getStageParameters(3).values() == buffer);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "aligator/core/vector-space.hpp"
+
+/// Vector space going through the default batched operations of
+/// aligator::ManifoldAbstractTpl, which loop over the knots.
+struct LoopedVectorSpace : aligator::VectorSpaceTpl<double> {
+  using Base = aligator::VectorSpaceTpl<double>;
+  using Manifold = aligator::ManifoldAbstractTpl<double>;
+  using Base::Base;
+
+protected:
+  void integrateBatch_impl(const ConstMatrixRef &xs, const ConstMatrixRef &vs,
+                           const double alpha, MatrixRef out) const override {
+    Manifold::integrateBatch_impl(xs, vs, alpha, out);
+  }
+
+  void differenceBatch_impl(const ConstMatrixRef &x0s,
+                            const ConstMatrixRef &x1s,
+                            MatrixRef out) const override {
+    Manifold::differenceBatch_impl(x0s, x1s, out);
+  }
+};